@@ -41,6 +41,11 @@ this:SetLayout("TitledGridBack", 2, "Home > Microcontroller > LOOP",
                function() this:LoadFile("arch/arch_flags.h") end)
 ++*/
 
+/*--
+this:AddWidget("Spinbox", 1, 16, "Number of request ring slots")
+--*/
+#define __LOOP_RING_SLOTS__ 4
+
 #endif /* _LOOP_FLAGS_H_ */
 /*==============================================================================
   End of file
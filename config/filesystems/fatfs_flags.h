@@ -74,6 +74,11 @@ this:AddItem("Vietnam (1258)",                    "1258")
 --*/
 #define __FATFS_LFN_CODEPAGE__ 852
 
+/*--
+this:AddWidget("Checkbox", "Enable fast seek and free cluster map")
+--*/
+#define __FATFS_FAST_SEEK_ENABLE__ _NO_
+
 #endif /* _FATFS_FLAGS_H_ */
 /*==============================================================================
   End of file
@@ -249,6 +249,22 @@ this:SetToolTip("If this option is enabled then system is able to run scripts wi
 --*/
 #define __OS_SYSTEM_SHEBANG_ENABLE__ _NO_
 
+/*--
+this:AddWidget("Checkbox", "Kernel event tracer")
+this:SetToolTip("If this option is enabled then kernel records context switches, " ..
+                "system calls, blocking on queues and mutexes, driver calls, and " ..
+                "memory allocations in the trace buffer (/proc/stat/trace).")
+--*/
+#define __OS_TRACE_ENABLE__ _NO_
+
+/*--
+this:AddWidget("Checkbox", "System call statistics")
+this:SetToolTip("If this option is enabled then kernel counts system calls, " ..
+                "errors, queue wait and service time, and call time histogram " ..
+                "of each system call and process (/proc/syscalls).")
+--*/
+#define __OS_SYSCALL_STAT_ENABLE__ _NO_
+
 /*--
 this:AddExtraWidget("Void", "VoidOption") -- uncomment if number of upper widgets is odd
 this:AddExtraWidget("Label", "LabelSizes", "\nMemory parameters", -1, "bold")
@@ -300,6 +316,37 @@ this:SetToolTip("This option determine period of cache synchronization with stor
 --*/
 #define __OS_SYSTEM_CACHE_SYNC_PERIOD__ 30
 
+/*--
+this:AddWidget("Spinbox", 10, 10000, "Block request deadline [ms]")
+this:SetToolTip("This option determine maximum time after that block device " ..
+                "request is dispatched before requests sorted by position.")
+--*/
+#define __OS_SYSTEM_BLKQ_DEADLINE__ 500
+
+/*--
+this:AddWidget("Spinbox", 0, 65536, "Block request merge size [bytes]")
+this:SetToolTip("This option determine maximum size of merged block device " ..
+                "requests that use temporary buffer. Use 0 to merge only " ..
+                "requests with continuous buffers.")
+--*/
+#define __OS_SYSTEM_BLKQ_MERGE_MAX__ 4096
+
+/*--
+this:AddWidget("Spinbox", 512, 65536, "In-kernel file copy buffer [bytes]")
+this:SetToolTip("This option determine maximum size of kernel buffer used by " ..
+                "copy_file_range() and socket_sendfile(). Larger buffer " ..
+                "transfers data in larger requests. Buffer is reduced if " ..
+                "there is not enough free memory.")
+--*/
+#define __OS_SYSTEM_COPY_BUFFER_SIZE__ 16384
+
+/*--
+this:AddWidget("Spinbox", 16, 4096, "Trace buffer length [records]")
+this:SetToolTip("This option determine number of records kept by kernel event " ..
+                "tracer. Each record uses 20 bytes of RAM.")
+--*/
+#define __OS_TRACE_BUFFER_LENGTH__ 256
+
 /*--
 this:AddWidget("Spinbox", 0, 16777216, "Network memory limit [bytes]")
 this:SetToolTip("This option enables memory limit for network subsystem. Use 0 for no limit.")
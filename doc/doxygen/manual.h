@@ -128,6 +128,7 @@ There are documented libraries that are modified for system purposes.
 \li \subpage dnx-misc-h     The set of helpful macros and functions
 \li \subpage dnx-net-h      The set of networking functions
 \li \subpage dnx-os-h       The dnx RTOS specific functions
+\li \subpage dnx-procstat-h Binary records of procfs statistic files
 \li \subpage dnx-thread-h   The set of functions for thread handling
 \li \subpage dnx-vt100-h    VT100 terminal handling
 \li \subpage sys-endian-h   Endianness
@@ -137,12 +138,15 @@ There are documented libraries that are modified for system purposes.
 \li \subpage sys-stat-h     Library contains functions for nodes create and information
 \li \subpage sys-statfs-h   File systems information
 \li \subpage sys-types-h    System types
+\li \subpage sys-uio-h      Vectored I/O operations
+\li \subpage aio-h          Asynchronous file input/output
 \li \subpage assert-h       Program assertion macro
 \li \subpage ctype-h        Character classification routines
 \li \subpage dirent-h       Directory handling
 \li \subpage errno-h        Error code list
 \li \subpage locale-h       Location specific settings
 \li \subpage mntent-h       Information about file system entry
+\li \subpage poll-h         Waiting for readiness of files and sockets
 \li \subpage stdio-h        Standard IO library
 \li \subpage stdlib-h       Standard library
 \li \subpage string-h       String manipulation library
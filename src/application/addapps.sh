@@ -84,6 +84,71 @@ function create_makefile_libs()
     done
 }
 
+#-------------------------------------------------------------------------------
+# @brief  Calculates hash of program name (32-bit FNV-1a). The same function is
+#         used by kernel to find program (kernel/process.c).
+# @param  program name
+# @return hash value
+#-------------------------------------------------------------------------------
+function name_hash()
+{
+    local name="$1"
+    local hash=2166136261
+    local char
+
+    for (( i=0; i<${#name}; i++ )); do
+        printf -v char '%d' "'${name:$i:1}"
+        hash=$(( ((hash ^ char) * 16777619) & 0xFFFFFFFF ))
+    done
+
+    echo $hash
+}
+
+#-------------------------------------------------------------------------------
+# @brief  Creates hash table of program names (open addressing with linear
+#         probing). Table contains index of program in program table + 1,
+#         0 is empty slot. Table size is power of 2 and at least twice as big
+#         as number of programs.
+# @param  None
+# @return None
+#-------------------------------------------------------------------------------
+function create_program_hash_table()
+{
+    local count=$(echo $program_list | wc -w)
+    local size=2
+    local slots=()
+    local index=1
+
+    while (( size < 2 * count )); do
+        size=$(( size * 2 ))
+    done
+
+    for (( i=0; i<size; i++ )); do
+        slots[$i]=0
+    done
+
+    for prog in $program_list; do
+        local slot=$(( $(name_hash "$prog") & (size - 1) ))
+
+        while (( slots[slot] != 0 )); do
+            slot=$(( (slot + 1) & (size - 1) ))
+        done
+
+        slots[$slot]=$index
+        index=$(( index + 1 ))
+    done
+
+    echo 'const u16_t _prog_hash_table[] = {'
+    for (( i=0; i<size; i+=8 )); do
+        echo "        $(echo ${slots[@]:$i:8} | sed 's/ /, /g'),"
+    done
+    echo '};'
+
+    echo ''
+    echo 'const int _prog_hash_table_size = ARRAY_SIZE(_prog_hash_table);'
+    echo ''
+}
+
 #-------------------------------------------------------------------------------
 # @brief  Creates empty program registration file
 # @param  None
@@ -112,6 +177,8 @@ function create_program_registration_file()
     echo ''
     echo 'const int _prog_table_size = ARRAY_SIZE(_prog_table);'
     echo ''
+
+    create_program_hash_table
 }
 
 #-------------------------------------------------------------------------------
@@ -0,0 +1,643 @@
+/*=========================================================================*//**
+@file    bench.c
+
+@author  Daniel Zorychta
+
+@brief   System performance benchmark (VFS, heap, pipe, syscall, I/O latency
+         under background load).
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <dnx/os.h>
+#include <dnx/thread.h>
+#include <dnx/misc.h>
+
+/*==============================================================================
+  Local symbolic constants/macros
+==============================================================================*/
+#define PATH_LEN                96
+#define BLOCK_SIZE              512
+#define FILE_SIZE               (16 * 1024)
+#define PIPE_MSG_SIZE           8
+#define HEAP_BLOCK_SIZE         64
+#define MAX_SAMPLES             128
+#define MIN_BATCH_TIME_MS       10
+#define DEFAULT_TIME_MS         1000
+#define MAX_BATCH               (1 << 16)
+#define LOAD_THREADS            2
+#define LOAD_BLOCK_SIZE         (4 * 1024)
+#define LOAD_FILE_SIZE          (64 * 1024)
+#define LOAD_PRIORITY           (PRIORITY_NORMAL - 1)
+
+/*
+ * Write latency bound under background load. Foreground write has higher
+ * priority than load threads, so it shall wait at most for one background
+ * block transfer. Bound is stated for /tmp (ramfs), it can be changed by
+ * -p option for slower media.
+ */
+#define IOLOAD_P99_MAX_US       10000
+
+/*==============================================================================
+  Local types, enums definitions
+==============================================================================*/
+typedef int (*test_fn_t)(void);
+
+typedef struct {
+        const char *name;
+        int       (*setup)(void);
+        test_fn_t   op;
+        void      (*teardown)(void);
+        bool        bounded;            //!< test fails if p99 exceeds bound
+} test_t;
+
+/*==============================================================================
+  Local function prototypes
+==============================================================================*/
+static int  op_syscall(void);
+static int  op_heap(void);
+static int  op_open(void);
+static int  op_stat(void);
+static int  setup_file(void);
+static int  op_write(void);
+static int  op_read(void);
+static void teardown_file(void);
+static int  setup_pipe(void);
+static int  op_pipe(void);
+static void teardown_pipe(void);
+static int  op_spawn(void);
+static int  setup_ioload(void);
+static void teardown_ioload(void);
+
+/*==============================================================================
+  Local object definitions
+==============================================================================*/
+GLOBAL_VARIABLES_SECTION {
+        char   dir[PATH_LEN];
+        char   file_path[PATH_LEN];
+        char   pipe_path[PATH_LEN];
+        FILE  *file;
+        FILE  *pipe;
+        size_t file_pos;
+        u32_t  test_time;
+        u32_t  p99_max;
+        u32_t  sample[MAX_SAMPLES];
+        u8_t   buf[BLOCK_SIZE];
+        char   load_path[LOAD_THREADS][PATH_LEN];
+        tid_t  load_tid[LOAD_THREADS];
+        volatile bool load_stop;
+};
+
+static const test_t TEST[] = {
+        {.name = "syscall", .setup = NULL,         .op = op_syscall, .teardown = NULL           },
+        {.name = "heap",    .setup = NULL,         .op = op_heap,    .teardown = NULL           },
+        {.name = "open",    .setup = setup_file,   .op = op_open,    .teardown = teardown_file  },
+        {.name = "stat",    .setup = setup_file,   .op = op_stat,    .teardown = teardown_file  },
+        {.name = "write",   .setup = setup_file,   .op = op_write,   .teardown = teardown_file  },
+        {.name = "read",    .setup = setup_file,   .op = op_read,    .teardown = teardown_file  },
+        {.name = "pipe",    .setup = setup_pipe,   .op = op_pipe,    .teardown = teardown_pipe  },
+        {.name = "spawn",   .setup = NULL,         .op = op_spawn,   .teardown = NULL           },
+        {.name = "ioload",  .setup = setup_ioload, .op = op_write,   .teardown = teardown_ioload, .bounded = true},
+};
+
+/*==============================================================================
+  Exported object definitions
+==============================================================================*/
+
+/*==============================================================================
+  Function definitions
+==============================================================================*/
+//==============================================================================
+/**
+ * @brief  Syscall round trip.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int op_syscall(void)
+{
+        return getpid() ? 0 : -1;
+}
+
+//==============================================================================
+/**
+ * @brief  Heap allocation and release.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int op_heap(void)
+{
+        void *mem = malloc(HEAP_BLOCK_SIZE);
+        if (mem) {
+                free(mem);
+                return 0;
+        }
+
+        return -1;
+}
+
+//==============================================================================
+/**
+ * @brief  Create test file of size FILE_SIZE.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int setup_file(void)
+{
+        snprintf(global->file_path, PATH_LEN, "%s/.bench", global->dir);
+
+        global->file = fopen(global->file_path, "w+");
+        if (global->file) {
+                memset(global->buf, 0xAA, BLOCK_SIZE);
+
+                for (size_t i = 0; i < FILE_SIZE / BLOCK_SIZE; i++) {
+                        if (fwrite(global->buf, 1, BLOCK_SIZE, global->file) != BLOCK_SIZE) {
+                                return -1;
+                        }
+                }
+
+                fflush(global->file);
+                rewind(global->file);
+                global->file_pos = 0;
+                return 0;
+        }
+
+        return -1;
+}
+
+//==============================================================================
+/**
+ * @brief  Close and remove test file.
+ */
+//==============================================================================
+static void teardown_file(void)
+{
+        if (global->file) {
+                fclose(global->file);
+                global->file = NULL;
+        }
+
+        remove(global->file_path);
+}
+
+//==============================================================================
+/**
+ * @brief  Open and close test file.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int op_open(void)
+{
+        FILE *f = fopen(global->file_path, "r");
+        if (f) {
+                fclose(f);
+                return 0;
+        }
+
+        return -1;
+}
+
+//==============================================================================
+/**
+ * @brief  Read status of test file.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int op_stat(void)
+{
+        struct stat st;
+        return stat(global->file_path, &st);
+}
+
+//==============================================================================
+/**
+ * @brief  Move to next block of test file, wrap at end of file.
+ */
+//==============================================================================
+static void next_block(void)
+{
+        global->file_pos += BLOCK_SIZE;
+
+        if (global->file_pos >= FILE_SIZE) {
+                global->file_pos = 0;
+                rewind(global->file);
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Sequential block write.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int op_write(void)
+{
+        if (fwrite(global->buf, 1, BLOCK_SIZE, global->file) != BLOCK_SIZE) {
+                return -1;
+        }
+
+        next_block();
+        return 0;
+}
+
+//==============================================================================
+/**
+ * @brief  Sequential block read.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int op_read(void)
+{
+        if (fread(global->buf, 1, BLOCK_SIZE, global->file) != BLOCK_SIZE) {
+                return -1;
+        }
+
+        next_block();
+        return 0;
+}
+
+//==============================================================================
+/**
+ * @brief  Create and open test FIFO.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int setup_pipe(void)
+{
+        snprintf(global->pipe_path, PATH_LEN, "%s/.bench_fifo", global->dir);
+
+        if (mkfifo(global->pipe_path, 0666) == 0) {
+                global->pipe = fopen(global->pipe_path, "r+");
+                if (global->pipe) {
+                        return 0;
+                }
+        }
+
+        return -1;
+}
+
+//==============================================================================
+/**
+ * @brief  Close and remove test FIFO.
+ */
+//==============================================================================
+static void teardown_pipe(void)
+{
+        if (global->pipe) {
+                fclose(global->pipe);
+                global->pipe = NULL;
+        }
+
+        remove(global->pipe_path);
+}
+
+//==============================================================================
+/**
+ * @brief  Pass message through FIFO.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int op_pipe(void)
+{
+        if (fwrite(global->buf, 1, PIPE_MSG_SIZE, global->pipe) == PIPE_MSG_SIZE) {
+                if (fread(global->buf, 1, PIPE_MSG_SIZE, global->pipe) == PIPE_MSG_SIZE) {
+                        return 0;
+                }
+        }
+
+        return -1;
+}
+
+//==============================================================================
+/**
+ * @brief  Spawn process that exits immediately and wait for it.
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int op_spawn(void)
+{
+        static const process_attr_t attr = {
+                .f_stdin   = NULL,
+                .f_stdout  = NULL,
+                .f_stderr  = NULL,
+                .p_stdin   = NULL,
+                .p_stdout  = NULL,
+                .p_stderr  = NULL,
+                .cwd       = NULL,
+                .priority  = PRIORITY_NORMAL,
+                .detached  = false
+        };
+
+        int   status = -1;
+        pid_t pid    = process_create("bench --nop", &attr);
+        if (pid) {
+                if (process_wait(pid, &status, MAX_DELAY_MS) == 0) {
+                        return status;
+                }
+        }
+
+        return -1;
+}
+
+//==============================================================================
+/**
+ * @brief  Background load thread. Writes large blocks to own file until test
+ *         is finished.
+ *
+ * @param  arg          file path
+ */
+//==============================================================================
+static void load_thread(void *arg)
+{
+        const char *path = arg;
+
+        FILE *f   = fopen(path, "w");
+        u8_t *buf = malloc(LOAD_BLOCK_SIZE);
+
+        if (f && buf) {
+                memset(buf, 0x55, LOAD_BLOCK_SIZE);
+
+                while (!global->load_stop) {
+                        if (  (fwrite(buf, 1, LOAD_BLOCK_SIZE, f) != LOAD_BLOCK_SIZE)
+                           || (ftell(f) >= LOAD_FILE_SIZE) ) {
+                                rewind(f);
+                        }
+                }
+        }
+
+        if (buf) {
+                free(buf);
+        }
+
+        if (f) {
+                fclose(f);
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Create test file and start low priority threads that write large
+ *         blocks in background. Block write of higher priority test thread
+ *         should not wait for background writes (latency is comparable to
+ *         the write test).
+ *
+ * @return 0 on success, -1 on error.
+ */
+//==============================================================================
+static int setup_ioload(void)
+{
+        static const thread_attr_t attr = {
+                .stack_depth = STACK_DEPTH_LOW,
+                .priority    = LOAD_PRIORITY,
+                .detached    = false
+        };
+
+        if (setup_file() != 0) {
+                return -1;
+        }
+
+        global->load_stop = false;
+
+        for (int i = 0; i < LOAD_THREADS; i++) {
+                snprintf(global->load_path[i], PATH_LEN, "%s/.bench_load%d", global->dir, i);
+
+                global->load_tid[i] = thread_create(load_thread, &attr, global->load_path[i]);
+                if (global->load_tid[i] == 0) {
+                        return -1;
+                }
+        }
+
+        return 0;
+}
+
+//==============================================================================
+/**
+ * @brief  Stop background threads and remove test files.
+ */
+//==============================================================================
+static void teardown_ioload(void)
+{
+        global->load_stop = true;
+
+        for (int i = 0; i < LOAD_THREADS; i++) {
+                if (global->load_tid[i]) {
+                        thread_join(global->load_tid[i]);
+                        global->load_tid[i] = 0;
+                        remove(global->load_path[i]);
+                }
+        }
+
+        teardown_file();
+}
+
+//==============================================================================
+/**
+ * @brief  Compare function of samples sort.
+ */
+//==============================================================================
+static int sample_cmp(const void *a, const void *b)
+{
+        u32_t x = *cast(const u32_t*, a);
+        u32_t y = *cast(const u32_t*, b);
+
+        return (x > y) - (x < y);
+}
+
+//==============================================================================
+/**
+ * @brief  Run operation n times.
+ *
+ * @param  op   operation
+ * @param  n    number of repetitions
+ *
+ * @return Execution time in milliseconds or -1 on error.
+ */
+//==============================================================================
+static i32_t run_batch(test_fn_t op, u32_t n)
+{
+        u32_t tref = get_time_ms();
+
+        for (u32_t i = 0; i < n; i++) {
+                if (op() != 0) {
+                        return -1;
+                }
+        }
+
+        return get_time_ms() - tref;
+}
+
+//==============================================================================
+/**
+ * @brief  Run selected test and print results.
+ *
+ * Operation is executed in batches. Batch size is calibrated to take at least
+ * MIN_BATCH_TIME_MS to keep timer resolution error low. Each batch produces
+ * one latency sample (average operation time in microseconds). Bounded test
+ * fails if p99 latency exceeds selected bound.
+ *
+ * @param  test         test to run
+ *
+ * @return On success 0, otherwise -1.
+ */
+//==============================================================================
+static int run_test(const test_t *test)
+{
+        int err = -1;
+
+        if (test->setup && test->setup() != 0) {
+                perror(test->name);
+                goto finish;
+        }
+
+        u32_t batch = 1;
+        i32_t dt    = 0;
+
+        while ((dt = run_batch(test->op, batch)) >= 0) {
+                if ((dt >= MIN_BATCH_TIME_MS) || (batch >= MAX_BATCH)) {
+                        break;
+                } else {
+                        batch *= 2;
+                }
+        }
+
+        size_t n     = 0;
+        u64_t  ops   = 0;
+        u32_t  total = 0;
+
+        while ((dt >= 0) && (n < MAX_SAMPLES) && (total < global->test_time)) {
+                dt = run_batch(test->op, batch);
+                if (dt >= 0) {
+                        global->sample[n++] = (cast(u64_t, dt) * 1000) / batch;
+                        ops   += batch;
+                        total += dt;
+                }
+        }
+
+        if (dt < 0) {
+                perror(test->name);
+                goto finish;
+        }
+
+        qsort(global->sample, n, sizeof(u32_t), sample_cmp);
+
+        u32_t p99 = global->sample[(n * 99) / 100];
+
+        printf("%-8s %10u %8u %8u %8u\n",
+               test->name,
+               cast(uint, total ? (ops * 1000) / total : 0),
+               global->sample[(n * 50) / 100],
+               global->sample[(n * 90) / 100],
+               p99);
+
+        if (test->bounded && (p99 > global->p99_max)) {
+                printf("%s: p99 %u us exceeds bound %u us\n",
+                       test->name, p99, global->p99_max);
+        } else {
+                err = 0;
+        }
+
+        finish:
+        if (test->teardown) {
+                test->teardown();
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Program main function
+ */
+//==============================================================================
+int_main(bench, STACK_DEPTH_LOW, int argc, char *argv[])
+{
+        // child of spawn test
+        if (argc == 2 && strcmp(argv[1], "--nop") == 0) {
+                return EXIT_SUCCESS;
+        }
+
+        global->test_time = DEFAULT_TIME_MS;
+        global->p99_max   = IOLOAD_P99_MAX_US;
+        strlcpy(global->dir, "/tmp", PATH_LEN);
+
+        const char *only = NULL;
+
+        for (int i = 1; i < argc; i++) {
+                if (strcmp(argv[i], "-d") == 0 && (i + 1) < argc) {
+                        strlcpy(global->dir, argv[++i], PATH_LEN);
+
+                } else if (strcmp(argv[i], "-t") == 0 && (i + 1) < argc) {
+                        global->test_time = max(1, atoi(argv[++i]));
+
+                } else if (strcmp(argv[i], "-p") == 0 && (i + 1) < argc) {
+                        global->p99_max = max(1, atoi(argv[++i]));
+
+                } else if (argv[i][0] != '-' && !only) {
+                        only = argv[i];
+
+                } else {
+                        printf("Usage: %s [-d <dir>] [-t <ms>] [-p <us>] [test]\n", argv[0]);
+                        printf("  -d <dir>    working directory (default /tmp)\n");
+                        printf("  -t <ms>     duration of each test (default %d ms)\n", DEFAULT_TIME_MS);
+                        printf("  -p <us>     ioload p99 latency bound (default %d us)\n", IOLOAD_P99_MAX_US);
+                        printf("Tests:");
+                        for (size_t t = 0; t < ARRAY_SIZE(TEST); t++) {
+                                printf(" %s", TEST[t].name);
+                        }
+                        puts("");
+                        return EXIT_FAILURE;
+                }
+        }
+
+        printf("%-8s %10s %8s %8s %8s\n", "test", "ops/s", "p50[us]", "p90[us]", "p99[us]");
+
+        int err = 0;
+
+        for (size_t t = 0; t < ARRAY_SIZE(TEST); t++) {
+                if (!only || strcmp(only, TEST[t].name) == 0) {
+                        err |= run_test(&TEST[t]);
+                }
+        }
+
+        return err ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/*==============================================================================
+  End of file
+==============================================================================*/
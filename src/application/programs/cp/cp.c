@@ -36,11 +36,12 @@
 #include <errno.h>
 #include <dnx/os.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 /*==============================================================================
   Local symbolic constants/macros
 ==============================================================================*/
-#define BUFFER_MAX_SIZE                 8192
+#define COPY_CHUNK_SIZE                 16384
 #define INFO_REFRESH_TIME_MS            (CLOCKS_PER_SEC * 1)
 #define PATH_MAX_SIZE                   128
 
@@ -81,7 +82,6 @@ int_main(cp, STACK_DEPTH_MEDIUM, int argc, char *argv[])
         errno = 0;
 
         int   err      = EXIT_SUCCESS;
-        char *buffer   = NULL;
         FILE *src_file = NULL;
         FILE *dst_file = NULL;
 
@@ -99,36 +99,16 @@ int_main(cp, STACK_DEPTH_MEDIUM, int argc, char *argv[])
                 goto exit;
         }
 
-        int buffer_size = BUFFER_MAX_SIZE;
-        while ((buffer = malloc(buffer_size * sizeof(char))) == NULL) {
-                buffer_size /= 2;
+        // data is copied by kernel, user buffer is not needed
+        ssize_t n;
+        while ((n = copy_file_range(fileno(src_file), fileno(dst_file), COPY_CHUNK_SIZE)) > 0);
 
-                if (buffer_size < 512) {
-                        perror(NULL);
-                        err = EXIT_FAILURE;
-                        goto exit;
-                }
-        }
-
-        int n;
-        while (buffer && (n = fread(buffer, sizeof(char), buffer_size, src_file)) > 0) {
-                if (ferror(src_file)) {
-                        perror(argv[1]);
-                        break;
-                }
-
-                fwrite(buffer, sizeof(char), n, dst_file);
-                if (ferror(dst_file)) {
-                        perror(argv[2]);
-                        break;
-                }
+        if (n < 0) {
+                perror(ferror(dst_file) ? argv[2] : argv[1]);
+                err = EXIT_FAILURE;
         }
 
 exit:
-        if (buffer) {
-                free(buffer);
-        }
-
         if (src_file) {
                 fclose(src_file);
         }
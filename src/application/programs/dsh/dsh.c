@@ -52,6 +52,7 @@
 #define HISTORY_NEXT_KEY                "\033^[A"
 #define HISTORY_PREV_KEY                "\033^[B"
 #define COMMAND_HINT_KEY                "\033^[T"
+#define HINT_DIR_BUFFER_SIZE            512
 
 /*==============================================================================
   Local types, enums definitions
@@ -200,45 +201,51 @@ static bool command_hint()
                         *tabstart = '\0';
 
                         if (strlen(global->line) != 0) {
-                                dirent_t *dirent;
-                                int cnt  = 0;
+                                size_t len   = strlen(global->line);
+                                int    cnt   = 0;
+                                char   first[PROMPT_LINE_LEN];
+
+                                u64_t *buf = malloc(HINT_DIR_BUFFER_SIZE);
+                                DIR   *dir = opendir("/proc/bin");
+                                if (dir && buf) {
+                                        ssize_t n;
+                                        while ((n = readdir_bulk(dir, buf, HINT_DIR_BUFFER_SIZE, 0)) > 0) {
+                                                dirent_rec_t *rec = cast(dirent_rec_t*, buf);
+
+                                                while (n > 0) {
+                                                        if (strncmp(rec->d_name, global->line, len) == 0) {
+                                                                if (++cnt == 1) {
+                                                                        strlcpy(first, rec->d_name, sizeof(first));
+                                                                } else {
+                                                                        if (cnt == 2) {
+                                                                                printf("\n%s ", first);
+                                                                        }
+
+                                                                        printf("%s ", rec->d_name);
+                                                                }
+                                                        }
 
-                                DIR *dir = opendir("/proc/bin");
-                                if (dir) {
-                                        while ((dirent = readdir(dir))) {
-                                                if (strncmp(dirent->name, global->line, strlen(global->line)) == 0) {
-                                                        cnt++;
+                                                        n  -= rec->d_reclen;
+                                                        rec = cast(dirent_rec_t*, cast(u8_t*, rec) + rec->d_reclen);
                                                 }
                                         }
-
-                                        closedir(dir);
                                 }
 
-                                dir = opendir("/proc/bin");
                                 if (dir) {
-                                        if (cnt > 1) {
-                                                puts("");
-                                        }
-
-                                        while ((dirent = readdir(dir))) {
+                                        closedir(dir);
+                                }
 
-                                                if (strncmp(dirent->name, global->line, strlen(global->line)) == 0) {
-                                                        if (cnt > 1) {
-                                                                printf("%s ", dirent->name);
-                                                        } else  {
-                                                                ioctl(fileno(global->input), IOCTL_TTY__SET_EDITLINE, dirent->name);
-                                                                break;
-                                                        }
-                                                }
-                                        }
+                                if (buf) {
+                                        free(buf);
+                                }
 
-                                        closedir(dir);
+                                if (cnt == 1) {
+                                        ioctl(fileno(global->input), IOCTL_TTY__SET_EDITLINE, first);
 
-                                        if (cnt > 1) {
-                                                puts(" ");
-                                                print_prompt();
-                                                ioctl(fileno(global->input), IOCTL_TTY__REFRESH_LAST_LINE);
-                                        }
+                                } else if (cnt > 1) {
+                                        puts(" ");
+                                        print_prompt();
+                                        ioctl(fileno(global->input), IOCTL_TTY__REFRESH_LAST_LINE);
                                 }
                         }
 
@@ -45,6 +45,7 @@
   Local symbolic constants/macros
 ==============================================================================*/
 #define CWD_MAX_LEN                     128
+#define DIR_BUFFER_SIZE                 1024
 
 #define KiB                             (u32_t)(1024)
 #define MiB                             (u32_t)(1024*1024)
@@ -60,12 +61,14 @@
 /*==============================================================================
   Local function prototypes
 ==============================================================================*/
+static void print_entry(const char *name, const struct stat *st);
 
 /*==============================================================================
   Local object definitions
 ==============================================================================*/
 GLOBAL_VARIABLES_SECTION {
-        char cwd[CWD_MAX_LEN];
+        char  cwd[CWD_MAX_LEN];
+        u64_t dirbuf[DIR_BUFFER_SIZE / sizeof(u64_t)];
 };
 
 /*==============================================================================
@@ -75,6 +78,81 @@ GLOBAL_VARIABLES_SECTION {
 /*==============================================================================
   Function definitions
 ==============================================================================*/
+//==============================================================================
+/**
+ * @brief Function print directory entry.
+ *
+ * @param name          file name
+ * @param st            file attributes
+ */
+//==============================================================================
+static void print_entry(const char *name, const struct stat *st)
+{
+        const char *type;
+        switch (st->st_type) {
+        case FILE_TYPE_DIR:     type = VT100_FONT_COLOR_LIGHT_BLUE"d"; break;
+        case FILE_TYPE_DRV:     type = VT100_FONT_COLOR_MAGENTA"c";    break;
+        case FILE_TYPE_LINK:    type = VT100_FONT_COLOR_CYAN"l";       break;
+        case FILE_TYPE_REGULAR: type = VT100_FONT_COLOR_GREEN"-";      break;
+        case FILE_TYPE_PROGRAM: type = VT100_FONT_BOLD"*";             break;
+        case FILE_TYPE_PIPE:    type = VT100_FONT_COLOR_BROWN"p";      break;
+        default:                type = "?";                            break;
+        }
+
+        char mode[10];
+        mode[0] = (st->st_mode & S_IRUSR) ? 'r' : '-';
+        mode[1] = (st->st_mode & S_IWUSR) ? 'w' : '-';
+        mode[2] = (st->st_mode & S_IXUSR) ? 'x' : '-';
+        mode[3] = (st->st_mode & S_IRGRP) ? 'r' : '-';
+        mode[4] = (st->st_mode & S_IWGRP) ? 'w' : '-';
+        mode[5] = (st->st_mode & S_IXGRP) ? 'x' : '-';
+        mode[6] = (st->st_mode & S_IROTH) ? 'r' : '-';
+        mode[7] = (st->st_mode & S_IWOTH) ? 'w' : '-';
+        mode[8] = (st->st_mode & S_IXOTH) ? 'x' : '-';
+        mode[9] = '\0';
+
+        u32_t       size;
+        const char *unit;
+        if (st->st_size >= (u64_t)(10*GiB)) {
+                size = CONVERT_TO_GiB(st->st_size);
+                unit = "GiB";
+        } else if (st->st_size >= 10*MiB) {
+                size = CONVERT_TO_MiB(st->st_size);
+                unit = "MiB";
+        } else if (st->st_size >= 10*KiB) {
+                size = CONVERT_TO_KiB(st->st_size);
+                unit = "KiB";
+        } else {
+                size = st->st_size;
+                unit = "B";
+        }
+
+        int mod_id    = get_module_ID2(st->st_dev);
+        int mod_major = get_module_major(st->st_dev);
+        int mod_minor = get_module_minor(st->st_dev);
+
+        char mod[12];
+        memset(mod, 0, sizeof(mod));
+
+        if (st->st_type == FILE_TYPE_DRV) {
+                snprintf(mod, sizeof(mod), "%2d,%2d,%2d",
+                         mod_id, mod_major, mod_minor);
+        }
+
+        struct tm tm;
+        localtime_r(&st->st_mtime, &tm);
+
+        char time[24];
+        strftime(time, sizeof(time), "%d-%m-%Y %H:%M", &tm);
+
+        printf("%s%s %9u %s"
+               VT100_CURSOR_BACKWARD(999)VT100_CURSOR_FORWARD(24)"%s"
+               VT100_CURSOR_BACKWARD(999)VT100_CURSOR_FORWARD(34)"%s"
+               VT100_CURSOR_BACKWARD(999)VT100_CURSOR_FORWARD(51)"%s"
+               VT100_RESET_ATTRIBUTES"\n",
+               type, mode, size, unit, mod, time, name);
+}
+
 //==============================================================================
 /**
  * @brief Cat main function
@@ -109,93 +187,24 @@ int_main(ls, STACK_DEPTH_LOW, int argc, char *argv[])
         if (dir) {
                 errno = 0;
 
-                u16_t count = 0;
-
-                dirent_t *dirent = readdir(dir);
-                while (!errno && dirent) {
+                u16_t   count = 0;
+                ssize_t len;
 
-                        if (isstreq(dirent->name, ".") || isstreq(dirent->name, "..") ) {
-                                goto next;
-                        }
-
-                        struct stat st;
-                        if (stat(dirent->name, &st) == 0) {
-
-                                const char *type;
-                                switch (st.st_type) {
-                                case FILE_TYPE_DIR:     type = VT100_FONT_COLOR_LIGHT_BLUE"d"; break;
-                                case FILE_TYPE_DRV:     type = VT100_FONT_COLOR_MAGENTA"c";    break;
-                                case FILE_TYPE_LINK:    type = VT100_FONT_COLOR_CYAN"l";       break;
-                                case FILE_TYPE_REGULAR: type = VT100_FONT_COLOR_GREEN"-";      break;
-                                case FILE_TYPE_PROGRAM: type = VT100_FONT_BOLD"*";             break;
-                                case FILE_TYPE_PIPE:    type = VT100_FONT_COLOR_BROWN"p";      break;
-                                default:                type = "?";                            break;
-                                }
+                while ((len = readdir_bulk(dir, global->dirbuf, sizeof(global->dirbuf), READDIR_STAT)) > 0) {
+                        dirent_rec_t *rec = cast(dirent_rec_t*, global->dirbuf);
 
-                                char mode[10];
-                                mode[0] = (st.st_mode & S_IRUSR) ? 'r' : '-';
-                                mode[1] = (st.st_mode & S_IWUSR) ? 'w' : '-';
-                                mode[2] = (st.st_mode & S_IXUSR) ? 'x' : '-';
-                                mode[3] = (st.st_mode & S_IRGRP) ? 'r' : '-';
-                                mode[4] = (st.st_mode & S_IWGRP) ? 'w' : '-';
-                                mode[5] = (st.st_mode & S_IXGRP) ? 'x' : '-';
-                                mode[6] = (st.st_mode & S_IROTH) ? 'r' : '-';
-                                mode[7] = (st.st_mode & S_IWOTH) ? 'w' : '-';
-                                mode[8] = (st.st_mode & S_IXOTH) ? 'x' : '-';
-                                mode[9] = '\0';
-
-                                u32_t       size;
-                                const char *unit;
-                                if (st.st_size >= (u64_t)(10*GiB)) {
-                                        size = CONVERT_TO_GiB(st.st_size);
-                                        unit = "GiB";
-                                } else if (st.st_size >= 10*MiB) {
-                                        size = CONVERT_TO_MiB(st.st_size);
-                                        unit = "MiB";
-                                } else if (st.st_size >= 10*KiB) {
-                                        size = CONVERT_TO_KiB(st.st_size);
-                                        unit = "KiB";
-                                } else {
-                                        size = st.st_size;
-                                        unit = "B";
+                        while (len > 0) {
+                                if (!isstreq(rec->d_name, ".") && !isstreq(rec->d_name, "..")) {
+                                        print_entry(rec->d_name, &rec->d_stat);
+                                        count++;
                                 }
 
-                                int mod_id    = get_module_ID2(st.st_dev);
-                                int mod_major = get_module_major(st.st_dev);
-                                int mod_minor = get_module_minor(st.st_dev);
-
-                                char mod[12];
-                                memset(mod, 0, sizeof(mod));
-
-                                if (st.st_type == FILE_TYPE_DRV) {
-                                        snprintf(mod, sizeof(mod), "%2d,%2d,%2d",
-                                                 mod_id, mod_major, mod_minor);
-                                }
-
-                                struct tm tm;
-                                localtime_r(&st.st_mtime, &tm);
-
-                                char time[24];
-                                strftime(time, sizeof(time), "%d-%m-%Y %H:%M", &tm);
-
-                                printf("%s%s %9u %s"
-                                       VT100_CURSOR_BACKWARD(999)VT100_CURSOR_FORWARD(24)"%s"
-                                       VT100_CURSOR_BACKWARD(999)VT100_CURSOR_FORWARD(34)"%s"
-                                       VT100_CURSOR_BACKWARD(999)VT100_CURSOR_FORWARD(51)"%s"
-                                       VT100_RESET_ATTRIBUTES"\n",
-                                       type, mode, size, unit, mod, time, dirent->name);
-
-                                count++;
-                        } else {
-                                errno = EFAULT;
-                                break;
+                                len -= rec->d_reclen;
+                                rec  = cast(dirent_rec_t*, cast(u8_t*, rec) + rec->d_reclen);
                         }
-
-                        next:
-                        dirent = readdir(dir);
                 }
 
-                if (!(errno == ESUCC || errno == ENOENT)) {
+                if (len < 0) {
                         perror("Read dir");
                 }
 
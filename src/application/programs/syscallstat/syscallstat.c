@@ -0,0 +1,231 @@
+/*=========================================================================*//**
+@file    syscallstat.c
+
+@author  Daniel Zorychta
+
+@brief   System call statistics
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dnx/os.h>
+#include <dnx/misc.h>
+#include <dnx/procstat.h>
+
+/*==============================================================================
+  Local symbolic constants/macros
+==============================================================================*/
+#define SYSCALL_FILE            "/proc/stat/syscall"
+#define PROC_FILE               "/proc/stat/proc"
+
+/*==============================================================================
+  Local types, enums definitions
+==============================================================================*/
+
+/*==============================================================================
+  Local function prototypes
+==============================================================================*/
+
+/*==============================================================================
+  Local object definitions
+==============================================================================*/
+GLOBAL_VARIABLES_SECTION {
+        union {
+                procstat_syscall_t syscall;
+                procstat_proc_t    proc;
+        } rec;
+};
+
+/*==============================================================================
+  Exported object definitions
+==============================================================================*/
+
+/*==============================================================================
+  Function definitions
+==============================================================================*/
+//==============================================================================
+/**
+ * @brief  Function print usage.
+ *
+ * @param  name         program name
+ */
+//==============================================================================
+static void print_usage(const char *name)
+{
+        printf("Usage: %s [-a] [-H]\n", name);
+        puts("  -a     show also system calls that were not called");
+        puts("  -H     show call time histograms");
+}
+
+//==============================================================================
+/**
+ * @brief  Function print call time histogram of system call.
+ *
+ * @param  rec          system call record
+ */
+//==============================================================================
+static void print_histogram(const procstat_syscall_t *rec)
+{
+        for (uint i = 0; i < PROCSTAT_SYSCALL_HIST_BINS; i++) {
+                if (rec->hist[i] == 0) {
+                        continue;
+                }
+
+                if (i < PROCSTAT_SYSCALL_HIST_BINS - 1) {
+                        printf("    <%8u us: %u\n", 1U << (i + 4), cast(uint, rec->hist[i]));
+                } else {
+                        printf("   >=%8u us: %u\n", 1U << (i + 3), cast(uint, rec->hist[i]));
+                }
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Function print system call statistics.
+ *
+ * @param  all          print also not called system calls
+ * @param  histogram    print call time histograms
+ *
+ * @return Program exit status.
+ */
+//==============================================================================
+static int print_syscalls(bool all, bool histogram)
+{
+        FILE *f = fopen(SYSCALL_FILE, "r");
+        if (!f) {
+                perror(SYSCALL_FILE);
+                puts("System call statistics are disabled in configuration?");
+                return EXIT_FAILURE;
+        }
+
+        printf("%-20s %8s %6s %10s %10s %10s\n",
+               "syscall", "calls", "errors", "wait[us]", "svc[us]", "max[us]");
+
+        procstat_syscall_t *rec = &global->rec.syscall;
+
+        while (fread(rec, 1, sizeof(*rec), f) == sizeof(*rec)) {
+                if (  rec->hdr.version != PROCSTAT_VERSION
+                   || (rec->calls == 0 && !all) ) {
+                        continue;
+                }
+
+                u32_t calls = max(rec->calls, 1);
+
+                printf("%-20s %8u %6u %10u %10u %10u\n",
+                       rec->name,
+                       cast(uint, rec->calls),
+                       cast(uint, rec->errors),
+                       cast(uint, rec->wait_time / calls),
+                       cast(uint, rec->service_time / calls),
+                       cast(uint, rec->max_time));
+
+                if (histogram) {
+                        print_histogram(rec);
+                }
+        }
+
+        int status = ferror(f) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+        fclose(f);
+
+        return status;
+}
+
+//==============================================================================
+/**
+ * @brief  Function print system call statistics of processes.
+ *
+ * @return Program exit status.
+ */
+//==============================================================================
+static int print_processes(void)
+{
+        FILE *f = fopen(PROC_FILE, "r");
+        if (!f) {
+                perror(PROC_FILE);
+                return EXIT_FAILURE;
+        }
+
+        printf("\n%5s %-20s %8s %6s %12s\n", "PID", "process", "calls", "errors", "time[us]");
+
+        procstat_proc_t *rec = &global->rec.proc;
+
+        while (fread(rec, 1, sizeof(*rec), f) == sizeof(*rec)) {
+                if (rec->hdr.version != PROCSTAT_VERSION) {
+                        continue;
+                }
+
+                printf("%5u %-20s %8u %6u %12lu\n",
+                       cast(uint, rec->pid),
+                       rec->name,
+                       cast(uint, rec->syscalls),
+                       cast(uint, rec->syscall_errors),
+                       rec->syscall_time);
+        }
+
+        int status = ferror(f) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+        fclose(f);
+
+        return status;
+}
+
+//==============================================================================
+/**
+ * @brief Program main function
+ */
+//==============================================================================
+int_main(syscallstat, STACK_DEPTH_LOW, int argc, char *argv[])
+{
+        bool all       = false;
+        bool histogram = false;
+
+        for (int i = 1; i < argc; i++) {
+                if (strcmp(argv[i], "-a") == 0) {
+                        all = true;
+
+                } else if (strcmp(argv[i], "-H") == 0) {
+                        histogram = true;
+
+                } else {
+                        print_usage(argv[0]);
+                        return EXIT_FAILURE;
+                }
+        }
+
+        int status = print_syscalls(all, histogram);
+
+        if (status == EXIT_SUCCESS) {
+                status = print_processes();
+        }
+
+        return status;
+}
+
+/*==============================================================================
+  End of file
+==============================================================================*/
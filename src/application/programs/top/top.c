@@ -62,6 +62,8 @@
 GLOBAL_VARIABLES_SECTION {
         memstat_t      mem;
         process_stat_t pstat;
+        thread_stat_t  tstat;
+        bool           threads;
 };
 
 /*==============================================================================
@@ -92,7 +94,11 @@ int_main(top, STACK_DEPTH_LOW, int argc, char *argv[])
                 key = getchar();
                 ioctl(fileno(stdin), IOCTL_VFS__DEFAULT_RD_MODE);
 
-                if (!strchr("qk,.", key)) {
+                if (key == 't') {
+                        global->threads = !global->threads;
+                }
+
+                if (!strchr("qkt,.", key)) {
                         if ((clock() - timer) < REFRESH_INTERVAL_SEC) {
                                 msleep(KEY_READ_INTERVAL_SEC);
                                 continue;
@@ -108,14 +114,15 @@ int_main(top, STACK_DEPTH_LOW, int argc, char *argv[])
 
                 printf(VT100_CLEAR_SCREEN);
 
-                avg_CPU_load_t avg = {0, 0, 0, 0};
+                avg_CPU_load_t avg = {0, 0, 0, 0, 0};
                 get_average_CPU_load(&avg);
 
-                printf("%s - %dd %d:%02d up, avg. load %%: %d.%d, %d.%d, %d.%d\n",
+                printf("%s - %dd %d:%02d up, avg. load %%: %d.%d, %d.%d, %d.%d, irq %d.%d\n",
                         argv[0], udays, uhrs, umins,
                         avg.avg1min  / 10, avg.avg1min  % 10,
                         avg.avg5min  / 10, avg.avg5min  % 10,
-                        avg.avg15min / 10, avg.avg15min % 10);
+                        avg.avg15min / 10, avg.avg15min % 10,
+                        avg.IRQ_load / 10, avg.IRQ_load % 10);
 
                 printf("B Mem: %d total, %d used, %d free\n",
                         get_memory_size(), get_used_memory(), get_free_memory());
@@ -164,6 +171,23 @@ int_main(top, STACK_DEPTH_LOW, int argc, char *argv[])
                                 global->pstat.mutexes_count + global->pstat.queue_count
                                 + global->pstat.semaphores_count,
                                 global->pstat.name);
+
+                        size_t tseek = 0;
+                        while (  global->threads
+                              && thread_stat_seek(global->pstat.pid, tseek++, &global->tstat) == 0) {
+
+                                printf("%3s %2d %7s %4s %4s   %2d.%d %2d %3s `- %u sw, %lu.%03u s\n",
+                                        "",
+                                        global->tstat.priority,
+                                        "", "", "",
+                                        global->tstat.CPU_load / 10,
+                                        global->tstat.CPU_load % 10,
+                                        global->tstat.tid,
+                                        "",
+                                        global->tstat.switches,
+                                        global->tstat.runtime / 1000000,
+                                        cast(uint, (global->tstat.runtime / 1000) % 1000));
+                        }
                 }
 
                 if (key == 'k') {
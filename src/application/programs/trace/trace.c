@@ -0,0 +1,216 @@
+/*=========================================================================*//**
+@file    trace.c
+
+@author  Daniel Zorychta
+
+@brief   Kernel event tracer control
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dnx/os.h>
+#include <dnx/misc.h>
+#include <dnx/procstat.h>
+
+/*==============================================================================
+  Local symbolic constants/macros
+==============================================================================*/
+#define TRACE_FILE              "/proc/stat/trace"
+
+/*==============================================================================
+  Local types, enums definitions
+==============================================================================*/
+
+/*==============================================================================
+  Local function prototypes
+==============================================================================*/
+
+/*==============================================================================
+  Local object definitions
+==============================================================================*/
+GLOBAL_VARIABLES_SECTION {
+        procstat_trace_t rec;
+};
+
+static const char *EVENT_NAME[] = {
+        [PROCSTAT_TRACE_SWITCH       ] = "switch",
+        [PROCSTAT_TRACE_SYSCALL_ENTER] = "sc_enter",
+        [PROCSTAT_TRACE_SYSCALL_EXIT ] = "sc_exit",
+        [PROCSTAT_TRACE_SYSCALL_BEGIN] = "sc_begin",
+        [PROCSTAT_TRACE_SYSCALL_END  ] = "sc_end",
+        [PROCSTAT_TRACE_BLOCK_RECEIVE] = "blk_rcv",
+        [PROCSTAT_TRACE_BLOCK_SEND   ] = "blk_snd",
+        [PROCSTAT_TRACE_DRIVER_READ  ] = "drv_rd",
+        [PROCSTAT_TRACE_DRIVER_WRITE ] = "drv_wr",
+        [PROCSTAT_TRACE_DRIVER_DONE  ] = "drv_done",
+        [PROCSTAT_TRACE_ALLOC        ] = "alloc",
+        [PROCSTAT_TRACE_FREE         ] = "free",
+};
+
+/*==============================================================================
+  Exported object definitions
+==============================================================================*/
+
+/*==============================================================================
+  Function definitions
+==============================================================================*/
+//==============================================================================
+/**
+ * @brief  Function print usage.
+ *
+ * @param  name         program name
+ */
+//==============================================================================
+static void print_usage(const char *name)
+{
+        printf("Usage: %s <command>\n", name);
+        puts("  start          start recording");
+        puts("  stop           stop recording");
+        puts("  clear          drop recorded events");
+        puts("  show           print recorded events");
+        puts("  save <file>    save recorded events in binary form");
+        puts("Recording is paused while events are read.");
+}
+
+//==============================================================================
+/**
+ * @brief  Function read recorded events and print or save them.
+ *
+ * @param  out          output file (binary), NULL to print events
+ *
+ * @return Program exit status.
+ */
+//==============================================================================
+static int read_events(FILE *out)
+{
+        int status = EXIT_FAILURE;
+
+        bool prev = trace_enable(false);
+
+        FILE *f = fopen(TRACE_FILE, "r");
+        if (f) {
+                u32_t n = 0;
+
+                if (!out) {
+                        printf("%10s %12s %5s %2s %-8s %10s %10s\n",
+                               "seq", "time[us]", "pid", "th", "event", "arg0", "arg1");
+                }
+
+                while (fread(&global->rec, 1, sizeof(global->rec), f) == sizeof(global->rec)) {
+
+                        if (out) {
+                                if (fwrite(&global->rec, 1, sizeof(global->rec), out)
+                                   != sizeof(global->rec)) {
+                                        break;
+                                }
+
+                        } else {
+                                procstat_trace_t *rec = &global->rec;
+
+                                const char *name = "?";
+                                if (rec->event < ARRAY_SIZE(EVENT_NAME) && EVENT_NAME[rec->event]) {
+                                        name = EVENT_NAME[rec->event];
+                                }
+
+                                printf("%10u %12u %5u %2u %-8s 0x%08X 0x%08X\n",
+                                       cast(uint, rec->seq),
+                                       cast(uint, rec->timestamp),
+                                       cast(uint, rec->pid),
+                                       cast(uint, rec->thread),
+                                       name,
+                                       cast(uint, rec->arg[0]),
+                                       cast(uint, rec->arg[1]));
+                        }
+
+                        n++;
+                }
+
+                status = ferror(f) || (out && ferror(out)) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+                if (out) {
+                        printf("%u events saved\n", cast(uint, n));
+                }
+
+                fclose(f);
+        } else {
+                perror(TRACE_FILE);
+        }
+
+        trace_enable(prev);
+
+        return status;
+}
+
+//==============================================================================
+/**
+ * @brief Program main function
+ */
+//==============================================================================
+int_main(trace, STACK_DEPTH_LOW, int argc, char *argv[])
+{
+        if (argc < 2) {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+
+        if (strcmp(argv[1], "start") == 0) {
+                trace_enable(true);
+
+        } else if (strcmp(argv[1], "stop") == 0) {
+                trace_enable(false);
+
+        } else if (strcmp(argv[1], "clear") == 0) {
+                trace_clear();
+
+        } else if (strcmp(argv[1], "show") == 0) {
+                return read_events(NULL);
+
+        } else if (strcmp(argv[1], "save") == 0 && argc == 3) {
+                int status = EXIT_FAILURE;
+
+                FILE *out = fopen(argv[2], "w");
+                if (out) {
+                        status = read_events(out);
+                        fclose(out);
+                } else {
+                        perror(argv[2]);
+                }
+
+                return status;
+
+        } else {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+}
+
+/*==============================================================================
+  End of file
+==============================================================================*/
@@ -117,8 +117,9 @@ void _cpuctl_shutdown_system(void)
 
 //==============================================================================
 /**
- * @brief  Start counter used for CPU load measurement. Timer should be set
- *         to at least 1MHz and should not overflow until 1 second.
+ * @brief  Start counter used for CPU load measurement. Core cycle counter
+ *         (DWT) is used. Counter is not reset because function is called
+ *         again when system clocks are changed.
  *
  * @param  None
  *
@@ -128,33 +129,28 @@ void _cpuctl_shutdown_system(void)
 #if (__OS_MONITOR_CPU_LOAD__ > 0)
 void _cpuctl_init_CPU_load_counter(void)
 {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
 }
 #endif
 
 //==============================================================================
 /**
- * @brief  Function return valut that was counted from last call of this function.
- *         This function must reset timer after read. Function is called from
- *         IRQs.
+ * @brief  Function return number of CPU cycles that were counted from last
+ *         call of this function. Function is called from IRQs and must be
+ *         called at least once per counter overflow (each system tick).
  *
  * @param  None
  *
- * @return Timer value for last read (time delta).
+ * @return Number of cycles from last read (time delta).
  */
 //==============================================================================
 #if (__OS_MONITOR_CPU_LOAD__ > 0)
 u32_t _cpuctl_get_CPU_load_counter_delta(void)
 {
         static uint32_t last;
-        bool  ovf = SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk;
-        u32_t now = SysTick->VAL;
-
-        u32_t delta;
-        if (ovf) {
-                delta = ((SysTick->LOAD + 1) - now) + last;
-        } else {
-                delta = last - now;
-        }
+        u32_t now   = DWT->CYCCNT;
+        u32_t delta = now - last;
 
         last = now;
 
@@ -162,6 +158,49 @@ u32_t _cpuctl_get_CPU_load_counter_delta(void)
 }
 #endif
 
+//==============================================================================
+/**
+ * @brief  Function return frequency of CPU load counter (CPU clock).
+ *
+ * @param  None
+ *
+ * @return Frequency in Hz.
+ */
+//==============================================================================
+#if (__OS_MONITOR_CPU_LOAD__ > 0)
+u32_t _cpuctl_get_CPU_load_counter_freq(void)
+{
+        return (SysTick->LOAD + 1) * __OS_TASK_SCHED_FREQ__;
+}
+#endif
+
+//==============================================================================
+/**
+ * @brief  Function return time elapsed from last system tick in microseconds.
+ *         If tick interrupt is pending then returned time is longer than tick
+ *         period. Function is called from IRQs.
+ *
+ * @param  None
+ *
+ * @return Time in microseconds.
+ */
+//==============================================================================
+u32_t _cpuctl_get_tick_elapsed_us(void)
+{
+        const u32_t tick_us = 1000000 / __OS_TASK_SCHED_FREQ__;
+
+        u32_t load = SysTick->LOAD + 1;
+        u32_t val  = SysTick->VAL;
+        u32_t us   = 0;
+
+        if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+                val = SysTick->VAL;
+                us  = tick_us;
+        }
+
+        return us + ((u64_t)(load - 1 - val) * tick_us) / load;
+}
+
 //==============================================================================
 /**
  * @brief  Function sleep CPU weakly. All IRQs must be able to wake up CPU.
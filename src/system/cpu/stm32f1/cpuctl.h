@@ -68,8 +68,11 @@ extern void  _cpuctl_update_system_clocks       (void);
 #if (__OS_MONITOR_CPU_LOAD__ > 0)
 extern void  _cpuctl_init_CPU_load_counter      (void);
 extern u32_t _cpuctl_get_CPU_load_counter_delta (void);
+extern u32_t _cpuctl_get_CPU_load_counter_freq  (void);
 #endif
 
+extern u32_t _cpuctl_get_tick_elapsed_us        (void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,578 @@
+/*==============================================================================
+File    blkq.c
+
+Author  Daniel Zorychta
+
+Brief   Block device request queue.
+
+        Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+        This program is free software; you can redistribute it and/or modify
+        it under the terms of the GNU General Public License as published by
+        the Free Software Foundation and modified by the dnx RTOS exception.
+
+        NOTE: The modification  to the GPL is  included to allow you to
+              distribute a combined work that includes dnx RTOS without
+              being obliged to provide the source  code for proprietary
+              components outside of the dnx RTOS.
+
+        The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+        but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+        MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+        GNU General Public License for more details.
+
+        Full license text is available on the following file: doc/license.txt.
+
+==============================================================================*/
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <string.h>
+#include "config.h"
+#include "drivers/class/storage/blkq.h"
+#include "drivers/drvctrl.h"
+#include "mm/mm.h"
+#include "kernel/errno.h"
+#include "kernel/kwrapper.h"
+#include "dnx/misc.h"
+#include "lib/cast.h"
+
+/*==============================================================================
+  Local macros
+==============================================================================*/
+#define MTX_TIMEOUT             MAX_DELAY_MS
+#define DEADLINE_MS             __OS_SYSTEM_BLKQ_DEADLINE__
+#define MERGE_MAX               __OS_SYSTEM_BLKQ_MERGE_MAX__
+
+/*==============================================================================
+  Local object types
+==============================================================================*/
+typedef struct blkq {
+        struct blkq        *next;               //!< next queue
+        dev_t               dev;                //!< device
+        blkq_req_t         *head;               //!< queued requests (submit order)
+        mutex_t            *dispatch_mtx;       //!< dispatcher lock
+        u64_t               head_pos;           //!< end position of the last transfer
+        struct blkq_stat    stat;               //!< queue statistics
+} blkq_t;
+
+typedef struct {
+        blkq_t             *list_head;          //!< device queues
+        mutex_t            *list_mtx;           //!< queues and requests protection
+} blkq_man_t;
+
+/*==============================================================================
+  Local function prototypes
+==============================================================================*/
+
+/*==============================================================================
+  Local objects
+==============================================================================*/
+static blkq_man_t bqman;
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  External objects
+==============================================================================*/
+
+/*==============================================================================
+  Function definitions
+==============================================================================*/
+
+//==============================================================================
+/**
+ * @brief Function return request position in bytes.
+ *
+ * @param  req          request
+ *
+ * @return Position.
+ */
+//==============================================================================
+static inline u64_t req_pos(const blkq_req_t *req)
+{
+        return cast(u64_t, req->blkpos) * req->blksz;
+}
+
+//==============================================================================
+/**
+ * @brief Function return request size in bytes.
+ *
+ * @param  req          request
+ *
+ * @return Size.
+ */
+//==============================================================================
+static inline size_t req_size(const blkq_req_t *req)
+{
+        return req->blksz * req->blkcnt;
+}
+
+//==============================================================================
+/**
+ * @brief Function find queue of selected device. If queue does not exist then
+ *        new one is created. Function must be called when list is locked.
+ *
+ * @param  dev          device
+ * @param  create       create queue if not exist
+ * @param  queue        found queue
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int queue_get(dev_t dev, bool create, blkq_t **queue)
+{
+        for (blkq_t *q = bqman.list_head; q; q = q->next) {
+                if (q->dev == dev) {
+                        *queue = q;
+                        return ESUCC;
+                }
+        }
+
+        if (!create) {
+                return ENOENT;
+        }
+
+        int err = _kzalloc(_MM_KRN, sizeof(blkq_t), cast(void*, queue));
+        if (!err) {
+                err = _mutex_create(MUTEX_TYPE_NORMAL, &(*queue)->dispatch_mtx);
+                if (!err) {
+                        (*queue)->dev  = dev;
+                        (*queue)->next = bqman.list_head;
+                        bqman.list_head = *queue;
+                } else {
+                        _kfree(_MM_KRN, cast(void*, queue));
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function remove selected request from queue. Function must be called
+ *        when list is locked.
+ *
+ * @param  q            queue
+ * @param  req          request to remove
+ */
+//==============================================================================
+static void queue_remove(blkq_t *q, blkq_req_t *req)
+{
+        blkq_req_t **link = &q->head;
+
+        while (*link && (*link != req)) {
+                link = &(*link)->next;
+        }
+
+        if (*link) {
+                *link = req->next;
+                req->next = NULL;
+        }
+}
+
+//==============================================================================
+/**
+ * @brief Function pick next request to dispatch. The oldest request is picked
+ *        if its deadline is expired, otherwise the nearest request above the
+ *        last transfer position is picked (one way elevator). Requests that
+ *        continue picked request in the same direction are merged to the
+ *        chain. Merged requests are transferred directly if buffers are
+ *        continuous, otherwise bounce buffer is used (up to MERGE_MAX bytes).
+ *        Function must be called when list is locked.
+ *
+ * @param  q            queue
+ * @param  contig       continuous buffers of chain
+ * @param  size         chain size in bytes
+ *
+ * @return Chain of requests, NULL if queue is empty.
+ */
+//==============================================================================
+static blkq_req_t *queue_pick(blkq_t *q, bool *contig, size_t *size)
+{
+        blkq_req_t *pick = NULL;
+
+        if (q->head && ((_kernel_get_time_ms() - q->head->tref) >= DEADLINE_MS)) {
+                pick = q->head;
+                q->stat.expired++;
+
+        } else {
+                blkq_req_t *lowest = NULL;
+
+                for (blkq_req_t *req = q->head; req; req = req->next) {
+                        u64_t pos = req_pos(req);
+
+                        if ((pos >= q->head_pos) && (!pick || (pos < req_pos(pick)))) {
+                                pick = req;
+                        }
+
+                        if (!lowest || (pos < req_pos(lowest))) {
+                                lowest = req;
+                        }
+                }
+
+                if (!pick) {
+                        pick = lowest;
+                }
+        }
+
+        if (pick) {
+                queue_remove(q, pick);
+
+                blkq_req_t *tail = pick;
+                *contig = true;
+                *size   = req_size(pick);
+
+                bool merged;
+                do {
+                        merged = false;
+
+                        u64_t end = req_pos(tail) + req_size(tail);
+
+                        for (blkq_req_t *req = q->head; req; req = req->next) {
+                                if ((req->write != pick->write) || (req_pos(req) != end)) {
+                                        continue;
+                                }
+
+                                bool next_contig = *contig && (req->buf == tail->buf + req_size(tail));
+
+                                if (next_contig || ((*size + req_size(req)) <= MERGE_MAX)) {
+                                        queue_remove(q, req);
+                                        tail->next = req;
+                                        tail       = req;
+                                        *contig    = next_contig;
+                                        *size     += req_size(req);
+                                        merged     = true;
+                                        q->stat.merged++;
+                                }
+
+                                break;
+                        }
+                } while (merged);
+        }
+
+        return pick;
+}
+
+//==============================================================================
+/**
+ * @brief Function transfer data between buffer and device.
+ *
+ * @param  dev          device
+ * @param  write        write transfer
+ * @param  buf          buffer
+ * @param  pos          device position
+ * @param  size         transfer size
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int driver_transfer(dev_t dev, bool write, u8_t *buf, u64_t pos, size_t size)
+{
+        fpos_t fpos = pos;
+        size_t cnt  = 0;
+        struct vfs_fattr fattr = {false, false};
+
+        int err = write ? _driver_write(dev, buf, size, &fpos, &cnt, fattr)
+                        : _driver_read(dev, buf, size, &fpos, &cnt, fattr);
+
+        if (!err && (cnt != size)) {
+                err = EIO;
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function transfer chain of requests. Status of each request is set.
+ *
+ * @param  q            queue
+ * @param  chain        chain of requests
+ * @param  contig       continuous buffers of chain
+ * @param  size         chain size in bytes
+ *
+ * @return Number of driver transfers.
+ */
+//==============================================================================
+static u32_t queue_transfer(blkq_t *q, blkq_req_t *chain, bool contig, size_t size)
+{
+        u8_t *buf = NULL;
+
+        if (contig) {
+                buf = chain->buf;
+
+        } else if (_kmalloc(_MM_KRN, size, cast(void*, &buf)) != ESUCC) {
+                u32_t transfers = 0;
+
+                for (blkq_req_t *req = chain; req; req = req->next) {
+                        req->err = driver_transfer(q->dev, req->write, req->buf,
+                                                   req_pos(req), req_size(req));
+                        transfers++;
+                }
+
+                return transfers;
+        }
+
+        if (!contig && chain->write) {
+                size_t offset = 0;
+                for (blkq_req_t *req = chain; req; req = req->next) {
+                        memcpy(&buf[offset], req->buf, req_size(req));
+                        offset += req_size(req);
+                }
+        }
+
+        int err = driver_transfer(q->dev, chain->write, buf, req_pos(chain), size);
+
+        size_t offset = 0;
+        for (blkq_req_t *req = chain; req; req = req->next) {
+                if (!err && !contig && !req->write) {
+                        memcpy(req->buf, &buf[offset], req_size(req));
+                }
+
+                offset  += req_size(req);
+                req->err = err;
+        }
+
+        if (!contig) {
+                _kfree(_MM_KRN, cast(void*, &buf));
+        }
+
+        return 1;
+}
+
+//==============================================================================
+/**
+ * @brief Function dispatch requests until queue is empty. Function must be
+ *        called when queue dispatcher is locked.
+ *
+ * @param  q            queue
+ */
+//==============================================================================
+static void queue_dispatch(blkq_t *q)
+{
+        while (_mutex_lock(bqman.list_mtx, MTX_TIMEOUT) == ESUCC) {
+
+                bool   contig = true;
+                size_t size   = 0;
+                blkq_req_t *chain = queue_pick(q, &contig, &size);
+
+                _mutex_unlock(bqman.list_mtx);
+
+                if (!chain) {
+                        break;
+                }
+
+                u32_t transfers = queue_transfer(q, chain, contig, size);
+
+                if (_mutex_lock(bqman.list_mtx, MTX_TIMEOUT) == ESUCC) {
+                        q->head_pos         = req_pos(chain) + size;
+                        q->stat.transfers  += transfers;
+
+                        blkq_req_t *req = chain;
+                        while (req) {
+                                blkq_req_t *next = req->next;
+
+                                if (req->write) {
+                                        q->stat.wr_bytes += req_size(req);
+                                } else {
+                                        q->stat.rd_bytes += req_size(req);
+                                }
+
+                                q->stat.depth--;
+                                req->next = NULL;
+                                req->done = true;
+                                req       = next;
+                        }
+
+                        _mutex_unlock(bqman.list_mtx);
+                }
+        }
+}
+
+//==============================================================================
+/**
+ * @brief Function initialize block queue subsystem.
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int _blkq_init(void)
+{
+        return _mutex_create(MUTEX_TYPE_NORMAL, &bqman.list_mtx);
+}
+
+//==============================================================================
+/**
+ * @brief Function submit requests and wait for completion. Requests can be
+ *        addressed to different devices. Requests of each device are added to
+ *        the device queue and the queue is dispatched by the task that first
+ *        gets access to the queue dispatcher, so requests of concurrent tasks
+ *        are sorted and merged together.
+ *
+ * @param  req          requests
+ * @param  count        number of requests
+ *
+ * @return One of errno value (the first error of requests).
+ */
+//==============================================================================
+int _blkq_submit(blkq_req_t *req, size_t count)
+{
+        if (!req || !count) {
+                return EINVAL;
+        }
+
+        int err = _mutex_lock(bqman.list_mtx, MTX_TIMEOUT);
+        if (err) {
+                return err;
+        }
+
+        u32_t now = _kernel_get_time_ms();
+
+        for (size_t i = 0; i < count; i++) {
+                req[i].next = NULL;
+                req[i].done = false;
+                req[i].err  = ESUCC;
+                req[i].tref = now;
+
+                blkq_t *q = NULL;
+                int e = queue_get(req[i].dev, true, &q);
+                if (!e) {
+                        blkq_req_t **link = &q->head;
+                        while (*link) {
+                                link = &(*link)->next;
+                        }
+
+                        *link = &req[i];
+
+                        q->stat.requests++;
+                        q->stat.depth++;
+                        q->stat.max_depth = max(q->stat.max_depth, q->stat.depth);
+
+                } else {
+                        req[i].err  = e;
+                        req[i].done = true;
+                }
+        }
+
+        _mutex_unlock(bqman.list_mtx);
+
+        for (size_t i = 0; i < count; i++) {
+                blkq_t *q = NULL;
+
+                if (_mutex_lock(bqman.list_mtx, MTX_TIMEOUT) == ESUCC) {
+                        if (!req[i].done) {
+                                queue_get(req[i].dev, false, &q);
+                        }
+
+                        _mutex_unlock(bqman.list_mtx);
+                }
+
+                if (q && (_mutex_lock(q->dispatch_mtx, MTX_TIMEOUT) == ESUCC)) {
+                        queue_dispatch(q);
+                        _mutex_unlock(q->dispatch_mtx);
+                }
+
+                if (!err) {
+                        err = req[i].err;
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function read blocks from device by using request queue.
+ *
+ * @param  dev          device
+ * @param  blkpos       block position
+ * @param  blksz        block size
+ * @param  blkcnt       block count
+ * @param  buf          buffer to read (blocks)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int _blkq_read(dev_t dev, u32_t blkpos, size_t blksz, size_t blkcnt, u8_t *buf)
+{
+        blkq_req_t req;
+        req.dev    = dev;
+        req.buf    = buf;
+        req.blkpos = blkpos;
+        req.blksz  = blksz;
+        req.blkcnt = blkcnt;
+        req.write  = false;
+
+        return _blkq_submit(&req, 1);
+}
+
+//==============================================================================
+/**
+ * @brief Function write blocks to device by using request queue.
+ *
+ * @param  dev          device
+ * @param  blkpos       block position
+ * @param  blksz        block size
+ * @param  blkcnt       block count
+ * @param  buf          buffer to write from (blocks)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int _blkq_write(dev_t dev, u32_t blkpos, size_t blksz, size_t blkcnt, const u8_t *buf)
+{
+        blkq_req_t req;
+        req.dev    = dev;
+        req.buf    = const_cast(u8_t*, buf);
+        req.blkpos = blkpos;
+        req.blksz  = blksz;
+        req.blkcnt = blkcnt;
+        req.write  = true;
+
+        return _blkq_submit(&req, 1);
+}
+
+//==============================================================================
+/**
+ * @brief Function return statistics of selected device queue.
+ *
+ * @param  idx          queue index
+ * @param  dev          queue device
+ * @param  stat         statistics container
+ *
+ * @return One of errno value. ENOENT if queue does not exist.
+ */
+//==============================================================================
+int sys_blkq_get_stat(size_t idx, dev_t *dev, struct blkq_stat *stat)
+{
+        if (!dev || !stat) {
+                return EINVAL;
+        }
+
+        int err = _mutex_lock(bqman.list_mtx, MTX_TIMEOUT);
+        if (!err) {
+                blkq_t *q = bqman.list_head;
+                while (q && idx--) {
+                        q = q->next;
+                }
+
+                if (q) {
+                        *dev  = q->dev;
+                        *stat = q->stat;
+                } else {
+                        err = ENOENT;
+                }
+
+                _mutex_unlock(bqman.list_mtx);
+        }
+
+        return err;
+}
+
+/*==============================================================================
+  End of file
+==============================================================================*/
@@ -38,6 +38,7 @@
 #include "kernel/process.h"
 #include "kernel/syscall.h"
 #include "kernel/sysfunc.h"
+#include "kernel/ktrace.h"
 #include "lib/vt100.h"
 #include "lib/llist.h"
 #include "fs/vfs.h"
@@ -423,7 +424,9 @@ int _driver_write(dev_t id, const u8_t *src, size_t count, fpos_t *fpos, size_t
 
         int err = driver__get_module_no_and_mem(id, &modno, &mem);
         if (!err) {
+                _ktrace(_KTRACE_DRIVER_WRITE, id, count);
                 err = _drvreg_module_table[modno].IF.drv_write(mem, src, count, fpos, wrcnt, fattr);
+                _ktrace(_KTRACE_DRIVER_DONE, id, err);
         }
 
         return err;
@@ -450,7 +453,9 @@ int _driver_read(dev_t id, u8_t *dst, size_t count, fpos_t *fpos, size_t *rdcnt,
 
         int err = driver__get_module_no_and_mem(id, &modno, &mem);
         if (!err) {
+                _ktrace(_KTRACE_DRIVER_READ, id, count);
                 err = _drvreg_module_table[modno].IF.drv_read(mem, dst, count, fpos, rdcnt, fattr);
+                _ktrace(_KTRACE_DRIVER_DONE, id, err);
         }
 
         return err;
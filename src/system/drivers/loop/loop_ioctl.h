@@ -412,6 +412,81 @@ request. Example code of handling flush request:
         // ...
 \endcode
 
+\subsection drv-loop-ddesc-ring Ring mode
+In the default mode only one client request can be handled at the same time
+and data is copied in small parts by the host buffers. When host is registered
+by @ref IOCTL_LOOP__HOST_RING_OPEN request then the ring mode is used. In this
+mode driver keeps up to <b>__LOOP_RING_SLOTS__</b> client requests at the same
+time (each request of other client or thread). Host fetches many pending
+requests by single @ref IOCTL_LOOP__HOST_RING_FETCH request and completes
+many requests by single @ref IOCTL_LOOP__HOST_RING_COMPLETE request. The
+read/write requests contain address of client buffer so host reads and writes
+client data directly without additional copy. Client buffer is valid until
+request is completed. Request that is not fetched by host before client
+timeout (20s) is finished with ETIME error. Fetched request is always waited
+for completion, because host uses client buffer. Ring mode is
+finished by @ref IOCTL_LOOP__HOST_CLOSE request, all not completed requests are
+finished with ESRCH error. The same is done when host process is killed
+(detected by client after 20s of waiting). Example code:
+\code
+        #include <stdio.h>
+        #include <string.h>
+        #include <sys/ioctl.h>
+        #include <errno.h>
+
+        // ...
+        FILE *loop_dev;         // opened device
+
+        // ...
+
+        if (ioctl(fileno(loop_dev), IOCTL_LOOP__HOST_RING_OPEN) != 0) {
+                perror(NULL);
+                return;
+        }
+
+        while (true) {
+                LOOP_ring_request_t    rq[4];
+                LOOP_ring_completion_t cpl[4];
+
+                LOOP_ring_fetch_t fetch = {.rq = rq, .count = 4};
+                if (ioctl(fileno(loop_dev), IOCTL_LOOP__HOST_RING_FETCH, &fetch) != 0) {
+                        continue;
+                }
+
+                for (size_t i = 0; i < fetch.count; i++) {
+                        cpl[i].tag  = rq[i].tag;
+                        cpl[i].err  = ESUCC;
+                        cpl[i].size = 0;
+
+                        switch (rq[i].cmd) {
+                        case LOOP_CMD__TRANSMISSION_CLIENT2HOST:
+                                // data from rq[i].arg.rw.data, rq[i].arg.rw.size bytes
+                                // ...
+                                cpl[i].size = rq[i].arg.rw.size;
+                                break;
+
+                        case LOOP_CMD__TRANSMISSION_HOST2CLIENT:
+                                // data to rq[i].arg.rw.data, up to rq[i].arg.rw.size bytes
+                                // ...
+                                cpl[i].size = n;
+                                break;
+
+                        case LOOP_CMD__DEVICE_STAT:
+                                cpl[i].size = 100; // device size
+                                break;
+
+                        default:
+                                break;
+                        }
+                }
+
+                LOOP_ring_complete_t complete = {.cpl = cpl, .count = fetch.count};
+                ioctl(fileno(loop_dev), IOCTL_LOOP__HOST_RING_COMPLETE, &complete);
+        }
+
+        // ...
+\endcode
+
 @{
 */
 
@@ -511,11 +586,39 @@ extern "C" {
  */
 #define IOCTL_LOOP__HOST_FLUSH_DONE             _IOW(LOOP, 0x07, int*)
 
+/**
+ * @brief  Host request. Set this program as Host that handle requests in the
+ *         ring mode.
+ *
+ * @return On success 0 is returned, otherwise -1.
+ */
+#define IOCTL_LOOP__HOST_RING_OPEN              _IO(LOOP, 0xFFF0)
+
+/**
+ * @brief  Host request. Fetch pending Client requests (ring mode).
+ *
+ * Request waits for at least one Client request. The <i>count</i> field is
+ * set to number of fetched requests.
+ *
+ * @param  [RD] @ref LOOP_ring_fetch_t*         fetch descriptor
+ * @return On success 0 is returned, otherwise -1.
+ */
+#define IOCTL_LOOP__HOST_RING_FETCH             _IOWR(LOOP, 0xFFF1, LOOP_ring_fetch_t*)
+
+/**
+ * @brief  Host request. Complete fetched Client requests (ring mode).
+ *
+ * @param  [WR] @ref LOOP_ring_complete_t*      completion descriptor
+ * @return On success 0 is returned, otherwise -1.
+ */
+#define IOCTL_LOOP__HOST_RING_COMPLETE          _IOW(LOOP, 0xFFF2, LOOP_ring_complete_t*)
+
 /**
  * @brief  Client request. General purpose RAW request. Depends on host protocol.
  *
  * By this request Client can send request from another device type.
  * In this case is not required to use @ref IOCTL_LOOP__CLIENT_REQUEST() macro.
+ * Request number should be lower than 0xFFE8 (host ring requests).
  *
  * @param  n                            request number (macro's argument)
  * @return Depends on host program protocol.
@@ -586,6 +689,56 @@ typedef struct {
 } LOOP_request_t;
 
 
+/**
+ * Type represent the request fetched in the ring mode.
+ */
+typedef struct {
+        u32_t      tag;                         /*!< Request tag (used in completion).*/
+        LOOP_cmd_t cmd;                         /*!< Requested action (command from Client).*/
+
+        union {
+                struct {
+                        u8_t  *data;            /*!< Client buffer (read or write directly).*/
+                        size_t size;            /*!< Requested size of read/write operation.*/
+                        fpos_t seek;            /*!< Position in the device's file.*/
+                } rw;                           /*!< Read/write transmission arguments group.*/
+
+                struct {
+                        int   request;          /*!< Ioctl's request number.*/
+                        void *arg;              /*!< Ioctl's request argument.*/
+                } ioctl;                        /*!< Ioctl argument group.*/
+        } arg;                                  /*!< Command's arguments.*/
+} LOOP_ring_request_t;
+
+
+/**
+ * Type represent the completion of request in the ring mode.
+ */
+typedef struct {
+        u32_t tag;                              /*!< Tag of fetched request.*/
+        int   err;                              /*!< Errno value if error occurred (if no error must be set to ESUCC).*/
+        u64_t size;                             /*!< Number of transferred bytes or device size (stat).*/
+} LOOP_ring_completion_t;
+
+
+/**
+ * Type represent the fetch descriptor of the ring mode.
+ */
+typedef struct {
+        LOOP_ring_request_t *rq;                /*!< Request buffer.*/
+        size_t               count;             /*!< Buffer capacity (in), number of fetched requests (out).*/
+} LOOP_ring_fetch_t;
+
+
+/**
+ * Type represent the completion descriptor of the ring mode.
+ */
+typedef struct {
+        const LOOP_ring_completion_t *cpl;      /*!< Completion buffer.*/
+        size_t                        count;    /*!< Number of completions.*/
+} LOOP_ring_complete_t;
+
+
 /*==============================================================================
   Exported objects
 ==============================================================================*/
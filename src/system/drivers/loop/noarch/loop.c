@@ -43,6 +43,7 @@
 
 #define FLAG_REQUEST            (1<<0)
 #define FLAG_RESPONSE           (1<<1)
+#define FLAG_SLOT(n)            (1<<(2 + (n)))
 
 /*==============================================================================
   Local object types
@@ -71,11 +72,27 @@ typedef struct {
 } req_t;
 
 
+typedef enum {
+        SLOT_FREE,
+        SLOT_PENDING,
+        SLOT_FETCHED,
+        SLOT_DONE
+} slot_state_t;
+
+typedef struct {
+        req_t        req;
+        slot_state_t state;
+} slot_t;
+
 typedef struct {
         mutex_t    *mtx;
         flag_t     *flag;
         dev_lock_t  host_lock;
         req_t       action;
+        bool        ring;
+        mutex_t    *ring_mtx;
+        sem_t      *ring_free;
+        slot_t      slot[_LOOP_RING_SLOTS];
 } loop_t;
 
 /*==============================================================================
@@ -85,6 +102,12 @@ static int submit_request(loop_t *hdl);
 static int submit_response(loop_t *hdl);
 static int wait_for_response(loop_t *hdl, u32_t timeout);
 static int wait_for_request(loop_t *hdl, u32_t timeout);
+static int ring_request(loop_t *hdl, req_t *req);
+static int ring_fetch(loop_t *hdl, LOOP_ring_fetch_t *fetch);
+static int ring_complete(loop_t *hdl, const LOOP_ring_complete_t *complete);
+static void ring_abort(loop_t *hdl);
+static bool ring_is_open(loop_t *hdl);
+static void ring_check_host(loop_t *hdl);
 
 /*==============================================================================
   Local objects
@@ -136,6 +159,16 @@ API_MOD_INIT(LOOP, void **device_handle, u8_t major, u8_t minor)
                         err = sys_flag_create(&hdl->flag);
                 }
 
+                if (!err) {
+                        err = sys_mutex_create(MUTEX_TYPE_NORMAL, &hdl->ring_mtx);
+                }
+
+                if (!err) {
+                        err = sys_semaphore_create(_LOOP_RING_SLOTS,
+                                                   _LOOP_RING_SLOTS,
+                                                   &hdl->ring_free);
+                }
+
                 if (err) {
                         if (hdl->mtx) {
                                 sys_mutex_destroy(hdl->mtx);
@@ -145,6 +178,10 @@ API_MOD_INIT(LOOP, void **device_handle, u8_t major, u8_t minor)
                                 sys_flag_destroy(hdl->flag);
                         }
 
+                        if (hdl->ring_mtx) {
+                                sys_mutex_destroy(hdl->ring_mtx);
+                        }
+
                         sys_free(device_handle);
                 }
         }
@@ -170,6 +207,8 @@ API_MOD_RELEASE(LOOP, void *device_handle)
                 mutex_t *mtx = hdl->mtx;
                 sys_mutex_unlock(mtx);
                 sys_mutex_destroy(mtx);
+                sys_mutex_destroy(hdl->ring_mtx);
+                sys_semaphore_destroy(hdl->ring_free);
                 sys_flag_destroy(hdl->flag);
                 sys_free(device_handle);
         }
@@ -239,6 +278,21 @@ API_MOD_WRITE(LOOP,
                 return ESRCH;
         }
 
+        if (ring_is_open(hdl)) {
+                req_t req;
+                req.cmd         = LOOP_CMD__TRANSMISSION_CLIENT2HOST;
+                req.arg.rw.data = const_cast(u8_t*, src);
+                req.arg.rw.size = count;
+                req.arg.rw.seek = *fpos;
+
+                int err = ring_request(hdl, &req);
+                if (!err) {
+                        *wrcnt = req.arg.rw.size;
+                }
+
+                return err;
+        }
+
         int err = sys_mutex_lock(hdl->mtx, OPERATION_TIMEOUT);
         if (!err) {
 
@@ -298,6 +352,21 @@ API_MOD_READ(LOOP,
                 return ESRCH;
         }
 
+        if (ring_is_open(hdl)) {
+                req_t req;
+                req.cmd         = LOOP_CMD__TRANSMISSION_HOST2CLIENT;
+                req.arg.rw.data = dst;
+                req.arg.rw.size = count;
+                req.arg.rw.seek = *fpos;
+
+                int err = ring_request(hdl, &req);
+                if (!err) {
+                        *rdcnt = req.arg.rw.size;
+                }
+
+                return err;
+        }
+
         int err = sys_mutex_lock(hdl->mtx, OPERATION_TIMEOUT);
         if (!err) {
 
@@ -382,11 +451,40 @@ API_MOD_IOCTL(LOOP, void *device_handle, int request, void *arg)
         case IOCTL_LOOP__HOST_CLOSE:
                 err = sys_device_get_access(&hdl->host_lock);
                 if (!err) {
+                        ring_abort(hdl);
+
                         sys_flag_clear(hdl->flag, FLAG_REQUEST | FLAG_RESPONSE);
                         sys_device_unlock(&hdl->host_lock, false);
                 }
                 break;
 
+        case IOCTL_LOOP__HOST_RING_OPEN:
+                err = sys_device_lock(&hdl->host_lock);
+                if (!err) {
+                        err = sys_mutex_lock(hdl->ring_mtx, OPERATION_TIMEOUT);
+                        if (!err) {
+                                hdl->ring = true;
+                                sys_mutex_unlock(hdl->ring_mtx);
+                        } else {
+                                sys_device_unlock(&hdl->host_lock, false);
+                        }
+                }
+                break;
+
+        case IOCTL_LOOP__HOST_RING_FETCH:
+                err = sys_device_get_access(&hdl->host_lock);
+                if (!err) {
+                        err = arg ? ring_fetch(hdl, arg) : EINVAL;
+                }
+                break;
+
+        case IOCTL_LOOP__HOST_RING_COMPLETE:
+                err = sys_device_get_access(&hdl->host_lock);
+                if (!err) {
+                        err = arg ? ring_complete(hdl, arg) : EINVAL;
+                }
+                break;
+
         case IOCTL_LOOP__HOST_WAIT_FOR_REQUEST:
                 err = sys_device_get_access(&hdl->host_lock);
                 if (arg && !err) {
@@ -494,7 +592,15 @@ API_MOD_IOCTL(LOOP, void *device_handle, int request, void *arg)
                 break;
 
         default: //IOCTL_LOOP__CLIENT_REQUEST(n)
-                if (sys_device_is_locked(&hdl->host_lock)) {
+                if (sys_device_is_locked(&hdl->host_lock) && ring_is_open(hdl)) {
+                        req_t req;
+                        req.cmd           = LOOP_CMD__IOCTL_REQUEST;
+                        req.arg.ioctl.arg = arg;
+                        req.arg.ioctl.rq  = request;
+
+                        err = ring_request(hdl, &req);
+
+                } else if (sys_device_is_locked(&hdl->host_lock)) {
                         hdl->action.cmd           = LOOP_CMD__IOCTL_REQUEST;
                         hdl->action.arg.ioctl.arg = arg;
                         hdl->action.arg.ioctl.rq  = request;
@@ -528,7 +634,13 @@ API_MOD_FLUSH(LOOP, void *device_handle)
         loop_t *hdl = device_handle;
         int     err = ESUCC;
 
-        if (sys_device_is_locked(&hdl->host_lock)) {
+        if (sys_device_is_locked(&hdl->host_lock) && ring_is_open(hdl)) {
+                req_t req;
+                req.cmd = LOOP_CMD__FLUSH_BUFFERS;
+
+                err = ring_request(hdl, &req);
+
+        } else if (sys_device_is_locked(&hdl->host_lock)) {
 
                 hdl->action.cmd = LOOP_CMD__FLUSH_BUFFERS;
                 submit_request(hdl);
@@ -561,7 +673,16 @@ API_MOD_STAT(LOOP, void *device_handle, struct vfs_dev_stat *device_stat)
 
         device_stat->st_size = 0;
 
-        if (sys_device_is_locked(&hdl->host_lock)) {
+        if (sys_device_is_locked(&hdl->host_lock) && ring_is_open(hdl)) {
+                req_t req;
+                req.cmd = LOOP_CMD__DEVICE_STAT;
+
+                err = ring_request(hdl, &req);
+                if (!err) {
+                        device_stat->st_size = req.arg.stat.size;
+                }
+
+        } else if (sys_device_is_locked(&hdl->host_lock)) {
 
                 hdl->action.cmd = LOOP_CMD__DEVICE_STAT;
                 submit_request(hdl);
@@ -639,6 +760,322 @@ static int wait_for_request(loop_t *hdl, u32_t timeout)
         return sys_flag_wait(hdl->flag, FLAG_REQUEST, timeout);
 }
 
+//==============================================================================
+/**
+ * @brief  Function put request to the free ring slot and wait for completion.
+ *         Any number of clients can wait at the same time (up to number of
+ *         slots). Request object is updated by completion results.
+ *
+ * @param  hdl          driver handle
+ * @param  req          request
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int ring_request(loop_t *hdl, req_t *req)
+{
+        int err = sys_semaphore_wait(hdl->ring_free, OPERATION_TIMEOUT);
+        if (err) {
+                return err;
+        }
+
+        err = sys_mutex_lock(hdl->ring_mtx, OPERATION_TIMEOUT);
+        if (err) {
+                sys_semaphore_signal(hdl->ring_free);
+                return err;
+        }
+
+        // host can close ring between ring_is_open() and request
+        if (!hdl->ring) {
+                sys_mutex_unlock(hdl->ring_mtx);
+                sys_semaphore_signal(hdl->ring_free);
+                return ESRCH;
+        }
+
+        size_t n = 0;
+        while ((n < ARRAY_SIZE(hdl->slot)) && (hdl->slot[n].state != SLOT_FREE)) {
+                n++;
+        }
+
+        if (n == ARRAY_SIZE(hdl->slot)) {
+                sys_mutex_unlock(hdl->ring_mtx);
+                sys_semaphore_signal(hdl->ring_free);
+                return EBUSY;
+        }
+
+        slot_t *slot = &hdl->slot[n];
+        slot->req    = *req;
+        slot->state  = SLOT_PENDING;
+        sys_flag_clear(hdl->flag, FLAG_SLOT(n));
+
+        sys_mutex_unlock(hdl->ring_mtx);
+
+        submit_request(hdl);
+
+        int waiterr = sys_flag_wait(hdl->flag, FLAG_SLOT(n), REQUEST_TIMEOUT);
+
+        // the host can complete the slot just after timeout, so state decides
+        sys_mutex_lock(hdl->ring_mtx, MAX_DELAY_MS);
+
+        // fetched request buffers are used by host (zero-copy), so request
+        // cannot be abandoned; it is finished by completion, host close, or
+        // when host process does not exist anymore
+        while (slot->state == SLOT_FETCHED) {
+                sys_mutex_unlock(hdl->ring_mtx);
+
+                if (sys_flag_wait(hdl->flag, FLAG_SLOT(n), REQUEST_TIMEOUT) != ESUCC) {
+                        ring_check_host(hdl);
+                }
+
+                sys_mutex_lock(hdl->ring_mtx, MAX_DELAY_MS);
+        }
+
+        switch (slot->state) {
+        case SLOT_DONE:
+                *req        = slot->req;
+                err         = slot->req.err;
+                slot->state = SLOT_FREE;
+                sys_semaphore_signal(hdl->ring_free);
+                break;
+
+        default:
+        case SLOT_PENDING:
+                slot->state = SLOT_FREE;
+                sys_semaphore_signal(hdl->ring_free);
+                err         = waiterr ? waiterr : ETIME;
+                break;
+        }
+
+        sys_mutex_unlock(hdl->ring_mtx);
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function move pending requests to the host. Function wait for
+ *         requests if there is no pending one.
+ *
+ * @param  hdl          driver handle
+ * @param  fetch        fetch descriptor
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int ring_fetch(loop_t *hdl, LOOP_ring_fetch_t *fetch)
+{
+        if (!fetch->rq || !fetch->count) {
+                return EINVAL;
+        }
+
+        int    err = ESUCC;
+        size_t cnt = 0;
+
+        while (!err && !cnt) {
+                err = sys_mutex_lock(hdl->ring_mtx, OPERATION_TIMEOUT);
+                if (err) {
+                        break;
+                }
+
+                if (!hdl->ring) {
+                        sys_mutex_unlock(hdl->ring_mtx);
+                        err = EINVAL;
+                        break;
+                }
+
+                for (size_t n = 0; n < ARRAY_SIZE(hdl->slot) && cnt < fetch->count; n++) {
+                        slot_t *slot = &hdl->slot[n];
+
+                        if (slot->state == SLOT_PENDING) {
+                                LOOP_ring_request_t *rq = &fetch->rq[cnt++];
+
+                                rq->tag = n;
+                                rq->cmd = slot->req.cmd;
+
+                                switch (rq->cmd) {
+                                case LOOP_CMD__TRANSMISSION_CLIENT2HOST:
+                                case LOOP_CMD__TRANSMISSION_HOST2CLIENT:
+                                        rq->arg.rw.data = slot->req.arg.rw.data;
+                                        rq->arg.rw.size = slot->req.arg.rw.size;
+                                        rq->arg.rw.seek = slot->req.arg.rw.seek;
+                                        break;
+
+                                case LOOP_CMD__IOCTL_REQUEST:
+                                        rq->arg.ioctl.request = slot->req.arg.ioctl.rq;
+                                        rq->arg.ioctl.arg     = slot->req.arg.ioctl.arg;
+                                        break;
+
+                                default:
+                                        break;
+                                }
+
+                                slot->state = SLOT_FETCHED;
+                        }
+                }
+
+                sys_mutex_unlock(hdl->ring_mtx);
+
+                if (!cnt) {
+                        err = wait_for_request(hdl, HOST_REQUEST_TIMEOUT);
+                }
+        }
+
+        fetch->count = cnt;
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function complete batch of fetched requests. All waiting clients
+ *         are resumed at once.
+ *
+ * @param  hdl          driver handle
+ * @param  complete     completion descriptor
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int ring_complete(loop_t *hdl, const LOOP_ring_complete_t *complete)
+{
+        if (!complete->cpl) {
+                return EINVAL;
+        }
+
+        int err = sys_mutex_lock(hdl->ring_mtx, OPERATION_TIMEOUT);
+        if (!err) {
+                u32_t mask = 0;
+
+                if (!hdl->ring) {
+                        err = EINVAL;
+                }
+
+                for (size_t i = 0; hdl->ring && (i < complete->count); i++) {
+                        const LOOP_ring_completion_t *cpl = &complete->cpl[i];
+
+                        if (cpl->tag >= ARRAY_SIZE(hdl->slot)) {
+                                err = EINVAL;
+                                continue;
+                        }
+
+                        slot_t *slot = &hdl->slot[cpl->tag];
+
+                        if (slot->state == SLOT_FETCHED) {
+                                slot->req.err = cpl->err;
+
+                                switch (slot->req.cmd) {
+                                case LOOP_CMD__TRANSMISSION_CLIENT2HOST:
+                                case LOOP_CMD__TRANSMISSION_HOST2CLIENT:
+                                        slot->req.arg.rw.size = min(slot->req.arg.rw.size,
+                                                                    cpl->size);
+                                        break;
+
+                                case LOOP_CMD__DEVICE_STAT:
+                                        slot->req.arg.stat.size = cpl->size;
+                                        break;
+
+                                default:
+                                        break;
+                                }
+
+                                slot->state = SLOT_DONE;
+                                mask |= FLAG_SLOT(cpl->tag);
+
+                        } else {
+                                err = EINVAL;
+                        }
+                }
+
+                if (mask) {
+                        sys_flag_set(hdl->flag, mask);
+                }
+
+                sys_mutex_unlock(hdl->ring_mtx);
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function finish all ring requests when host is closed.
+ *
+ * @param  hdl          driver handle
+ */
+//==============================================================================
+static void ring_abort(loop_t *hdl)
+{
+        sys_mutex_lock(hdl->ring_mtx, MAX_DELAY_MS);
+
+        u32_t mask = 0;
+
+        for (size_t n = 0; n < ARRAY_SIZE(hdl->slot); n++) {
+                slot_t *slot = &hdl->slot[n];
+
+                if (slot->state == SLOT_PENDING || slot->state == SLOT_FETCHED) {
+                        slot->req.err = ESRCH;
+                        slot->state   = SLOT_DONE;
+                        mask |= FLAG_SLOT(n);
+                }
+        }
+
+        hdl->ring = false;
+
+        if (mask) {
+                sys_flag_set(hdl->flag, mask);
+        }
+
+        sys_mutex_unlock(hdl->ring_mtx);
+}
+
+//==============================================================================
+/**
+ * @brief  Function check if host serves requests by ring.
+ *
+ * @param  hdl          driver handle
+ *
+ * @return True if ring is open.
+ */
+//==============================================================================
+static bool ring_is_open(loop_t *hdl)
+{
+        bool open = false;
+
+        if (sys_mutex_lock(hdl->ring_mtx, OPERATION_TIMEOUT) == ESUCC) {
+                open = hdl->ring;
+                sys_mutex_unlock(hdl->ring_mtx);
+        }
+
+        return open;
+}
+
+//==============================================================================
+/**
+ * @brief  Function finish ring requests if host process was killed (killed
+ *         host does not send HOST_CLOSE request). Threads of finished
+ *         process do not exist, so client buffers are not used anymore.
+ *
+ * @param  hdl          driver handle
+ */
+//==============================================================================
+static void ring_check_host(loop_t *hdl)
+{
+        pid_t          host = hdl->host_lock;
+        process_stat_t stat;
+
+        if (  (sys_process_get_stat_pid(host, &stat) != ESUCC)
+           || stat.zombie ) {
+
+                ring_abort(hdl);
+
+                sys_flag_clear(hdl->flag, FLAG_REQUEST | FLAG_RESPONSE);
+
+                if (hdl->host_lock == host) {
+                        sys_device_unlock(&hdl->host_lock, true);
+                }
+        }
+}
+
 /*==============================================================================
   End of file
 ==============================================================================*/
@@ -40,6 +40,8 @@ extern "C" {
 /*==============================================================================
   Exported macros
 ==============================================================================*/
+/* number of request ring slots (requests in flight) */
+#define _LOOP_RING_SLOTS                __LOOP_RING_SLOTS__
 
 /*==============================================================================
   Exported object types
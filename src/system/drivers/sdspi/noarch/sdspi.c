@@ -39,6 +39,8 @@
 /*==============================================================================
   Local symbolic constants/macros
 ==============================================================================*/
+#define READY_PROBE_LEN         8       /* bytes received in single readiness probe */
+#define READY_FAST_PROBES       4       /* probes without sleep, next are delayed by 1 ms */
 
 /*==============================================================================
   Local types, enums definitions
@@ -545,7 +547,10 @@ static int SPI_receive_block(SDSPI_t *hdl, u8_t *block, size_t count)
 
 //==============================================================================
 /**
- * @brief Function wait for card ready
+ * @brief Function wait for card ready. Card is probed by several bytes in
+ *        single transfer. Card keeps DO line high when is not busy, so
+ *        additional bytes do not affect card state. Long busy state (e.g.
+ *        sector programming) is probed every 1 ms to release the CPU and bus.
  *
  * @param[in] hdl       partition handler
  *
@@ -554,13 +559,26 @@ static int SPI_receive_block(SDSPI_t *hdl, u8_t *block, size_t count)
 //==============================================================================
 static u8_t card_wait_ready(SDSPI_t *hdl)
 {
-        u8_t response;
-        u32_t timer = sys_time_get_reference();
+        u8_t  probe[READY_PROBE_LEN];
+        u32_t timer  = sys_time_get_reference();
+        int   probes = 0;
 
-        while ((response = SPI_transive(hdl, 0xFF)) != 0xFF
-              && !sys_time_is_expired(timer, hdl->stg->timeout_ms));
+        for (;;) {
+                if (SPI_receive_block(hdl, probe, sizeof(probe)) != ESUCC) {
+                        return 0x00;
+                }
 
-        return response;
+                if (  probe[sizeof(probe) - 1] == 0xFF
+                   || sys_time_is_expired(timer, hdl->stg->timeout_ms)) {
+                        break;
+                }
+
+                if (++probes >= READY_FAST_PROBES) {
+                        sys_sleep_ms(1);
+                }
+        }
+
+        return probe[sizeof(probe) - 1];
 }
 
 //==============================================================================
@@ -626,7 +644,9 @@ static u8_t card_send_cmd(SDSPI_t *hdl, SD_cmd_t cmd, u32_t arg)
 
 //==============================================================================
 /**
- * @brief Function receive data block
+ * @brief Function receive data block. Data token is searched in several bytes
+ *        received in single transfer. Bytes received after token are the
+ *        beginning of data block. Slow card is probed every 1 ms.
  *
  * @param[in]   hdl             partition handler
  * @param[out]  buff            data buffer (sector size)
@@ -637,23 +657,53 @@ static u8_t card_send_cmd(SDSPI_t *hdl, SD_cmd_t cmd, u32_t arg)
 //==============================================================================
 static bool card_receive_data_block(SDSPI_t *hdl, u8_t *buff)
 {
-        u8_t token;
-        u32_t timer = sys_time_get_reference();
-        while ((token = SPI_transive(hdl, 0xFF)) == 0xFF
-              && !sys_time_is_expired(timer, hdl->stg->timeout_ms));
+        u8_t   probe[READY_PROBE_LEN];
+        size_t pos    = sizeof(probe);
+        u32_t  timer  = sys_time_get_reference();
+        int    probes = 0;
 
-        if (token != 0xFE) {
-                return false;
-        }
+        while (pos == sizeof(probe)) {
+                if (SPI_receive_block(hdl, probe, sizeof(probe)) != ESUCC) {
+                        return false;
+                }
 
-        /* block send */
-        SPI_receive_block(hdl, buff, SECTOR_SIZE);
+                for (pos = 0; pos < sizeof(probe) && probe[pos] == 0xFF; pos++);
 
-        /* discard CRC */
-        u8_t crc[2];
-        SPI_receive_block(hdl, crc, 2);
+                if (pos == sizeof(probe)) {
+                        if (sys_time_is_expired(timer, hdl->stg->timeout_ms)) {
+                                return false;
+                        }
 
-        return true;
+                        if (++probes >= READY_FAST_PROBES) {
+                                sys_sleep_ms(1);
+                        }
+                }
+        }
+
+        if (probe[pos] != 0xFE) {
+                return false;
+        }
+
+        /* beginning of block received with token */
+        size_t head = sizeof(probe) - (pos + 1);
+        memcpy(buff, &probe[pos + 1], head);
+
+        /* rest of block and discarded CRC in single request */
+        SPI_transceive_t crc;
+        crc.tx_buffer = NULL;
+        crc.rx_buffer = NULL;
+        crc.count     = 2;
+        crc.separated = false;
+        crc.next      = NULL;
+
+        SPI_transceive_t data;
+        data.tx_buffer = NULL;
+        data.rx_buffer = buff + head;
+        data.count     = SECTOR_SIZE - head;
+        data.separated = false;
+        data.next      = &crc;
+
+        return sys_ioctl(hdl->stg->SPI_file, IOCTL_SPI__TRANSCEIVE, &data) == ESUCC;
 }
 
 //==============================================================================
@@ -674,13 +724,37 @@ static bool card_transmit_data_block(SDSPI_t *hdl, const u8_t *buff, u8_t token)
                 return false;
         }
 
-        SPI_transive(hdl, token);
+        if (token == 0xFD) {
+                SPI_transive(hdl, token);
 
-        if (token != 0xFD) {
+        } else {
+                /* token, block, dummy CRC, and response in single request */
                 u8_t dummy_crc_and_response[3];
 
-                SPI_transmit_block(hdl, buff, SECTOR_SIZE);
-                SPI_receive_block(hdl, dummy_crc_and_response, 3);
+                SPI_transceive_t resp;
+                resp.tx_buffer = NULL;
+                resp.rx_buffer = dummy_crc_and_response;
+                resp.count     = sizeof(dummy_crc_and_response);
+                resp.separated = false;
+                resp.next      = NULL;
+
+                SPI_transceive_t data;
+                data.tx_buffer = buff;
+                data.rx_buffer = NULL;
+                data.count     = SECTOR_SIZE;
+                data.separated = false;
+                data.next      = &resp;
+
+                SPI_transceive_t tok;
+                tok.tx_buffer = &token;
+                tok.rx_buffer = NULL;
+                tok.count     = 1;
+                tok.separated = false;
+                tok.next      = &data;
+
+                if (sys_ioctl(hdl->stg->SPI_file, IOCTL_SPI__TRANSCEIVE, &tok) != ESUCC) {
+                        return false;
+                }
 
                 if ((dummy_crc_and_response[2] & 0x1F) != 0x05) {
                         return false;
@@ -758,12 +832,14 @@ static ssize_t card_read_partial_sectors(SDSPI_t *hdl, u8_t *dst, size_t size, u
         u32_t recv_data = 0;
         while (recv_data < size) {
                 if (lseek % SECTOR_SIZE == 0 && (size - recv_data) / SECTOR_SIZE > 0) {
-                        ssize_t n = card_read_entire_sectors(hdl, dst, size / SECTOR_SIZE, lseek);
+                        ssize_t nsectors = (size - recv_data) / SECTOR_SIZE;
+                        ssize_t n = card_read_entire_sectors(hdl, dst, nsectors, lseek);
                         if (n == -1) {
                                 recv_data = -1;
                                 goto exit;
 
-                        } else if (n != cast(ssize_t, size) / SECTOR_SIZE) {
+                        } else if (n != nsectors) {
+                                recv_data += n * SECTOR_SIZE;
                                 break;
                         }
 
@@ -874,12 +950,14 @@ static ssize_t card_write_partial_sectors(SDSPI_t *hdl, const u8_t *src, size_t
         u32_t transmit_data = 0;
         while (transmit_data < size) {
                 if (lseek % SECTOR_SIZE == 0 && (size - transmit_data) / SECTOR_SIZE > 0) {
-                        ssize_t n = card_write_entire_sectors(hdl, src, size / SECTOR_SIZE, lseek);
+                        ssize_t nsectors = (size - transmit_data) / SECTOR_SIZE;
+                        ssize_t n = card_write_entire_sectors(hdl, src, nsectors, lseek);
                         if (n == -1) {
                                 transmit_data = -1;
                                 goto exit;
 
-                        } else if (n != cast(ssize_t, size) / SECTOR_SIZE) {
+                        } else if (n != nsectors) {
+                                transmit_data += n * SECTOR_SIZE;
                                 break;
                         }
 
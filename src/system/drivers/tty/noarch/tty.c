@@ -485,6 +485,17 @@ API_MOD_IOCTL(TTY, void *device_handle, int request, void *arg)
                 err = ESUCC;
                 break;
 
+        case IOCTL_VFS__POLL:
+                if (arg) {
+                        sys_poll_watch(tty->queue_out);
+
+                        size_t items = 0;
+                        sys_queue_get_number_of_items(tty->queue_out, &items);
+                        *cast(int*, arg) = POLLOUT | (items ? POLLIN : 0);
+                        err = ESUCC;
+                }
+                break;
+
         default:
                 err = EBADRQC;
                 break;
@@ -827,6 +838,8 @@ static void copy_string_to_queue(const char *str, queue_t *queue, bool lfend, ui
                 const char lf = '\n';
                 sys_queue_send(queue, &lf, timeout);
         }
+
+        sys_poll_notify(queue);
 }
 
 //==============================================================================
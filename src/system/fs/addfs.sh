@@ -84,6 +84,9 @@ function create_registration_file()
         echo '    extern API_FS_OPENDIR('$fs', void*, const char*, struct vfs_dir*);'
         echo '    extern API_FS_CLOSEDIR('$fs', void*, struct vfs_dir*);'
         echo '    extern API_FS_READDIR('$fs', void*, struct vfs_dir*);'
+        echo '    extern API_FS_WRITEV('$fs', void*, void*, const struct iovec*, int, fpos_t*, size_t*, struct vfs_fattr) __attribute__((weak));'
+        echo '    extern API_FS_READV('$fs', void*, void*, const struct iovec*, int, fpos_t*, size_t*, struct vfs_fattr) __attribute__((weak));'
+        echo '    extern API_FS_READDIR_BULK('$fs', void*, struct vfs_dir*, void*, size_t, int, size_t*) __attribute__((weak));'
         echo '  #if __OS_ENABLE_MKDIR__ == _YES_'
         echo '    extern API_FS_STAT('$fs', void*, const char*, struct stat*);'
         echo '  #endif'
@@ -130,6 +133,9 @@ function create_registration_file()
         echo '                 .fs_opendir = _'$fs'_opendir,'
         echo '                 .fs_closedir= _'$fs'_closedir,'
         echo '                 .fs_readdir = _'$fs'_readdir,'
+        echo '                 .fs_writev  = _'$fs'_writev,'
+        echo '                 .fs_readv   = _'$fs'_readv,'
+        echo '                 .fs_readdir_bulk = _'$fs'_readdir_bulk,'
         echo '               #if __OS_ENABLE_FSTAT__ == _YES_'
         echo '                 .fs_stat    = _'$fs'_stat,'
         echo '               #endif'
@@ -64,6 +64,11 @@ Brief    EEPROM File System. File system for small memories 1-64KiB EEPROM.
 
 #define NAME_LEN                        21      // note: modify with care
 
+#define CHAIN_INDEX_SIZE                8
+#define CHAIN_INDEX_STRIDE              16
+
+#define WRSET_SIZE                      4
+
 #define cache_get_block(sys_cache)      cast(block_cached_t*, &sys_cache[1])->block
 #define cache_get_block_num(sys_cache)  cast(block_cached_t*, &sys_cache[1])->block_num
 
@@ -230,6 +235,9 @@ typedef struct file_desc {
         struct file_desc *next;
         uint32_t          magic;
         uint16_t          block_num;
+        uint16_t          chain_blk;                    //!< last used chain block
+        uint16_t          chain_pos;                    //!< last used chain position
+        uint16_t          chain_idx[CHAIN_INDEX_SIZE];  //!< chain at each CHAIN_INDEX_STRIDE position
         uint8_t           flags;
 } file_desc_t;
 
@@ -252,6 +260,14 @@ typedef struct {
         uint16_t     root_dir_block;
         block_buf_t  block;
         block_buf_t  tmpblock;
+        u32_t       *bmp;               //!< block bitmap loaded at mount (1: free block)
+        u16_t        blocks;            //!< number of blocks
+        u16_t        bmp_used;          //!< number of used blocks
+        u16_t        bmp_cursor;        //!< next-fit allocation cursor
+        u8_t         bmp_blocks;        //!< number of additional bitmap blocks
+        block_t      wrset_buf[WRSET_SIZE];     //!< blocks modified by current operation
+        u16_t        wrset_num[WRSET_SIZE];     //!< numbers of modified blocks
+        u8_t         wrset_cnt;                 //!< number of modified blocks
         u8_t         flag;
 } EEFS_t;
 
@@ -261,11 +277,14 @@ typedef struct {
 static uint16_t fletcher16(uint8_t const *data, size_t bytes);
 static int block_read(EEFS_t *hdl, block_buf_t *blk);
 static int block_write(EEFS_t *hdl, block_buf_t *blk);
+static int block_commit(EEFS_t *hdl, int err);
 static bool is_entry_item_used(dir_entry_t *entry);
 static tfile_t eefs2vfs_file_type(uint8_t eefs_file_type);
 static int block_load(EEFS_t *hdl, const char *path);
 static int block_load_by_type(EEFS_t *hdl, const char *path, uint32_t type);
 static int block_get_file_stat(EEFS_t *hdl, struct stat *stat);
+static int bmp_load(EEFS_t *hdl);
+static int bmp_write_back(EEFS_t *hdl, uint16_t bmpidx);
 static int bmp_block_find_empty(EEFS_t *hdl, uint16_t *blknum);
 static int bmp_block_alloc_ctrl(EEFS_t *hdl, uint16_t blknum, bool allocate);
 static int bmp_block_alloc(EEFS_t *hdl, uint16_t blknum);
@@ -284,8 +303,12 @@ static int dir_get_size(EEFS_t *hdl, u16_t *dirsize);
 static int dir_read_entry(EEFS_t *hdl, dir_desc_t *dd, dir_entry_t *eefs_entry, dirent_t *dirent);
 static int file_truncate(EEFS_t *hdl);
 static int file_add_chain(EEFS_t *hdl);
-static int file_write(EEFS_t *hdl, const u8_t *src, size_t count, fpos_t *fpos, size_t *wrcnt);
-static int file_read(EEFS_t *hdl, u8_t *dst, size_t count, fpos_t *fpos, size_t *rdcnt);
+static void file_chain_reset(EEFS_t *hdl, u16_t blknum);
+static void file_get_chain_pos(fpos_t fpos, u16_t *chainpos, u16_t *blkseek);
+static int file_next_chain(EEFS_t *hdl, file_desc_t *fd, bool alloc);
+static int file_load_chain(EEFS_t *hdl, file_desc_t *fd, u16_t chainpos, bool alloc);
+static int file_write(EEFS_t *hdl, file_desc_t *fd, const u8_t *src, size_t count, fpos_t *fpos, size_t *wrcnt);
+static int file_read(EEFS_t *hdl, file_desc_t *fd, u8_t *dst, size_t count, fpos_t *fpos, size_t *rdcnt);
 
 /*==============================================================================
   Local object definitions
@@ -331,6 +354,11 @@ API_FS_INIT(eefs, void **fs_handle, const char *src_path, const char *opts)
 
                                 hdl->root_dir_block = 1 + hdl->block.buf.main.bitmap_blocks;
 
+                                err = bmp_load(hdl);
+                                if (err) {
+                                        goto finish;
+                                }
+
                                 if (!isstrempty(opts)) {
                                         if (sys_stropt_is_flag(opts, "sync")) {
                                                 hdl->flag |= FLAG_SYNC;
@@ -359,6 +387,10 @@ API_FS_INIT(eefs, void **fs_handle, const char *src_path, const char *opts)
                                 sys_mutex_destroy(hdl->lock_mtx);
                         }
 
+                        if (hdl->bmp) {
+                                sys_free(cast(void*, &hdl->bmp));
+                        }
+
                         sys_free(fs_handle);
                 }
         }
@@ -385,6 +417,7 @@ API_FS_RELEASE(eefs, void *fs_handle)
 
                         sys_cache_drop(hdl->srcdev);
                         sys_fclose(hdl->srcdev);
+                        sys_free(cast(void*, &hdl->bmp));
 
                         mutex_t *mtx = hdl->lock_mtx;
 
@@ -430,6 +463,7 @@ API_FS_MKNOD(eefs, void *fs_handle, const char *path, const dev_t dev)
                         err = block_write(hdl, &hdl->block);
                 }
 
+                err = block_commit(hdl, err);
                 sys_mutex_unlock(hdl->lock_mtx);
         }
 
@@ -462,6 +496,7 @@ API_FS_MKDIR(eefs, void *fs_handle, const char *path, mode_t mode)
                         err = block_write(hdl, &hdl->block);
                 }
 
+                err = block_commit(hdl, err);
                 sys_mutex_unlock(hdl->lock_mtx);
         }
 
@@ -681,6 +716,7 @@ API_FS_REMOVE(eefs, void *fs_handle, const char *path)
 
                 err = dir_rm_entry(hdl, path);
 
+                err = block_commit(hdl, err);
                 sys_mutex_unlock(hdl->lock_mtx);
         }
 
@@ -774,6 +810,7 @@ API_FS_RENAME(eefs, void *fs_handle, const char *old_name, const char *new_name)
                         sys_free(cast(void*, &dirnamenew));
                 }
 
+                err = block_commit(hdl, err);
                 sys_mutex_unlock(hdl->lock_mtx);
         }
 
@@ -825,6 +862,7 @@ API_FS_CHMOD(eefs, void *fs_handle, const char *path, mode_t mode)
                         }
                 }
 
+                err = block_commit(hdl, err);
                 sys_mutex_unlock(hdl->lock_mtx);
         }
 
@@ -880,6 +918,7 @@ API_FS_CHOWN(eefs, void *fs_handle, const char *path, uid_t owner, gid_t group)
                         }
                 }
 
+                err = block_commit(hdl, err);
                 sys_mutex_unlock(hdl->lock_mtx);
         }
 
@@ -980,17 +1019,12 @@ API_FS_STATFS(eefs, void *fs_handle, struct statfs *statfs)
 
         int err = sys_mutex_lock(hdl->lock_mtx, BUSY_TIMEOUT);
         if (!err) {
+                statfs->f_blocks = hdl->blocks;
 
-                hdl->block.num = 0;
-                err = block_read(hdl, &hdl->block);
+                u16_t blkused = 0;
+                err = bmp_get_used_blocks(hdl, &blkused);
                 if (!err) {
-                        statfs->f_blocks = hdl->block.buf.main.blocks;
-
-                        u16_t blkused = 0;
-                        err = bmp_get_used_blocks(hdl, &blkused);
-                        if (!err) {
-                                statfs->f_bfree = statfs->f_blocks - blkused;
-                        }
+                        statfs->f_bfree = statfs->f_blocks - blkused;
                 }
 
                 sys_mutex_unlock(hdl->lock_mtx);
@@ -1041,6 +1075,7 @@ API_FS_OPEN(eefs, void *fs_handle, void **fhdl, fpos_t *fpos, const char *path,
 
                                         if (flags & O_TRUNC) {
                                                 err = file_truncate(hdl);
+                                                file_chain_reset(hdl, hdl->block.num);
                                         }
 
                                         if (!err) {
@@ -1056,6 +1091,7 @@ API_FS_OPEN(eefs, void *fs_handle, void **fhdl, fpos_t *fpos, const char *path,
                                         }
 
                                         if (!err) {
+                                                memset(fd, 0, sizeof(file_desc_t));
                                                 fd->block_num   = hdl->block.num;
                                                 fd->magic       = FILE_DESC_MAGIC;
                                                 fd->flags       = flags;
@@ -1073,6 +1109,7 @@ API_FS_OPEN(eefs, void *fs_handle, void **fhdl, fpos_t *fpos, const char *path,
                         }
                 }
 
+                err = block_commit(hdl, err);
                 sys_mutex_unlock(hdl->lock_mtx);
         }
 
@@ -1203,7 +1240,8 @@ API_FS_WRITE(eefs,
                                 goto finish;
 
                         } else if (block_is_file(hdl->block)) {
-                                err = file_write(hdl, src, count, fpos, wrcnt);
+                                err = file_write(hdl, fd, src, count, fpos, wrcnt);
+                                err = block_commit(hdl, err);
 
                         } else {
                                 err = EILSEQ;
@@ -1266,7 +1304,7 @@ API_FS_READ(eefs,
                                 goto finish;
 
                         } else if (block_is_file(hdl->block)) {
-                                err = file_read(hdl, dst, count, fpos, rdcnt);
+                                err = file_read(hdl, fd, dst, count, fpos, rdcnt);
 
                         } else {
                                 err = EILSEQ;
@@ -1430,6 +1468,13 @@ static uint16_t fletcher16(uint8_t const *data, size_t bytes)
 //==============================================================================
 static int block_read(EEFS_t *hdl, block_buf_t *blk)
 {
+        for (u8_t i = 0; i < hdl->wrset_cnt; i++) {
+                if (hdl->wrset_num[i] == blk->num) {
+                        memcpy(&blk->buf, &hdl->wrset_buf[i], sizeof(block_t));
+                        return ESUCC;
+                }
+        }
+
         memset(&blk->buf, 0, 128);
 
         int err = sys_cache_read(hdl->srcdev, blk->num, sizeof(block_t), 1,
@@ -1451,7 +1496,9 @@ static int block_read(EEFS_t *hdl, block_buf_t *blk)
 
 //==============================================================================
 /**
- * @brief Function write block to memory. Function uses caching subsystem.
+ * @brief Function write block to memory. Block is stored in the write set of
+ *        current operation and is written to medium by block_commit(). Next
+ *        writes of the same block only update the write set.
  *
  * @param  hdl          FS handle.
  * @param  blk          block to write.
@@ -1463,17 +1510,86 @@ static int block_write(EEFS_t *hdl, block_buf_t *blk)
 {
         if (hdl->flag & FLAG_RDONLY) {
                 return EROFS;
+        }
 
-        } else {
-                blk->buf.chsum.checksum = fletcher16(blk->buf.chsum.buf,
-                                                     sizeof(blk->buf.chsum.buf))
-                                        ^ blk->num;
+        u8_t i = 0;
+        while ((i < hdl->wrset_cnt) && (hdl->wrset_num[i] != blk->num)) {
+                i++;
+        }
 
-                return sys_cache_write(hdl->srcdev, blk->num, sizeof(block_t), 1,
-                                       cast(u8_t*, &blk->buf),
-                                       hdl->flag & FLAG_SYNC ? CACHE_WRITE_THROUGH
-                                                             : CACHE_WRITE_BACK);
+        if (i == hdl->wrset_cnt) {
+                if (i == WRSET_SIZE) {
+                        int err = block_commit(hdl, ESUCC);
+                        if (err) {
+                                return err;
+                        }
+
+                        i = 0;
+                }
+
+                hdl->wrset_num[i] = blk->num;
+                hdl->wrset_cnt++;
         }
+
+        memcpy(&hdl->wrset_buf[i], &blk->buf, sizeof(block_t));
+
+        return ESUCC;
+}
+
+//==============================================================================
+/**
+ * @brief Function write blocks from write set to memory. Blocks are sorted
+ *        and continuous blocks are written in single request, so EEPROM is
+ *        programmed in page aligned bursts. Function uses caching subsystem.
+ *
+ * @param  hdl          FS handle.
+ * @param  err          status of operation.
+ *
+ * @return Status of operation if failed, otherwise one of errno value.
+ */
+//==============================================================================
+static int block_commit(EEFS_t *hdl, int err)
+{
+        u8_t     cnt = hdl->wrset_cnt;
+        u16_t   *num = hdl->wrset_num;
+        block_t *buf = hdl->wrset_buf;
+
+        for (u8_t i = 1; i < cnt; i++) {
+                for (u8_t j = i; (j > 0) && (num[j - 1] > num[j]); j--) {
+                        u16_t n = num[j]; num[j] = num[j - 1]; num[j - 1] = n;
+
+                        u8_t *a = cast(u8_t*, &buf[j]);
+                        u8_t *b = cast(u8_t*, &buf[j - 1]);
+                        for (size_t k = 0; k < sizeof(block_t); k++) {
+                                u8_t t = a[k]; a[k] = b[k]; b[k] = t;
+                        }
+                }
+        }
+
+        for (u8_t i = 0; i < cnt; i++) {
+                buf[i].chsum.checksum = fletcher16(buf[i].chsum.buf,
+                                                   sizeof(buf[i].chsum.buf))
+                                      ^ num[i];
+        }
+
+        for (u8_t i = 0, run = 1; i < cnt; i += run) {
+                run = 1;
+                while ((i + run < cnt) && (num[i + run] == num[i] + run)) {
+                        run++;
+                }
+
+                int wrerr = sys_cache_write(hdl->srcdev, num[i], sizeof(block_t), run,
+                                            cast(u8_t*, &buf[i]),
+                                            hdl->flag & FLAG_SYNC ? CACHE_WRITE_THROUGH
+                                                                  : CACHE_WRITE_BACK);
+                if (!err) {
+                        err = wrerr;
+                }
+        }
+
+        hdl->wrset_cnt = 0;
+
+        return err;
 }
 
 //==============================================================================
@@ -1702,72 +1818,167 @@ static int block_get_file_stat(EEFS_t *hdl, struct stat *stat)
 
 //==============================================================================
 /**
- * @brief  Function find empty block by using bitmap.
+ * @brief  Function load block bitmap to RAM. Main block must be loaded in the
+ *         current block.
  *
  * @param  hdl          EEFS handle
- * @param  blknum       found empty block
  *
  * @return One of errno value.
  */
 //==============================================================================
-static int bmp_block_find_empty(EEFS_t *hdl, uint16_t *blknum)
+static int bmp_load(EEFS_t *hdl)
 {
-        hdl->tmpblock.num = MAIN_BLOCK_ADDR;
-        int err = block_read(hdl, &hdl->tmpblock);
+        hdl->blocks     = hdl->block.buf.main.blocks;
+        hdl->bmp_blocks = hdl->block.buf.main.bitmap_blocks;
+
+        size_t bytes = (hdl->blocks + 7) / 8;
+
+        if (bytes > (  sizeof(hdl->block.buf.main.bitmap)
+                    + (hdl->bmp_blocks * sizeof(hdl->block.buf.bitmap.map)))) {
+                return EMEDIUMTYPE;
+        }
+
+        int err = sys_zalloc(((hdl->blocks + 31) / 32) * sizeof(u32_t),
+                             cast(void*, &hdl->bmp));
+        if (err) {
+                return err;
+        }
+
+        u8_t  *bmp  = cast(u8_t*, hdl->bmp);
+        size_t len  = min(bytes, sizeof(hdl->block.buf.main.bitmap));
+        size_t done = len;
+
+        memcpy(bmp, hdl->block.buf.main.bitmap, len);
+
+        for (u8_t blk = 1; !err && (blk <= hdl->bmp_blocks) && (done < bytes); blk++) {
+
+                hdl->tmpblock.num = blk;
+                err = block_read(hdl, &hdl->tmpblock);
+                if (!err) {
+                        if (hdl->tmpblock.buf.bitmap.magic == BLOCK_MAGIC_BITMAP) {
+                                len = min(bytes - done, sizeof(hdl->tmpblock.buf.bitmap.map));
+                                memcpy(&bmp[done], hdl->tmpblock.buf.bitmap.map, len);
+                                done += len;
+                        } else {
+                                DBG("Invalid bitmap block");
+                                err = EILSEQ;
+                        }
+                }
+        }
+
         if (!err) {
+                // blocks out of medium are marked as used
+                if (hdl->blocks % 8) {
+                        bmp[bytes - 1] &= (1 << (hdl->blocks % 8)) - 1;
+                }
 
-                if (hdl->tmpblock.buf.main.magic != BLOCK_MAGIC_MAIN) {
-                        err = EILSEQ;
-                        goto finish;
+                u16_t free = 0;
+                for (size_t i = 0; i < bytes; i++) {
+                        for (u8_t b = bmp[i]; b; b &= b - 1) {
+                                free++;
+                        }
                 }
 
-                uint16_t blks    = hdl->tmpblock.buf.main.blocks;
-                uint16_t bmpblks = hdl->tmpblock.buf.main.bitmap_blocks;
-                uint8_t *bmp     = hdl->tmpblock.buf.main.bitmap;
-                uint8_t  bsz     = sizeof(hdl->tmpblock.buf.main.bitmap);
-                uint8_t  bmpnext = 1;
+                hdl->bmp_used   = hdl->blocks - free;
+                hdl->bmp_cursor = hdl->root_dir_block;
 
-                *blknum = 0;
+        } else {
+                sys_free(cast(void*, &hdl->bmp));
+        }
 
-                do {
-                        for (u8_t i = 0; i < bsz && blks > 0; i++, blks -= 8) {
-                                if (bmp[i] == 0) {
-                                        continue;
-                                }
+        return err;
+}
 
-                                for (u8_t bit = 0; bit < 8; bit++) {
-                                        if ((bmp[i] >> bit) & 1) {
-                                                *blknum += (i * 8) + bit;
-                                                goto finish;
-                                        }
-                                }
-                        }
+//==============================================================================
+/**
+ * @brief  Function write to medium bitmap block that contains selected byte
+ *         of RAM bitmap. Only modified bitmap block is written.
+ *
+ * @param  hdl          EEFS handle
+ * @param  bmpidx       modified byte of bitmap
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int bmp_write_back(EEFS_t *hdl, uint16_t bmpidx)
+{
+        block_buf_t blk;
+        memset(&blk.buf, 0, sizeof(blk.buf));
+
+        const u8_t *bmp   = cast(u8_t*, hdl->bmp);
+        size_t      bytes = (hdl->blocks + 7) / 8;
+        u8_t       *map;
+        size_t      size;
+        size_t      offset;
+
+        if (bmpidx < sizeof(blk.buf.main.bitmap)) {
+                blk.num                     = MAIN_BLOCK_ADDR;
+                blk.buf.main.magic          = BLOCK_MAGIC_MAIN;
+                blk.buf.main.blocks         = hdl->blocks;
+                blk.buf.main.bitmap_blocks  = hdl->bmp_blocks;
+                map    = blk.buf.main.bitmap;
+                size   = sizeof(blk.buf.main.bitmap);
+                offset = 0;
 
-                        if (bmpblks && blks > 0) {
-                                *blknum += (bsz * 8);
+        } else {
+                u16_t n = (bmpidx - sizeof(blk.buf.main.bitmap))
+                        / sizeof(blk.buf.bitmap.map);
 
-                                hdl->tmpblock.num = bmpnext;
-                                err = block_read(hdl, &hdl->tmpblock);
-                                if (!err) {
-                                        if (hdl->block.buf.bitmap.magic == BLOCK_MAGIC_BITMAP) {
-                                                bmp = hdl->block.buf.bitmap.map;
-                                                bsz = sizeof(hdl->block.buf.bitmap.map);
-                                                bmpnext++;
-                                        } else {
-                                                DBG("Invalid bitmap block");
-                                                err = EILSEQ;
-                                        }
+                blk.num              = 1 + n;
+                blk.buf.bitmap.magic = BLOCK_MAGIC_BITMAP;
+                map    = blk.buf.bitmap.map;
+                size   = sizeof(blk.buf.bitmap.map);
+                offset = sizeof(blk.buf.main.bitmap) + (n * size);
+        }
+
+        memcpy(map, &bmp[offset], min(size, bytes - offset));
+
+        return block_write(hdl, &blk);
+}
+
+//==============================================================================
+/**
+ * @brief  Function find empty block by using bitmap. Search starts at the
+ *         allocation cursor (next-fit) and is done word by word.
+ *
+ * @param  hdl          EEFS handle
+ * @param  blknum       found empty block
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int bmp_block_find_empty(EEFS_t *hdl, uint16_t *blknum)
+{
+        if (hdl->bmp_used >= hdl->blocks) {
+                return ENOSPC;
+        }
+
+        u16_t words = (hdl->blocks + 31) / 32;
+        u16_t start = (hdl->bmp_cursor < hdl->blocks) ? (hdl->bmp_cursor / 32) : 0;
+
+        for (u16_t n = 0; n < words; n++) {
+                u16_t w = (start + n) % words;
+
+                if (hdl->bmp[w] == 0) {
+                        continue;
+                }
+
+                const u8_t *byte = cast(u8_t*, &hdl->bmp[w]);
+
+                for (u8_t i = 0; i < sizeof(u32_t); i++) {
+                        if (byte[i]) {
+                                u8_t bit = 0;
+                                while (!(byte[i] & (1 << bit))) {
+                                        bit++;
                                 }
-                        }
 
-                        if (*blknum == 0) {
-                                err = ENOSPC;
+                                *blknum = (w * 32) + (i * 8) + bit;
+                                return ESUCC;
                         }
-                } while (!err && bmpblks--);
+                }
         }
 
-        finish:
-        return err;
+        return ENOSPC;
 }
 
 //==============================================================================
@@ -1783,60 +1994,41 @@ static int bmp_block_find_empty(EEFS_t *hdl, uint16_t *blknum)
 //==============================================================================
 static int bmp_block_alloc_ctrl(EEFS_t *hdl, uint16_t blknum, bool allocate)
 {
-        hdl->tmpblock.num = MAIN_BLOCK_ADDR;
-        int err = block_read(hdl, &hdl->tmpblock);
-        if (!err) {
+        if (blknum >= hdl->blocks) {
+                return ENOSPC;
+        }
 
-                if (hdl->tmpblock.buf.main.magic != BLOCK_MAGIC_MAIN) {
-                        err = EILSEQ;
-                        goto finish;
-                }
+        u8_t *bmp    = cast(u8_t*, hdl->bmp);
+        u16_t blkidx = (blknum / 8);
+        u8_t  blkbit = (1 << (blknum % 8));
 
-                if (blknum >= hdl->tmpblock.buf.main.blocks) {
-                        err = ENOSPC;
-                        goto finish;
+        if (allocate) {
+                if (!(bmp[blkidx] & blkbit)) {
+                        return EADDRINUSE;
                 }
 
-                u16_t bmpblk = 0;
-                u8_t  blkidx = (blknum / 8);
-                u8_t  blkbit = (blknum % 8);
-                u8_t *bmp    = hdl->tmpblock.buf.main.bitmap;
-
-                if (blkidx >= sizeof(hdl->tmpblock.buf.main.bitmap)) {
-
-                        blkidx -= sizeof(hdl->tmpblock.buf.main.bitmap);
-                        bmpblk  = (blkidx / sizeof(hdl->tmpblock.buf.bitmap.map));
-                        blkidx -= bmpblk * sizeof(hdl->tmpblock.buf.bitmap.map);
-                        bmpblk += 1;
+                bmp[blkidx] &= ~blkbit;
 
-                        if (bmpblk <= hdl->tmpblock.buf.main.bitmap_blocks) {
-                                hdl->tmpblock.num = bmpblk;
-                                err = block_read(hdl, &hdl->tmpblock);
-                                if (!err) {
-                                        bmp = hdl->tmpblock.buf.bitmap.map;
-                                }
-                        } else {
-                                err = ENOSPC;
-                        }
+        } else {
+                if (bmp[blkidx] & blkbit) {
+                        return ESUCC;
                 }
 
-                if (!err) {
-                        if (allocate && !(bmp[blkidx] & (1 << blkbit))) {
-                                err = EADDRINUSE;
-
-                        } else {
-                                if (allocate) {
-                                        bmp[blkidx] &= ~(1 << blkbit);
-                                } else {
-                                        bmp[blkidx] |= (1 << blkbit);
-                                }
+                bmp[blkidx] |= blkbit;
+        }
 
-                                err = block_write(hdl, &hdl->tmpblock);
-                        }
+        int err = bmp_write_back(hdl, blkidx);
+        if (!err) {
+                if (allocate) {
+                        hdl->bmp_used++;
+                        hdl->bmp_cursor = blknum + 1;
+                } else {
+                        hdl->bmp_used--;
                 }
+        } else {
+                bmp[blkidx] ^= blkbit;
         }
 
-        finish:
         return err;
 }
 
@@ -1882,57 +2074,8 @@ static int bmp_block_free(EEFS_t *hdl, uint16_t blknum)
 //==============================================================================
 static int bmp_get_used_blocks(EEFS_t *hdl, uint16_t *blkused)
 {
-        hdl->tmpblock.num = MAIN_BLOCK_ADDR;
-        int err = block_read(hdl, &hdl->tmpblock);
-        if (!err) {
-
-                if (hdl->tmpblock.buf.main.magic != BLOCK_MAGIC_MAIN) {
-                        err = EILSEQ;
-                        goto finish;
-                }
-
-                uint16_t blks    = hdl->tmpblock.buf.main.blocks;
-                uint16_t bmpblks = hdl->tmpblock.buf.main.bitmap_blocks;
-                uint8_t *bmp     = hdl->tmpblock.buf.main.bitmap;
-                uint8_t  bsz     = sizeof(hdl->tmpblock.buf.main.bitmap);
-                uint8_t  bmpnext = 1;
-
-                do {
-                        for (u8_t i = 0; i < bsz && blks > 0; i++, blks -= 8) {
-                                u8_t ones;
-
-                                if (bmp[i] == 0xFF) {
-                                        ones = 8;
-                                } else if (bmp[i] == 0) {
-                                        ones = 0;
-                                } else {
-                                        ones = ((bmp[i] >> 7) & 1)
-                                             + ((bmp[i] >> 6) & 1)
-                                             + ((bmp[i] >> 5) & 1)
-                                             + ((bmp[i] >> 4) & 1)
-                                             + ((bmp[i] >> 3) & 1)
-                                             + ((bmp[i] >> 2) & 1)
-                                             + ((bmp[i] >> 1) & 1)
-                                             + ((bmp[i] >> 0) & 1);
-                                }
-
-                                *blkused += (8 - ones);
-                        }
-
-                        if (bmpblks) {
-                                hdl->tmpblock.num = bmpnext;
-                                err = block_read(hdl, &hdl->tmpblock);
-                                if (!err) {
-                                        bmp = hdl->tmpblock.buf.bitmap.map;
-                                        bsz = sizeof(hdl->tmpblock.buf.bitmap.map);
-                                        bmpnext++;
-                                }
-                        }
-                } while (!err && bmpblks--);
-        }
-
-        finish:
-        return err;
+        *blkused = hdl->bmp_used;
+        return ESUCC;
 }
 
 //==============================================================================
@@ -2684,10 +2827,10 @@ static int file_add_chain(EEFS_t *hdl)
 
                 if (!err) {
                         if (block_is_file(hdl->block)) {
-                                hdl->block.buf.file_data.data_next = next;
+                                hdl->block.buf.file.data_next = next;
 
                         } else if (block_is_file_data(hdl->block)) {
-                                hdl->block.buf.file.data_next = next;
+                                hdl->block.buf.file_data.data_next = next;
 
                         } else {
                                 err = EILSEQ;
@@ -2714,85 +2857,207 @@ static int file_add_chain(EEFS_t *hdl)
 
 //==============================================================================
 /**
- * @brief  Function write data to file loaded in current block.
+ * @brief  Function drop cached chain positions of all opened descriptors of
+ *         selected file (e.g. file chains were released).
  *
  * @param  hdl          EEFS handle
- * @param  src          source buffer
- * @param  count        number of bytes to write
- * @param  fpos         position in file
- * @param  wrcnt        number of wrote bytes
+ * @param  blknum       file block number
+ */
+//==============================================================================
+static void file_chain_reset(EEFS_t *hdl, u16_t blknum)
+{
+        for (file_desc_t *fd = hdl->open_files; fd; fd = fd->next) {
+                if (fd->block_num == blknum) {
+                        fd->chain_blk = 0;
+                        fd->chain_pos = 0;
+                        memset(fd->chain_idx, 0, sizeof(fd->chain_idx));
+                }
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Function calculate chain position and offset in chain data of
+ *         selected file position.
  *
- * @return One of errno value.
+ * @param  fpos         file position
+ * @param  chainpos     chain position (0: file block)
+ * @param  blkseek      offset in chain data
  */
 //==============================================================================
-static int file_write(EEFS_t *hdl, const u8_t *src, size_t count, fpos_t *fpos, size_t *wrcnt)
+static void file_get_chain_pos(fpos_t fpos, u16_t *chainpos, u16_t *blkseek)
 {
-        int err = ESUCC;
+        const u16_t filesz = sizeof(((block_file_t*)0)->data);
+        const u16_t datasz = sizeof(((block_file_data_t*)0)->data);
+
+        *chainpos = 0;
+        *blkseek  = fpos;
+
+        if (fpos > filesz) {
+                *chainpos = CEILING((fpos - filesz), datasz);
+                *blkseek  = (fpos - filesz) - ((*chainpos - 1) * datasz);
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Function load next chain of file chain loaded in current block.
+ *         Current block must be the last used chain of file descriptor.
+ *
+ * @param  hdl          EEFS handle
+ * @param  fd           file descriptor
+ * @param  alloc        add new chain at end of file
+ *
+ * @return One of errno value. ENOENT if chain does not exist.
+ */
+//==============================================================================
+static int file_next_chain(EEFS_t *hdl, file_desc_t *fd, bool alloc)
+{
+        int   err  = ESUCC;
+        u16_t next = 0;
 
-        *wrcnt         = 0;
-        u16_t baseblk  = hdl->block.num;
-        u16_t chainpos = 0;
-        u16_t blkseek  = *fpos;
-        u16_t chainsz  = sizeof(((block_file_t*)0)->data);
-        u8_t *data     = hdl->block.buf.file.data;
+        // link is stored in data_next field of loaded block type (on-disk
+        // format; versions before 2.1.7 used field of the other block type)
+        if (block_is_file(hdl->block)) {
+                next = hdl->block.buf.file.data_next;
 
-        // calculate start chain number
-        if (*fpos > chainsz) {
-                chainpos = CEILING((*fpos - chainsz),
-                                   sizeof(((block_file_data_t*)0)->data));
+        } else if (block_is_file_data(hdl->block)) {
+                next = hdl->block.buf.file_data.data_next;
 
-                blkseek  = (*fpos - chainsz)
-                         - ((chainpos - 1) * sizeof(((block_file_data_t*)0)->data));
+        } else {
+                return EILSEQ;
         }
 
-        while (!err && count > 0) {
-                if (chainpos > 0) {
-                        u16_t next = 0;
-                        chainsz    = sizeof(hdl->block.buf.file_data.data);
-                        data       = hdl->block.buf.file_data.data;
+        if (next == 0) {
+                err = alloc ? file_add_chain(hdl) : ENOENT;
+        } else {
+                hdl->block.num = next;
+                err = block_read(hdl, &hdl->block);
+        }
 
-                        if (block_is_file(hdl->block)) {
-                                next = hdl->block.buf.file_data.data_next;
+        if (!err) {
+                fd->chain_pos++;
+                fd->chain_blk = hdl->block.num;
 
-                        } else if (block_is_file_data(hdl->block)) {
-                                next = hdl->block.buf.file.data_next;
+                if (  (fd->chain_pos % CHAIN_INDEX_STRIDE) == 0
+                   && (fd->chain_pos / CHAIN_INDEX_STRIDE) <= CHAIN_INDEX_SIZE) {
 
-                        } else {
-                                err = EILSEQ;
+                        fd->chain_idx[(fd->chain_pos / CHAIN_INDEX_STRIDE) - 1] = fd->chain_blk;
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function load selected chain of file to current block. Chain is
+ *         searched from the last used chain or from the nearest indexed chain
+ *         of file descriptor, so sequential access and near seeks do not
+ *         follow chain from the file block.
+ *
+ * @param  hdl          EEFS handle
+ * @param  fd           file descriptor
+ * @param  chainpos     chain position (0: file block)
+ * @param  alloc        add new chains if file is shorter
+ *
+ * @return One of errno value. ENOENT if chain does not exist.
+ */
+//==============================================================================
+static int file_load_chain(EEFS_t *hdl, file_desc_t *fd, u16_t chainpos, bool alloc)
+{
+        int err = ESUCC;
+
+        if (!fd->chain_blk || fd->chain_pos > chainpos) {
+                fd->chain_pos = 0;
+                fd->chain_blk = fd->block_num;
+
+                for (u16_t i = min(chainpos / CHAIN_INDEX_STRIDE, CHAIN_INDEX_SIZE); i > 0; i--) {
+                        if (fd->chain_idx[i - 1]) {
+                                fd->chain_pos = i * CHAIN_INDEX_STRIDE;
+                                fd->chain_blk = fd->chain_idx[i - 1];
                                 break;
                         }
+                }
+        }
 
-                        if (next == 0) {
-                                err = file_add_chain(hdl);
-                        } else {
-                                hdl->block.num = next;
-                                err = block_read(hdl, &hdl->block);
-                        }
+        // file block is already loaded by caller
+        if (hdl->block.num != fd->chain_blk || fd->chain_pos > 0) {
+                hdl->block.num = fd->chain_blk;
+                err = block_read(hdl, &hdl->block);
 
-                        chainpos--;
+                if (!err && fd->chain_pos > 0 && !block_is_file_data(hdl->block)) {
+                        DBG("chain cache mismatch");
+                        file_chain_reset(hdl, fd->block_num);
+                        fd->chain_blk  = fd->block_num;
+                        hdl->block.num = fd->block_num;
+                        err = block_read(hdl, &hdl->block);
                 }
+        }
 
-                if (!err && chainpos == 0) {
-                        u16_t sz = min(cast(u16_t, chainsz - blkseek), count);
+        while (!err && fd->chain_pos < chainpos) {
+                err = file_next_chain(hdl, fd, alloc);
+        }
 
-                        if (sz) {
-                                memcpy(data + blkseek, src, sz);
-                        }
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function write data to file loaded in current block.
+ *
+ * @param  hdl          EEFS handle
+ * @param  fd           file descriptor
+ * @param  src          source buffer
+ * @param  count        number of bytes to write
+ * @param  fpos         position in file
+ * @param  wrcnt        number of wrote bytes
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int file_write(EEFS_t *hdl, file_desc_t *fd, const u8_t *src, size_t count, fpos_t *fpos, size_t *wrcnt)
+{
+        *wrcnt = 0;
 
+        u16_t chainpos, blkseek;
+        file_get_chain_pos(*fpos, &chainpos, &blkseek);
+
+        int err = file_load_chain(hdl, fd, chainpos, true);
+
+        while (!err && count > 0) {
+                u16_t chainsz;
+                u8_t *data;
+
+                if (block_is_file(hdl->block)) {
+                        chainsz = sizeof(hdl->block.buf.file.data);
+                        data    = hdl->block.buf.file.data;
+                } else {
+                        chainsz = sizeof(hdl->block.buf.file_data.data);
+                        data    = hdl->block.buf.file_data.data;
+                }
+
+                u16_t sz = min(cast(u16_t, chainsz - blkseek), count);
+
+                if (sz) {
+                        memcpy(data + blkseek, src, sz);
                         err = block_write(hdl, &hdl->block);
+                }
 
-                        if (!err) {
-                                *wrcnt  += sz;
-                                blkseek  = 0;
-                                src     += sz;
-                                count   -= sz;
-                                chainpos = 1;
+                if (!err) {
+                        *wrcnt  += sz;
+                        blkseek  = 0;
+                        src     += sz;
+                        count   -= sz;
+
+                        if (count > 0) {
+                                err = file_next_chain(hdl, fd, true);
                         }
                 }
         }
 
         if (*wrcnt) {
-                hdl->block.num = baseblk;
+                hdl->block.num = fd->block_num;
                 err = block_read(hdl, &hdl->block);
                 if (!err) {
                         time_t time = 0;
@@ -2813,6 +3078,7 @@ static int file_write(EEFS_t *hdl, const u8_t *src, size_t count, fpos_t *fpos,
  * @brief  Function read data from selected file loaded in current block.
  *
  * @param  hdl          EEFS handle
+ * @param  fd           file descriptor
  * @param  dst          destination buffer
  * @param  count        number of bytes to read
  * @param  fpos         file position
@@ -2821,77 +3087,52 @@ static int file_write(EEFS_t *hdl, const u8_t *src, size_t count, fpos_t *fpos,
  * @return One of errno value.
  */
 //==============================================================================
-static int file_read(EEFS_t *hdl, u8_t *dst, size_t count, fpos_t *fpos, size_t *rdcnt)
+static int file_read(EEFS_t *hdl, file_desc_t *fd, u8_t *dst, size_t count, fpos_t *fpos, size_t *rdcnt)
 {
-        int err = ESUCC;
-
-        *rdcnt         = 0;
-        u16_t chainpos = 0;
-        u16_t blkseek  = *fpos;
-        u16_t chainsz  = sizeof(((block_file_t*)0)->data);
-        u8_t *data     = hdl->block.buf.file.data;
+        *rdcnt = 0;
 
         if (*fpos >= hdl->block.buf.file.size) {
-                return err;
+                return ESUCC;
         }
 
         if (*fpos + count > hdl->block.buf.file.size) {
                 count = hdl->block.buf.file.size - *fpos;
         }
 
-        // calculate start chain number
-        if (*fpos > chainsz) {
-                chainpos = CEILING((*fpos - chainsz),
-                                   sizeof(((block_file_data_t*)0)->data));
+        u16_t chainpos, blkseek;
+        file_get_chain_pos(*fpos, &chainpos, &blkseek);
 
-                blkseek  = (*fpos - chainsz)
-                         - ((chainpos - 1) * sizeof(((block_file_data_t*)0)->data));
-        }
+        int err = file_load_chain(hdl, fd, chainpos, false);
 
         while (!err && count > 0) {
-                if (chainpos > 0) {
-                        u16_t next = 0;
-                        chainsz    = sizeof(hdl->block.buf.file_data.data);
-                        data       = hdl->block.buf.file_data.data;
+                u16_t chainsz;
+                u8_t *data;
 
-                        if (block_is_file(hdl->block)) {
-                                next = hdl->block.buf.file_data.data_next;
-
-                        } else if (block_is_file_data(hdl->block)) {
-                                next = hdl->block.buf.file.data_next;
-
-                        } else {
-                                err = EILSEQ;
-                                break;
-                        }
-
-                        if (next == 0) {
-                                break; // EOF
+                if (block_is_file(hdl->block)) {
+                        chainsz = sizeof(hdl->block.buf.file.data);
+                        data    = hdl->block.buf.file.data;
+                } else {
+                        chainsz = sizeof(hdl->block.buf.file_data.data);
+                        data    = hdl->block.buf.file_data.data;
+                }
 
-                        } else {
-                                hdl->block.num = next;
-                                err = block_read(hdl, &hdl->block);
-                        }
+                u16_t sz = min(cast(u16_t, chainsz - blkseek), count);
 
-                        chainpos--;
+                if (sz) {
+                        memcpy(dst, data + blkseek, sz);
                 }
 
-                if (!err && chainpos == 0) {
-                        u16_t sz = min(cast(u16_t, chainsz - blkseek), count);
+                *rdcnt  += sz;
+                blkseek  = 0;
+                dst     += sz;
+                count   -= sz;
 
-                        if (sz) {
-                                memcpy(dst, data + blkseek, sz);
-                        }
-
-                        *rdcnt  += sz;
-                        blkseek  = 0;
-                        dst     += sz;
-                        count   -= sz;
-                        chainpos = 1;
+                if (count > 0) {
+                        err = file_next_chain(hdl, fd, false);
                 }
         }
 
-        return err;
+        return (err == ENOENT) ? ESUCC : err;
 }
 
 /*==============================================================================
@@ -36,6 +36,7 @@ Brief   EXT4 file system
 ==============================================================================*/
 #define SECTOR_SIZE     512
 #define LOCK_TIMEOUT    MAX_DELAY_MS
+#define EXT4FS(bdev)    cast(ext4fs_t*, cast(u8_t*, bdev) - offsetof(ext4fs_t, bd))
 
 /*==============================================================================
   Local object types
@@ -46,6 +47,7 @@ typedef struct {
         struct ext4_blockdev       bd;
         u8_t                       buf[SECTOR_SIZE];
         u32_t                      open_files;
+        u32_t                      dio_min;
 } ext4fs_t;
 
 /*==============================================================================
@@ -57,6 +59,7 @@ static int bopen(struct ext4_blockdev *bdev);
 static int bclose(struct ext4_blockdev *bdev);
 static int bread(struct ext4_blockdev *bdev, void *buf, uint64_t blk_id, uint32_t blk_cnt);
 static int bwrite(struct ext4_blockdev *bdev, const void *buf, uint64_t blk_id, uint32_t blk_cnt);
+static bool is_direct(struct ext4_blockdev *bdev, uint32_t blk_cnt);
 static int lock(struct ext4_blockdev *bdev);
 static int unlock(struct ext4_blockdev *bdev);
 static tfile_t ext4ftype2vfs(u32_t mode);
@@ -82,6 +85,11 @@ static const char *ext4_path(const char *path);
 /**
  * @brief Initialize file system.
  *
+ * Options:
+ * @li ro: read only mount
+ * @li dio=<bytes>: file data transfers of at least selected size omit system
+ *     cache (default 0: disabled). Metadata blocks are always cached.
+ *
  * @param[out]          **fs_handle             file system allocated memory
  * @param[in ]           *src_path              file source path
  * @param[in ]           *opts                  file system options (can be NULL)
@@ -118,6 +126,11 @@ API_FS_INIT(ext4fs, void **fs_handle, const char *src_path, const char *opts)
                 hdl->bd.part_size  = st.st_size;
                 hdl->bd.bdif       = &hdl->bdif;
 
+                int dio = sys_stropt_get_int(opts, "dio", 0);
+                if (dio > 0) {
+                        hdl->dio_min = max(1, dio / SECTOR_SIZE);
+                }
+
                 err = ext4_mount(&hdl->bd, &hdl->mp, strstr(opts, "ro"));
                 if (!err) {
                         ext4_cache_write_back(hdl->mp, true);
@@ -316,6 +329,95 @@ API_FS_READ(ext4fs,
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief Write data from buffer vector to the file.
+ *
+ * @param[in ]          *fs_handle              file system allocated memory
+ * @param[in ]          *fhdl                   file handle
+ * @param[in ]          *iov                    buffer vector
+ * @param[in ]           iovcnt                 number of buffers
+ * @param[in ]          *fpos                   position in file
+ * @param[out]          *wrcnt                  number of written bytes
+ * @param[in ]           fattr                  file attributes
+ *
+ * @return One of errno value (errno.h).
+ */
+//==============================================================================
+API_FS_WRITEV(ext4fs,
+              void               *fs_handle,
+              void               *fhdl,
+              const struct iovec *iov,
+              int                 iovcnt,
+              fpos_t             *fpos,
+              size_t             *wrcnt,
+              struct vfs_fattr    fattr)
+{
+        UNUSED_ARG1(fattr);
+
+        ext4fs_t *hdl = fs_handle;
+
+        int err = ext4_fseek(fhdl, *fpos, SEEK_SET);
+        if (!err) {
+                for (int i = 0; !err && (i < iovcnt); i++) {
+                        size_t n = 0;
+                        err = ext4_fwrite(fhdl, iov[i].iov_base, iov[i].iov_len, &n);
+                        *wrcnt += n;
+
+                        if (n < iov[i].iov_len) {
+                                break;
+                        }
+                }
+
+                time_t mtime = 0;
+                if (sys_get_time(&mtime) == ESUCC) {
+                        ext4_mtime_set2(hdl->mp, fhdl, mtime);
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Read data from file to buffer vector.
+ *
+ * @param[in ]          *fs_handle              file system allocated memory
+ * @param[in ]          *fhdl                   file handle
+ * @param[in ]          *iov                    buffer vector
+ * @param[in ]           iovcnt                 number of buffers
+ * @param[in ]          *fpos                   position in file
+ * @param[out]          *rdcnt                  number of read bytes
+ * @param[in ]           fattr                  file attributes
+ *
+ * @return One of errno value (errno.h).
+ */
+//==============================================================================
+API_FS_READV(ext4fs,
+             void               *fs_handle,
+             void               *fhdl,
+             const struct iovec *iov,
+             int                 iovcnt,
+             fpos_t             *fpos,
+             size_t             *rdcnt,
+             struct vfs_fattr    fattr)
+{
+        UNUSED_ARG2(fs_handle, fattr);
+
+        int err = ext4_fseek(fhdl, *fpos, SEEK_SET);
+        for (int i = 0; !err && (i < iovcnt); i++) {
+                size_t n = 0;
+                err = ext4_fread(fhdl, iov[i].iov_base, iov[i].iov_len, &n);
+                *rdcnt += n;
+
+                if (n < iov[i].iov_len) {
+                        break;
+                }
+        }
+
+        return err;
+}
+
 //==============================================================================
 /**
  * @brief IO operations on files.
@@ -826,6 +928,14 @@ static int bclose(struct ext4_blockdev *bdev)
 //==============================================================================
 static int bread(struct ext4_blockdev *bdev, void *buf, uint64_t blk_id, uint32_t blk_cnt)
 {
+        if (is_direct(bdev, blk_cnt)) {
+                return sys_cache_direct_read(bdev->bdif->blkobj,
+                                             blk_id,
+                                             bdev->bdif->ph_bsize,
+                                             blk_cnt,
+                                             buf);
+        }
+
         return sys_cache_read(bdev->bdif->blkobj,
                               blk_id,
                               bdev->bdif->ph_bsize,
@@ -847,6 +957,14 @@ static int bread(struct ext4_blockdev *bdev, void *buf, uint64_t blk_id, uint32_
 //==============================================================================
 static int bwrite(struct ext4_blockdev *bdev, const void *buf, uint64_t blk_id, uint32_t blk_cnt)
 {
+        if (is_direct(bdev, blk_cnt)) {
+                return sys_cache_direct_write(bdev->bdif->blkobj,
+                                              blk_id,
+                                              bdev->bdif->ph_bsize,
+                                              blk_cnt,
+                                              buf);
+        }
+
         return sys_cache_write(bdev->bdif->blkobj,
                                blk_id,
                                bdev->bdif->ph_bsize,
@@ -856,6 +974,27 @@ static int bwrite(struct ext4_blockdev *bdev, const void *buf, uint64_t blk_id,
                                                       : CACHE_WRITE_THROUGH);
 }
 
+//==============================================================================
+/**
+ * @brief  Function check if transfer should omit system cache. Only file data
+ *         transfers longer than single logical block can be transferred
+ *         directly, so metadata blocks are always cached.
+ *
+ * @param  bdev         block device.
+ * @param  blk_cnt      number of blocks to transfer.
+ *
+ * @return True if transfer should be direct, otherwise false.
+ */
+//==============================================================================
+static bool is_direct(struct ext4_blockdev *bdev, uint32_t blk_cnt)
+{
+        ext4fs_t *hdl = EXT4FS(bdev);
+
+        return (hdl->dio_min > 0)
+            && (blk_cnt >= hdl->dio_min)
+            && (blk_cnt * bdev->bdif->ph_bsize > bdev->lg_bsize);
+}
+
 //==============================================================================
 /**
  * @brief  Function lock access to disc.
@@ -1420,11 +1420,9 @@ int ext4_fread(ext4_file *file, void *buf, size_t size, size_t *rcnt)
 {
 	uint32_t unalg;
 	uint32_t iblock_idx;
-	uint32_t iblock_last;
 	uint32_t block_size;
 
 	ext4_fsblk_t fblock;
-	ext4_fsblk_t fblock_start;
 	uint32_t fblock_count;
 
 	uint8_t *u8_buf = buf;
@@ -1461,7 +1459,6 @@ int ext4_fread(ext4_file *file, void *buf, size_t size, size_t *rcnt)
 		? ((size_t)(file->fsize - file->fpos)) : size;
 
 	iblock_idx = (uint32_t)((file->fpos) / block_size);
-	iblock_last = (uint32_t)((file->fpos + size) / block_size);
 	unalg = (file->fpos) % block_size;
 
 	/*If the size of symlink is smaller than 60 bytes*/
@@ -1516,40 +1513,31 @@ int ext4_fread(ext4_file *file, void *buf, size_t size, size_t *rcnt)
 		iblock_idx++;
 	}
 
-	fblock_start = 0;
-	fblock_count = 0;
 	while (size >= block_size) {
-		while (iblock_idx < iblock_last) {
-			r = ext4_fs_get_inode_dblk_idx(&ref, iblock_idx,
-						       &fblock, true);
+		/* Map whole extent run at once and read it by single request */
+		r = ext4_fs_get_inode_dblk_range(&ref, iblock_idx,
+						 (uint32_t)(size / block_size),
+						 &fblock, &fblock_count);
+		if (r != EOK)
+			goto Finish;
+
+		if (fblock != 0) {
+			r = ext4_blocks_get_direct(file->mp->fs.bdev, u8_buf,
+						   fblock, fblock_count);
 			if (r != EOK)
 				goto Finish;
-
-			iblock_idx++;
-
-			if (!fblock_start)
-				fblock_start = fblock;
-
-			if ((fblock_start + fblock_count) != fblock)
-				break;
-
-			fblock_count++;
+		} else {
+			/* Hole or unwritten range */
+			memset(u8_buf, 0, block_size * fblock_count);
 		}
 
-		r = ext4_blocks_get_direct(file->mp->fs.bdev, u8_buf, fblock_start,
-					   fblock_count);
-		if (r != EOK)
-			goto Finish;
-
+		iblock_idx += fblock_count;
 		size -= block_size * fblock_count;
 		u8_buf += block_size * fblock_count;
 		file->fpos += block_size * fblock_count;
 
 		if (rcnt)
 			*rcnt += block_size * fblock_count;
-
-		fblock_start = fblock;
-		fblock_count = 1;
 	}
 
 	if (size) {
@@ -1558,10 +1546,15 @@ int ext4_fread(ext4_file *file, void *buf, size_t size, size_t *rcnt)
 		if (r != EOK)
 			goto Finish;
 
-		off = fblock * block_size;
-		r = ext4_block_readbytes(file->mp->fs.bdev, off, u8_buf, size);
-		if (r != EOK)
-			goto Finish;
+		if (fblock != 0) {
+			off = fblock * block_size;
+			r = ext4_block_readbytes(file->mp->fs.bdev, off, u8_buf,
+						 size);
+			if (r != EOK)
+				goto Finish;
+		} else {
+			memset(u8_buf, 0, size);
+		}
 
 		file->fpos += size;
 
@@ -1579,13 +1572,11 @@ int ext4_fwrite(ext4_file *file, const void *buf, size_t size, size_t *wcnt)
 {
 	uint32_t unalg;
 	uint32_t iblk_idx;
-	uint32_t iblock_last;
 	uint32_t ifile_blocks;
 	uint32_t block_size;
 
 	uint32_t fblock_count;
 	ext4_fsblk_t fblk;
-	ext4_fsblk_t fblock_start;
 
 	struct ext4_inode_ref ref;
 	const uint8_t *u8_buf = buf;
@@ -1622,7 +1613,6 @@ int ext4_fwrite(ext4_file *file, const void *buf, size_t size, size_t *wcnt)
 	file->fsize = ext4_inode_get_size(sb, ref.inode);
 	block_size = ext4_sb_get_block_size(sb);
 
-	iblock_last = (uint32_t)((file->fpos + size) / block_size);
 	iblk_idx = (uint32_t)(file->fpos / block_size);
 	ifile_blocks = (uint32_t)((file->fsize + block_size - 1) / block_size);
 
@@ -1658,66 +1648,53 @@ int ext4_fwrite(ext4_file *file, const void *buf, size_t size, size_t *wcnt)
 	if (r != EOK)
 		goto Finish;
 
-	fblock_start = 0;
-	fblock_count = 0;
 	while (size >= block_size) {
+		uint32_t max_blocks = (uint32_t)(size / block_size);
 
-		while (iblk_idx < iblock_last) {
-			if (iblk_idx < ifile_blocks) {
-				r = ext4_fs_init_inode_dblk_idx(&ref, iblk_idx,
-								&fblk);
-				if (r != EOK)
-					goto Finish;
-			} else {
-				rr = ext4_fs_append_inode_dblk(&ref, &fblk,
-							       &iblk_idx);
-				if (rr != EOK) {
-					/* Unable to append more blocks. But
-					 * some block might be allocated already
-					 * */
-					break;
-				}
-			}
-
-			iblk_idx++;
-
-			if (!fblock_start) {
-				fblock_start = fblk;
-			}
+		/* Map or allocate whole contiguous run for the request at once */
+		if (iblk_idx < ifile_blocks) {
+			if (max_blocks > ifile_blocks - iblk_idx)
+				max_blocks = ifile_blocks - iblk_idx;
 
-			if ((fblock_start + fblock_count) != fblk)
+			r = ext4_fs_init_inode_dblk_range(&ref, iblk_idx,
+							  max_blocks, &fblk,
+							  &fblock_count);
+			if (r != EOK)
 				break;
-
-			fblock_count++;
+		} else {
+			rr = ext4_fs_append_inode_dblk_range(&ref, max_blocks,
+							     &fblk, &iblk_idx,
+							     &fblock_count);
+			if (rr != EOK) {
+				/*ext4_fs_append_inode_block has failed and no
+				 * more blocks might be written. But node size
+				 * should be updated.*/
+				break;
+			}
 		}
 
-		r = ext4_blocks_set_direct(file->mp->fs.bdev, u8_buf, fblock_start,
+		r = ext4_blocks_set_direct(file->mp->fs.bdev, u8_buf, fblk,
 					   fblock_count);
 		if (r != EOK)
 			break;
 
+		iblk_idx += fblock_count;
 		size -= block_size * fblock_count;
 		u8_buf += block_size * fblock_count;
 		file->fpos += block_size * fblock_count;
 
 		if (wcnt)
 			*wcnt += block_size * fblock_count;
-
-		fblock_start = fblk;
-		fblock_count = 1;
-
-		if (rr != EOK) {
-			/*ext4_fs_append_inode_block has failed and no
-			 * more blocks might be written. But node size
-			 * should be updated.*/
-			r = rr;
-			goto out_fsize;
-		}
 	}
 
 	/*Stop write back cache mode*/
 	ext4_block_cache_write_back(file->mp->fs.bdev, 0);
 
+	if (rr != EOK) {
+		r = rr;
+		goto out_fsize;
+	}
+
 	if (r != EOK)
 		goto Finish;
 
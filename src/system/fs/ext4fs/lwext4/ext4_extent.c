@@ -158,11 +158,38 @@ static ext4_fsblk_t ext4_new_meta_blocks(struct ext4_inode_ref *inode_ref,
 					 uint32_t flags __unused,
 					 uint32_t *count, int *errp)
 {
+	struct ext4_sblock *sb = &inode_ref->fs->sb;
 	ext4_fsblk_t block = 0;
+	uint32_t n = 1;
+	uint32_t max = 1;
+	bool free;
 
 	*errp = ext4_allocate_single_block(inode_ref, goal, &block);
+	if (*errp != EOK || !block)
+		return block;
+
+	if (count) {
+		max = *count;
+		if (max > EXT_INIT_MAX_LEN)
+			max = EXT_INIT_MAX_LEN;
+	}
+
+	/*
+	 * Extend allocation with following blocks as long as they are
+	 * free and in the same block group, so that multi-block request
+	 * is mapped by single extent.
+	 */
+	while (n < max && block + n < ext4_sb_get_blocks_cnt(sb) &&
+	       ext4_balloc_get_bgid_of_block(sb, block + n) ==
+	       ext4_balloc_get_bgid_of_block(sb, block)) {
+		if (ext4_balloc_try_alloc_block(inode_ref, block + n,
+						&free) != EOK || !free)
+			break;
+		n++;
+	}
+
 	if (count)
-		*count = 1;
+		*count = n;
 	return block;
 }
 
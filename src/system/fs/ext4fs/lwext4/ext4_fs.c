@@ -1473,6 +1473,89 @@ int ext4_fs_init_inode_dblk_idx(struct ext4_inode_ref *inode_ref,
 						   true, true);
 }
 
+static int ext4_fs_get_inode_dblk_range_internal(struct ext4_inode_ref *inode_ref,
+				       ext4_lblk_t iblock, uint32_t max_blocks,
+				       ext4_fsblk_t *fblock,
+				       uint32_t *blocks_count,
+				       bool extent_create)
+{
+#if CONFIG_EXTENT_ENABLE
+	struct ext4_fs *fs = inode_ref->fs;
+
+	/* Handle i-node using extents, whole extent is mapped at once */
+	if ((ext4_sb_feature_incom(&fs->sb, EXT4_FINCOM_EXTENTS)) &&
+	    (ext4_inode_has_flag(inode_ref->inode, EXT4_INODE_FLAG_EXTENTS)) &&
+	    (ext4_inode_get_size(&fs->sb, inode_ref->inode) != 0)) {
+
+		if (max_blocks == 0)
+			max_blocks = 1;
+
+		if (max_blocks > EXT_INIT_MAX_LEN)
+			max_blocks = EXT_INIT_MAX_LEN;
+
+		int rc = ext4_extent_get_blocks(inode_ref, iblock, max_blocks,
+				fblock, extent_create, blocks_count);
+		if (rc != EOK)
+			return rc;
+
+		/* Hole is reported as single unmapped block */
+		if (*blocks_count == 0) {
+			*fblock = 0;
+			*blocks_count = 1;
+		}
+
+		return EOK;
+	}
+#endif
+	int rc = ext4_fs_get_inode_dblk_idx_internal(inode_ref, iblock, fblock,
+						     extent_create, true);
+	if (rc != EOK)
+		return rc;
+
+	*blocks_count = 1;
+
+	/* Block list i-node, merge physically contiguous blocks (or holes
+	 * when reading) by probing following logical blocks */
+	while (*blocks_count < max_blocks) {
+		ext4_fsblk_t next_fblock;
+
+		rc = ext4_fs_get_inode_dblk_idx_internal(inode_ref,
+				iblock + *blocks_count, &next_fblock,
+				false, true);
+		if (rc != EOK)
+			break;
+
+		if (*fblock) {
+			if (next_fblock != *fblock + *blocks_count)
+				break;
+		} else if (extent_create || next_fblock != 0) {
+			break;
+		}
+
+		(*blocks_count)++;
+	}
+
+	return EOK;
+}
+
+int ext4_fs_get_inode_dblk_range(struct ext4_inode_ref *inode_ref,
+				 ext4_lblk_t iblock, uint32_t max_blocks,
+				 ext4_fsblk_t *fblock, uint32_t *blocks_count)
+{
+	return ext4_fs_get_inode_dblk_range_internal(inode_ref, iblock,
+						     max_blocks, fblock,
+						     blocks_count, false);
+}
+
+int ext4_fs_init_inode_dblk_range(struct ext4_inode_ref *inode_ref,
+				  ext4_lblk_t iblock, uint32_t max_blocks,
+				  ext4_fsblk_t *fblock, uint32_t *blocks_count)
+{
+	return ext4_fs_get_inode_dblk_range_internal(inode_ref, iblock,
+						     max_blocks, fblock,
+						     blocks_count, true);
+}
+
 static int ext4_fs_set_inode_data_block_index(struct ext4_inode_ref *inode_ref,
 				       ext4_lblk_t iblock, ext4_fsblk_t fblock)
 {
@@ -1709,6 +1792,81 @@ int ext4_fs_append_inode_dblk(struct ext4_inode_ref *inode_ref,
 	return EOK;
 }
 
+int ext4_fs_append_inode_dblk_range(struct ext4_inode_ref *inode_ref,
+				    uint32_t max_blocks, ext4_fsblk_t *fblock,
+				    ext4_lblk_t *iblock, uint32_t *blocks_count)
+{
+#if CONFIG_EXTENT_ENABLE
+	/* Handle extents separately */
+	if ((ext4_sb_feature_incom(&inode_ref->fs->sb, EXT4_FINCOM_EXTENTS)) &&
+	    (ext4_inode_has_flag(inode_ref->inode, EXT4_INODE_FLAG_EXTENTS))) {
+		int rc;
+		ext4_fsblk_t current_fsblk;
+		struct ext4_sblock *sb = &inode_ref->fs->sb;
+		uint64_t inode_size = ext4_inode_get_size(sb, inode_ref->inode);
+		uint32_t block_size = ext4_sb_get_block_size(sb);
+		*iblock = (uint32_t)((inode_size + block_size - 1) / block_size);
+
+		if (max_blocks == 0)
+			max_blocks = 1;
+
+		if (max_blocks > EXT_INIT_MAX_LEN)
+			max_blocks = EXT_INIT_MAX_LEN;
+
+		rc = ext4_extent_get_blocks(inode_ref, *iblock, max_blocks,
+					    &current_fsblk, true, blocks_count);
+		if (rc != EOK)
+			return rc;
+
+		*fblock = current_fsblk;
+		ext4_assert(*fblock && *blocks_count);
+
+		ext4_inode_set_size(inode_ref->inode, inode_size +
+				    (uint64_t)block_size * *blocks_count);
+		inode_ref->dirty = true;
+
+		return rc;
+	}
+#endif
+	int rc = ext4_fs_append_inode_dblk(inode_ref, fblock, iblock);
+	if (rc != EOK)
+		return rc;
+
+	*blocks_count = 1;
+
+	/* Block list i-node, extend run by physical blocks that directly
+	 * follow the appended one and are free */
+	struct ext4_sblock *sb = &inode_ref->fs->sb;
+	uint32_t block_size = ext4_sb_get_block_size(sb);
+
+	while (*blocks_count < max_blocks) {
+		ext4_fsblk_t phys_block = *fblock + *blocks_count;
+		bool free;
+
+		if (phys_block >= ext4_sb_get_blocks_cnt(sb))
+			break;
+
+		rc = ext4_balloc_try_alloc_block(inode_ref, phys_block, &free);
+		if ((rc != EOK) || !free)
+			break;
+
+		rc = ext4_fs_set_inode_data_block_index(inode_ref,
+				*iblock + *blocks_count, phys_block);
+		if (rc != EOK) {
+			ext4_balloc_free_block(inode_ref, phys_block);
+			break;
+		}
+
+		(*blocks_count)++;
+	}
+
+	ext4_inode_set_size(inode_ref->inode,
+			    (uint64_t)block_size * (*iblock + *blocks_count));
+	inode_ref->dirty = true;
+
+	return EOK;
+}
+
 void ext4_fs_inode_links_count_inc(struct ext4_inode_ref *inode_ref)
 {
 	uint16_t link;
@@ -250,6 +250,33 @@ int ext4_fs_get_inode_dblk_idx(struct ext4_inode_ref *inode_ref,
 int ext4_fs_init_inode_dblk_idx(struct ext4_inode_ref *inode_ref,
 				  ext4_lblk_t iblock, ext4_fsblk_t *fblock);
 
+/**@brief Get physical address and length of contiguous run of blocks
+ *        started at selected logical block.
+ * @param inode_ref    I-node to read block addresses from
+ * @param iblock       Logical index of first block
+ * @param max_blocks   Maximum number of blocks to map
+ * @param fblock       Output physical address of first block
+ *                     (0 for hole or unwritten range)
+ * @param blocks_count Output number of mapped blocks (at least 1)
+ * @return Error code
+ */
+int ext4_fs_get_inode_dblk_range(struct ext4_inode_ref *inode_ref,
+				 ext4_lblk_t iblock, uint32_t max_blocks,
+				 ext4_fsblk_t *fblock, uint32_t *blocks_count);
+
+/**@brief Initialize contiguous run of blocks started at selected logical
+ *        block. Holes and unwritten ranges are allocated.
+ * @param inode_ref    I-node to proceed on
+ * @param iblock       Logical index of first block
+ * @param max_blocks   Maximum number of blocks to map
+ * @param fblock       Output physical address of first block
+ * @param blocks_count Output number of mapped blocks (at least 1)
+ * @return Error code
+ */
+int ext4_fs_init_inode_dblk_range(struct ext4_inode_ref *inode_ref,
+				  ext4_lblk_t iblock, uint32_t max_blocks,
+				  ext4_fsblk_t *fblock, uint32_t *blocks_count);
+
 /**@brief Append following logical block to the i-node.
  * @param inode_ref I-node to append block to
  * @param fblock    Output physical block address of newly allocated block
@@ -259,6 +286,18 @@ int ext4_fs_init_inode_dblk_idx(struct ext4_inode_ref *inode_ref,
 int ext4_fs_append_inode_dblk(struct ext4_inode_ref *inode_ref,
 			      ext4_fsblk_t *fblock, ext4_lblk_t *iblock);
 
+/**@brief Append contiguous run of logical blocks to the i-node.
+ * @param inode_ref    I-node to append blocks to
+ * @param max_blocks   Maximum number of blocks to allocate
+ * @param fblock       Output physical address of first allocated block
+ * @param iblock       Output logical number of first allocated block
+ * @param blocks_count Output number of allocated blocks (at least 1)
+ * @return Error code
+ */
+int ext4_fs_append_inode_dblk_range(struct ext4_inode_ref *inode_ref,
+				    uint32_t max_blocks, ext4_fsblk_t *fblock,
+				    ext4_lblk_t *iblock, uint32_t *blocks_count);
+
 /**@brief   Increment inode link count.
  * @param   inode none handle
  */
@@ -77,6 +77,10 @@ static time_t time_fat2unix(uint32_t fattime);
 /**
  * @brief Initialize file system
  *
+ * Options:
+ * @li dio=<bytes>: file data transfers of at least selected size omit system
+ *     cache (default 0: disabled). Transfers are limited to a cluster.
+ *
  * @param[out]          **fs_handle             file system allocated memory
  * @param[in ]           *src_path              file source path
  * @param[in ]           *opts                  file system options (can be NULL)
@@ -86,12 +90,15 @@ static time_t time_fat2unix(uint32_t fattime);
 //==============================================================================
 API_FS_INIT(fatfs, void **fs_handle, const char *src_path, const char *opts)
 {
-        UNUSED_ARG1(opts);
-
         int err = sys_zalloc(sizeof(struct fatfs), fs_handle);
         if (err == ESUCC) {
                 struct fatfs *hdl = *fs_handle;
 
+                int dio = sys_stropt_get_int(opts, "dio", 0);
+                if (dio > 0) {
+                        hdl->fatfs.dio_min = max(1, dio / _LIBFAT_MAX_SS);
+                }
+
                 err = sys_fopen(src_path, "r+", &hdl->fsfile);
                 if (err == ESUCC) {
                         err = faterr_2_errno(libfat_mount(hdl->fsfile, &hdl->fatfs));
@@ -184,6 +191,7 @@ API_FS_OPEN(fatfs, void *fs_handle, void **fhdl, fpos_t *fpos, const char *path,
         if (flags & O_APPEND) {
                 err = faterr_2_errno(libfat_lseek(fat_file, libfat_size(fat_file)));
                 if (err) {
+                        libfat_close(fat_file);
                         sys_free(fhdl);
                         return err;
                 }
@@ -312,6 +320,104 @@ API_FS_READ(fatfs,
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief Write data from buffer vector to the file
+ *
+ * @param[in ]          *fs_handle              file system allocated memory
+ * @param[in ]          *fhdl                   file handle
+ * @param[in ]          *iov                    buffer vector
+ * @param[in ]           iovcnt                 number of buffers
+ * @param[in ]          *fpos                   position in file
+ * @param[out]          *wrcnt                  number of written bytes
+ * @param[in ]           fattr                  file attributes
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+API_FS_WRITEV(fatfs,
+              void               *fs_handle,
+              void               *fhdl,
+              const struct iovec *iov,
+              int                 iovcnt,
+              fpos_t             *fpos,
+              size_t             *wrcnt,
+              struct vfs_fattr    fattr)
+{
+        UNUSED_ARG2(fs_handle, fattr);
+
+        FATFILE *fat_file = fhdl;
+        int      err      = ESUCC;
+
+        if (libfat_tell(fat_file) != (u32_t)*fpos) {
+                err = faterr_2_errno(libfat_lseek(fat_file, (u32_t)*fpos));
+        }
+
+        for (int i = 0; (err == ESUCC) && (i < iovcnt); i++) {
+                uint n = 0;
+                err = faterr_2_errno(libfat_write(fat_file, iov[i].iov_base,
+                                                  iov[i].iov_len, &n));
+                if (err == ESUCC) {
+                        *wrcnt += n;
+
+                        if (n < iov[i].iov_len) {
+                                break;
+                        }
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Read data from file to buffer vector
+ *
+ * @param[in ]          *fs_handle              file system allocated memory
+ * @param[in ]          *fhdl                   file handle
+ * @param[in ]          *iov                    buffer vector
+ * @param[in ]           iovcnt                 number of buffers
+ * @param[in ]          *fpos                   position in file
+ * @param[out]          *rdcnt                  number of read bytes
+ * @param[in ]           fattr                  file attributes
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+API_FS_READV(fatfs,
+             void               *fs_handle,
+             void               *fhdl,
+             const struct iovec *iov,
+             int                 iovcnt,
+             fpos_t             *fpos,
+             size_t             *rdcnt,
+             struct vfs_fattr    fattr)
+{
+        UNUSED_ARG2(fs_handle, fattr);
+
+        FATFILE *fat_file = fhdl;
+        int      err      = ESUCC;
+
+        if (libfat_tell(fat_file) != (u32_t)*fpos) {
+                err = faterr_2_errno(libfat_lseek(fat_file, (u32_t)*fpos));
+        }
+
+        for (int i = 0; (err == ESUCC) && (i < iovcnt); i++) {
+                uint n = 0;
+                err = faterr_2_errno(libfat_read(fat_file, iov[i].iov_base,
+                                                 iov[i].iov_len, &n));
+                if (err == ESUCC) {
+                        *rdcnt += n;
+
+                        if (n < iov[i].iov_len) {
+                                break;
+                        }
+                }
+        }
+
+        return err;
+}
+
 //==============================================================================
 /**
  * @brief IO operations on files
@@ -409,11 +409,24 @@ static void     clear_lock      (FATFS *fs);
 #endif
 static FRESULT  sync_window     (FATFS *fs);
 static FRESULT  move_window     (FATFS *fs, uint32_t sector);
+static DRESULT  data_read       (FATFS *fs, uint8_t *buff, uint32_t sector, uint8_t count);
+static DRESULT  data_write      (FATFS *fs, const uint8_t *buff, uint32_t sector, uint8_t count);
 static uint32_t clust2sect      (FATFS *fs, uint32_t clst);
 static uint32_t get_fat         (FATFS *fs, uint32_t clst);
 static FRESULT  put_fat         (FATFS *fs, uint32_t clst, uint32_t val);
 static FRESULT  remove_chain    (FATFS *fs, uint32_t clst);
+static uint32_t find_free_clust (FATFS *fs, uint32_t scl);
 static uint32_t create_chain    (FATFS *fs, uint32_t clst);
+static uint32_t file_clust      (FATFILE *fp, uint32_t clst, uint32_t idx, int stretch);
+#if _LIBFAT_USE_FASTSEEK
+static FRESULT  fbmp_load       (FATFS *fs);
+static void     fbmp_mark       (FATFS *fs, uint32_t clst, int free);
+static uint32_t fbmp_scan       (FATFS *fs, uint32_t from, uint32_t to);
+static FRESULT  clmt_build      (FATFILE *fp);
+static void     clmt_drop       (FATFILE *fp);
+static uint32_t clmt_get        (FATFILE *fp, uint32_t idx);
+static void     clmt_add        (FATFILE *fp, uint32_t idx, uint32_t clst);
+#endif
 static FRESULT  dir_sdi         (FATDIR *dj, uint16_t idx);
 static FRESULT  dir_next        (FATDIR *dj, int stretch);
 static FRESULT  dir_alloc       (FATDIR *dj, uint nent);
@@ -715,6 +728,48 @@ static FRESULT move_window(FATFS *fs, uint32_t sector)
         return FR_OK;
 }
 
+//==============================================================================
+/**
+ * @brief Read file data sectors. Large transfers omit system cache.
+ *
+ * @param[in]  *fs       File system object
+ * @param[out] *buff     Destination buffer
+ * @param[in]   sector   Sector number
+ * @param[in]   count    Number of sectors
+ *
+ * @retval RES_OK       success
+ * @retval RES_ERROR
+ */
+//==============================================================================
+static DRESULT data_read(FATFS *fs, uint8_t *buff, uint32_t sector, uint8_t count)
+{
+        if (fs->dio_min && count >= fs->dio_min)
+                return _libfat_disk_read_direct(fs->srcfile, buff, sector, count);
+
+        return _libfat_disk_read(fs->srcfile, buff, sector, count);
+}
+
+//==============================================================================
+/**
+ * @brief Write file data sectors. Large transfers omit system cache.
+ *
+ * @param[in] *fs       File system object
+ * @param[in] *buff     Source buffer
+ * @param[in]  sector   Sector number
+ * @param[in]  count    Number of sectors
+ *
+ * @retval RES_OK       success
+ * @retval RES_ERROR
+ */
+//==============================================================================
+static DRESULT data_write(FATFS *fs, const uint8_t *buff, uint32_t sector, uint8_t count)
+{
+        if (fs->dio_min && count >= fs->dio_min)
+                return _libfat_disk_write_direct(fs->srcfile, buff, sector, count);
+
+        return _libfat_disk_write(fs->srcfile, buff, sector, count);
+}
+
 //==============================================================================
 /**
  * @brief Synchronize file system and storage device
@@ -898,6 +953,10 @@ static FRESULT put_fat(FATFS *fs, uint32_t clst, uint32_t val)
                 }
 
                 fs->wflag = 1;
+#if _LIBFAT_USE_FASTSEEK
+                if (res == FR_OK)
+                        fbmp_mark(fs, clst, (val & 0x0FFFFFFF) == 0);
+#endif
         }
 
         return res;
@@ -969,6 +1028,52 @@ static FRESULT remove_chain(FATFS *fs, uint32_t clst)
         return res;
 }
 
+//==============================================================================
+/**
+ * @brief FAT handling - Find free cluster
+ *
+ * @param[in] *fs       File system object
+ * @param[in]  scl      Cluster number from which search is started
+ *
+ * @return 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Free cluster number
+ */
+//==============================================================================
+static uint32_t find_free_clust(FATFS *fs, uint32_t scl)
+{
+        uint32_t cs, ncl;
+
+#if _LIBFAT_USE_FASTSEEK
+        if (fs->fbmp) {
+                /* Next fit search in the free cluster bitmap */
+                ncl = fbmp_scan(fs, scl + 1, fs->n_fatent);
+                if (ncl == 0) {
+                        ncl = fbmp_scan(fs, 2, scl + 1);
+                }
+
+                return ncl;
+        }
+#endif
+
+        ncl = scl;
+        for (;;) {
+                ncl++;
+                if (ncl >= fs->n_fatent) {
+                        ncl = 2;
+                        if (ncl > scl) return 0;
+                }
+
+                cs = get_fat(fs, ncl);
+                if (cs == 0)
+                        return ncl;
+
+                if (cs == 0xFFFFFFFF || cs == 1)
+                        return cs;
+
+                if (ncl == scl)
+                        return 0;
+        }
+}
+
 //==============================================================================
 /**
  * @brief FAT handling - Stretch or Create a cluster chain
@@ -998,24 +1103,9 @@ static uint32_t create_chain(FATFS *fs, uint32_t clst)
                 scl = clst;
         }
 
-        ncl = scl;
-        for (;;) {
-                ncl++;
-                if (ncl >= fs->n_fatent) {
-                        ncl = 2;
-                        if (ncl > scl) return 0;
-                }
-
-                cs = get_fat(fs, ncl);
-                if (cs == 0)
-                        break;
-
-                if (cs == 0xFFFFFFFF || cs == 1)
-                        return cs;
-
-                if (ncl == scl)
-                        return 0;
-        }
+        ncl = find_free_clust(fs, scl);
+        if (ncl < 2 || ncl == 0xFFFFFFFF)
+                return ncl;
 
         res = put_fat(fs, ncl, 0x0FFFFFFF);
         if (res == FR_OK && clst != 0) {
@@ -1037,6 +1127,315 @@ static uint32_t create_chain(FATFS *fs, uint32_t clst)
         return ncl;
 }
 
+//==============================================================================
+/**
+ * @brief File handling - Follow or stretch cluster chain of file
+ *
+ * @param[in] *fp       Pointer to the file object
+ * @param[in]  clst     Current cluster of file (cluster of index idx - 1)
+ * @param[in]  idx      Index of requested file cluster
+ * @param[in]  stretch  0: follow chain only, 1: stretch chain if needed
+ *
+ * @return 0:No free cluster (or free cluster if stretch is 0), 1:Internal error,
+ *         0xFFFFFFFF:Disk error, >=2:Cluster number
+ */
+//==============================================================================
+static uint32_t file_clust(FATFILE *fp, uint32_t clst, uint32_t idx, int stretch)
+{
+        uint32_t ncl;
+
+#if _LIBFAT_USE_FASTSEEK
+        /* Cluster described by map */
+        ncl = clmt_get(fp, idx);
+        if (ncl)
+                return ncl;
+#else
+        (void)idx;
+#endif
+
+        ncl = stretch ? create_chain(fp->fs, clst) : get_fat(fp->fs, clst);
+
+#if _LIBFAT_USE_FASTSEEK
+        /* Extend map if cluster follows the last mapped one */
+        if (ncl >= 2 && ncl < fp->fs->n_fatent)
+                clmt_add(fp, idx, ncl);
+#endif
+
+        return ncl;
+}
+
+#if _LIBFAT_USE_FASTSEEK
+//==============================================================================
+/**
+ * @brief Free cluster bitmap - Load bitmap from FAT
+ *
+ * Bitmap is not loaded if it is greater than _LIBFAT_FREE_MAP_SIZE bytes or
+ * there is not enough free memory, then FAT is scanned at cluster allocation.
+ *
+ * @param[in] *fs       File system object
+ *
+ * @retval FR_OK
+ * @retval FR_DISK_ERR
+ */
+//==============================================================================
+static FRESULT fbmp_load(FATFS *fs)
+{
+        FRESULT  res  = FR_OK;
+        uint32_t size = ((fs->n_fatent + 31) / 32) * sizeof(uint32_t);
+        uint32_t n    = 0;
+
+        fs->fbmp = NULL;
+
+        if (size > _LIBFAT_FREE_MAP_SIZE)
+                return FR_OK;
+
+        fs->fbmp = _libfat_malloc(size);
+        if (!fs->fbmp)
+                return FR_OK;
+
+        memset(fs->fbmp, 0, size);
+
+        /* FAT sectors are read in sequence, each once */
+        for (uint32_t clst = 2; clst < fs->n_fatent; clst++) {
+                uint32_t stat = get_fat(fs, clst);
+                if (stat == 0xFFFFFFFF) {
+                        res = FR_DISK_ERR;
+                        break;
+                }
+
+                if (stat == 0) {
+                        fs->fbmp[clst / 32] |= (uint32_t)1 << (clst % 32);
+                        n++;
+                }
+        }
+
+        if (res == FR_OK) {
+                /* Number of free clusters is known exactly now */
+                if (fs->fs_type == LIBFAT_FS_FAT32 && fs->free_clust != n)
+                        fs->fsi_flag = 1;
+
+                fs->free_clust = n;
+        } else {
+                _libfat_free(fs->fbmp);
+                fs->fbmp = NULL;
+        }
+
+        return res;
+}
+
+//==============================================================================
+/**
+ * @brief Free cluster bitmap - Mark cluster state
+ *
+ * @param[in] *fs       File system object
+ * @param[in]  clst     Cluster number
+ * @param[in]  free     1: cluster is free, 0: cluster is used
+ */
+//==============================================================================
+static void fbmp_mark(FATFS *fs, uint32_t clst, int free)
+{
+        if (fs->fbmp) {
+                if (free) {
+                        fs->fbmp[clst / 32] |= (uint32_t)1 << (clst % 32);
+                } else {
+                        fs->fbmp[clst / 32] &= ~((uint32_t)1 << (clst % 32));
+                }
+        }
+}
+
+//==============================================================================
+/**
+ * @brief Free cluster bitmap - Find the first free cluster in range
+ *
+ * @param[in] *fs       File system object
+ * @param[in]  from     First cluster of range
+ * @param[in]  to       Cluster after range
+ *
+ * @return 0:No free cluster in range, >=2:Free cluster number
+ */
+//==============================================================================
+static uint32_t fbmp_scan(FATFS *fs, uint32_t from, uint32_t to)
+{
+        if (to > fs->n_fatent)
+                to = fs->n_fatent;
+
+        while (from < to) {
+                uint32_t w = fs->fbmp[from / 32] >> (from % 32);
+                if (w) {
+                        while (!(w & 1)) {
+                                w >>= 1;
+                                from++;
+                        }
+
+                        return from < to ? from : 0;
+                }
+
+                /* Whole word used, skip to the next one */
+                from = (from | 31) + 1;
+        }
+
+        return 0;
+}
+
+//==============================================================================
+/**
+ * @brief Cluster link map - Build map of file cluster chain
+ *
+ * Chain is followed once, next seeks use map. If there is not enough free
+ * memory then map is not created and FAT is followed as usual.
+ *
+ * @param[in] *fp       Pointer to the file object
+ *
+ * @retval FR_OK
+ * @retval FR_DISK_ERR
+ * @retval FR_INT_ERR
+ */
+//==============================================================================
+static FRESULT clmt_build(FATFILE *fp)
+{
+        if (fp->clmt || !fp->sclust)
+                return FR_OK;
+
+        fp->clmt_size = _LIBFAT_FASTSEEK_FRAGS < 4 ? _LIBFAT_FASTSEEK_FRAGS : 4;
+        fp->clmt_len  = 0;
+        fp->clmt_ncl  = 0;
+        fp->clmt      = _libfat_malloc(fp->clmt_size * sizeof(CLMTFRAG));
+        if (!fp->clmt)
+                return FR_OK;
+
+        uint32_t clst = fp->sclust;
+        uint32_t idx  = 0;
+
+        for (;;) {
+                clmt_add(fp, idx, clst);
+                if (fp->clmt_ncl != idx + 1) {
+                        /* Map is full */
+                        break;
+                }
+
+                clst = get_fat(fp->fs, clst);
+                if (clst == 0xFFFFFFFF) {
+                        clmt_drop(fp);
+                        return FR_DISK_ERR;
+                }
+
+                if (clst < 2) {
+                        clmt_drop(fp);
+                        return FR_INT_ERR;
+                }
+
+                if (clst >= fp->fs->n_fatent) {
+                        /* End of chain */
+                        break;
+                }
+
+                idx++;
+        }
+
+        return FR_OK;
+}
+
+//==============================================================================
+/**
+ * @brief Cluster link map - Release map
+ *
+ * @param[in] *fp       Pointer to the file object
+ */
+//==============================================================================
+static void clmt_drop(FATFILE *fp)
+{
+        if (fp->clmt) {
+                _libfat_free(fp->clmt);
+        }
+
+        fp->clmt      = NULL;
+        fp->clmt_ncl  = 0;
+        fp->clmt_len  = 0;
+        fp->clmt_size = 0;
+}
+
+//==============================================================================
+/**
+ * @brief Cluster link map - Get cluster of file cluster index
+ *
+ * @param[in] *fp       Pointer to the file object
+ * @param[in]  idx      File cluster index
+ *
+ * @return 0:Cluster not described by map, >=2:Cluster number
+ */
+//==============================================================================
+static uint32_t clmt_get(FATFILE *fp, uint32_t idx)
+{
+        if (!fp->clmt || idx >= fp->clmt_ncl)
+                return 0;
+
+        /* Binary search of the last fragment started at or before index */
+        uint lo = 0;
+        uint hi = fp->clmt_len - 1;
+        while (lo < hi) {
+                uint mid = (lo + hi + 1) / 2;
+                if (fp->clmt[mid].fidx <= idx) {
+                        lo = mid;
+                } else {
+                        hi = mid - 1;
+                }
+        }
+
+        return fp->clmt[lo].clust + (idx - fp->clmt[lo].fidx);
+}
+
+//==============================================================================
+/**
+ * @brief Cluster link map - Add cluster at the end of map
+ *
+ * Cluster is added only if it directly follows the last mapped cluster.
+ * If map is full then cluster is not added and map describes beginning of
+ * the chain only.
+ *
+ * @param[in] *fp       Pointer to the file object
+ * @param[in]  idx      File cluster index
+ * @param[in]  clst     Cluster number
+ */
+//==============================================================================
+static void clmt_add(FATFILE *fp, uint32_t idx, uint32_t clst)
+{
+        if (!fp->clmt || idx != fp->clmt_ncl)
+                return;
+
+        if (fp->clmt_len) {
+                CLMTFRAG *last = &fp->clmt[fp->clmt_len - 1];
+                if (last->clust + (idx - last->fidx) == clst) {
+                        /* Continuous cluster, extend the last fragment */
+                        fp->clmt_ncl++;
+                        return;
+                }
+        }
+
+        if (fp->clmt_len == fp->clmt_size) {
+                if (fp->clmt_size >= _LIBFAT_FASTSEEK_FRAGS)
+                        return;
+
+                uint16_t  size = fp->clmt_size * 2;
+                if (size > _LIBFAT_FASTSEEK_FRAGS)
+                        size = _LIBFAT_FASTSEEK_FRAGS;
+
+                CLMTFRAG *clmt = _libfat_malloc(size * sizeof(CLMTFRAG));
+                if (!clmt)
+                        return;
+
+                memcpy(clmt, fp->clmt, fp->clmt_len * sizeof(CLMTFRAG));
+                _libfat_free(fp->clmt);
+                fp->clmt      = clmt;
+                fp->clmt_size = size;
+        }
+
+        fp->clmt[fp->clmt_len].fidx  = idx;
+        fp->clmt[fp->clmt_len].clust = clst;
+        fp->clmt_len++;
+        fp->clmt_ncl++;
+}
+#endif
+
 //==============================================================================
 /**
  * @brief Directory handling - Set directory index
@@ -2439,7 +2838,12 @@ static FRESULT chk_mounted(FATFS *fs)
         clear_lock(fs);
 #endif
 
+#if _LIBFAT_USE_FASTSEEK
+        /* Load free cluster bitmap */
+        return fbmp_load(fs);
+#else
         return FR_OK;
+#endif
 }
 
 //==============================================================================
@@ -2507,6 +2911,10 @@ FRESULT libfat_umount(FATFS *fs)
         if (fs) {
                 libfat_sync(fs);
                 _libfat_delete_mutex(fs->sobj);
+#if _LIBFAT_USE_FASTSEEK
+                _libfat_free(fs->fbmp);
+                fs->fbmp = NULL;
+#endif
                 return FR_OK;
         }
 
@@ -2681,6 +3089,10 @@ FRESULT libfat_open(FATFS *fs, FATFILE *fp, const TCHAR *path, uint8_t mode)
                 fp->fsize  = LOAD_UINT32(dir+DIR_FileSize);     /* File size */
                 fp->fptr   = 0;                                 /* File pointer */
                 fp->dsect  = 0;
+#if _LIBFAT_USE_FASTSEEK
+                fp->clmt   = NULL;                              /* Cluster link map is built on seek */
+                fp->clmt_ncl = fp->clmt_len = fp->clmt_size = 0;
+#endif
 
                 /* Validate file object */
                 fp->fs = dj.fs;
@@ -2755,7 +3167,7 @@ FRESULT libfat_read(FATFILE *fp, void *buff, uint btr, uint *br)
                                         clst = fp->sclust;
                                 } else {
                                         /* Follow cluster chain on the FAT */
-                                        clst = get_fat(fp->fs, fp->clust);
+                                        clst = file_clust(fp, fp->clust, fp->fptr / SS(fp->fs) / fp->fs->csize, 0);
                                 }
 
                                 if (clst < 2) {
@@ -2787,7 +3199,7 @@ FRESULT libfat_read(FATFILE *fp, void *buff, uint btr, uint *br)
                                         cc = fp->fs->csize - csect;
                                 }
 
-                                if (_libfat_disk_read(fp->fs->srcfile, rbuff, sect, (uint8_t)cc) != RES_OK) {
+                                if (data_read(fp->fs, rbuff, sect, (uint8_t)cc) != RES_OK) {
                                         ABORT(fp->fs, FR_DISK_ERR);
                                 }
 #if _LIBFAT_FS_TINY
@@ -2910,7 +3322,7 @@ FRESULT libfat_write(FATFILE *fp, const void *buff, uint btw, uint *bw)
                                         }
                                 } else {
                                         /* Follow or stretch cluster chain on the FAT */
-                                        clst = create_chain(fp->fs, fp->clust);
+                                        clst = file_clust(fp, fp->clust, fp->fptr / SS(fp->fs) / fp->fs->csize, 1);
                                 }
 
                                 if (clst == 0) {
@@ -2962,7 +3374,7 @@ FRESULT libfat_write(FATFILE *fp, const void *buff, uint btw, uint *bw)
                                         cc = fp->fs->csize - csect;
                                 }
 
-                                if (_libfat_disk_write(fp->fs->srcfile, wbuff, sect, (uint8_t)cc) != RES_OK) {
+                                if (data_write(fp->fs, wbuff, sect, (uint8_t)cc) != RES_OK) {
                                         ABORT(fp->fs, FR_DISK_ERR);
                                 }
 #if _LIBFAT_FS_TINY
@@ -3120,6 +3532,10 @@ FRESULT libfat_close(FATFILE *fp)
                         unlock_fs(fs, FR_OK);
                 }
         }
+#endif
+#if _LIBFAT_USE_FASTSEEK
+        /* Map is released also on error, file object is discarded by caller */
+        clmt_drop(fp);
 #endif
         if (res == FR_OK) {
                 /* Discard file object */
@@ -3194,7 +3610,28 @@ FRESULT libfat_lseek(FATFILE *fp, uint32_t ofs)
 
                         fp->clust = clst;
                 }
+#if _LIBFAT_USE_FASTSEEK
+                /* Jump over clusters described by cluster link map */
+                if (clst != 0 && ofs > bcs) {
+                        res = clmt_build(fp);
+                        if (res != FR_OK) {
+                                ABORT(fp->fs, res);
+                        }
 
+                        uint32_t cidx = fp->fptr / bcs;
+                        uint32_t tidx = (fp->fptr + ofs - 1) / bcs;
+                        if (fp->clmt_ncl && tidx >= fp->clmt_ncl) {
+                                tidx = fp->clmt_ncl - 1;
+                        }
+
+                        if (fp->clmt_ncl && tidx > cidx) {
+                                clst      = clmt_get(fp, tidx);
+                                fp->clust = clst;
+                                fp->fptr += (tidx - cidx) * bcs;
+                                ofs      -= (tidx - cidx) * bcs;
+                        }
+                }
+#endif
                 if (clst != 0) {
                         /* Cluster following loop */
                         while (ofs > bcs) {
@@ -3202,7 +3639,7 @@ FRESULT libfat_lseek(FATFILE *fp, uint32_t ofs)
                                 /* Check if in write mode or not */
                                 if (fp->flag & LIBFAT_FA_WRITE) {
                                         /* Force stretch if in write mode */
-                                        clst = create_chain(fp->fs, clst);
+                                        clst = file_clust(fp, clst, fp->fptr / bcs + 1, 1);
                                         if (clst == 0) {
                                                 /* When disk gets full, clip file size */
                                                 ofs = bcs;
@@ -3210,7 +3647,7 @@ FRESULT libfat_lseek(FATFILE *fp, uint32_t ofs)
                                         }
                                 } else {
                                         /* Follow cluster chain if not in write mode */
-                                        clst = get_fat(fp->fs, clst);
+                                        clst = file_clust(fp, clst, fp->fptr / bcs + 1, 0);
                                 }
 
                                 if (clst == 0xFFFFFFFF) {
@@ -3549,6 +3986,10 @@ FRESULT libfat_truncate(FATFILE *fp)
                 if (fp->fsize > fp->fptr) {
                         /* Set file size to current R/W point */
                         fp->fsize = fp->fptr;
+#if _LIBFAT_USE_FASTSEEK
+                        /* Released clusters can be still described by map */
+                        clmt_drop(fp);
+#endif
 
                         fp->flag |= LIBFAT_FA__WRITTEN;
                         if (fp->fptr == 0) {
@@ -133,7 +133,11 @@ typedef struct FATFS {
         uint32_t        dirbase;                /* Root directory start sector (FAT32:Cluster#) */
         uint32_t        database;               /* Data start sector */
         uint32_t        winsect;                /* Current sector appearing in the win[] */
+        uint32_t        dio_min;                /* Minimal number of data sectors transferred directly (0:disabled) */
         uint8_t         win[_LIBFAT_MAX_SS];    /* Disk access window for Directory, FAT (and Data on tiny cfg) */
+#if _LIBFAT_USE_FASTSEEK
+        uint32_t       *fbmp;                   /* Free cluster bitmap (1:free cluster, NULL:not loaded) */
+#endif
         /* File access control feature */
 #if _LIBFAT_FS_LOCK
         struct FILESEM {
@@ -146,6 +150,12 @@ typedef struct FATFS {
 } FATFS;
 
 /* File object structure */
+/* Cluster link map fragment (continuous cluster run of file) */
+typedef struct {
+        uint32_t        fidx;                   /* Index of the first file cluster of fragment */
+        uint32_t        clust;                  /* First cluster of fragment */
+} CLMTFRAG;
+
 typedef struct {
         FATFS          *fs;                     /* Pointer to the related file system object (**do not change order**) */
         uint16_t        id;                     /* Owner file system mount ID (**do not change order**) */
@@ -160,6 +170,12 @@ typedef struct {
         uint32_t        dsect;                  /* Current data sector of fpter */
         uint32_t        dir_sect;               /* Sector containing the directory entry */
         uint8_t        *dir_ptr;                /* Pointer to the directory entry in the window */
+#if _LIBFAT_USE_FASTSEEK
+        CLMTFRAG       *clmt;                   /* Cluster link map (NULL:not built) */
+        uint32_t        clmt_ncl;               /* Number of file clusters described by map */
+        uint16_t        clmt_len;               /* Number of used map fragments */
+        uint16_t        clmt_size;              /* Number of allocated map fragments */
+#endif
 #if _LIBFAT_FS_LOCK
         uint            lockid;                 /* File lock ID (index of file semaphore table Files[]) */
 #endif
@@ -118,6 +118,23 @@
 #define _LIBFAT_USE_ERASE       0       /* 0:Disable or 1:Enable */
 
 
+/* To enable fast seek feature, set _LIBFAT_USE_FASTSEEK to 1. Each opened file
+ * builds (on first seek) a cluster link map of own cluster chain, so seek and
+ * sequential access do not follow the FAT. Map contains at most
+ * _LIBFAT_FASTSEEK_FRAGS fragments (continuous cluster runs), the rest of
+ * chain is followed on the FAT. At mount a free cluster bitmap is loaded
+ * to RAM if it is not greater than _LIBFAT_FREE_MAP_SIZE bytes, so cluster
+ * allocation does not scan the FAT.
+ */
+#if __FATFS_FAST_SEEK_ENABLE__ == _YES_
+#define _LIBFAT_USE_FASTSEEK    1       /* 0:Disable or 1:Enable */
+#else
+#define _LIBFAT_USE_FASTSEEK    0       /* 0:Disable or 1:Enable */
+#endif
+#define _LIBFAT_FASTSEEK_FRAGS  64      /* Maximum number of map fragments per file */
+#define _LIBFAT_FREE_MAP_SIZE   8192    /* Maximum size of free cluster bitmap in bytes */
+
+
 /*---------------------------------------------------------------------------/
 / System Configurations
 /----------------------------------------------------------------------------*/
@@ -103,6 +103,44 @@ DRESULT _libfat_disk_write(FILE *srcfile, const uint8_t *buff, uint32_t sector,
                RES_OK : RES_ERROR;
 }
 
+//==============================================================================
+/**
+ * @brief Read Sector(s) directly from device (cache is not used)
+ *
+ * @param[in]  *srcfile         source file object
+ * @param[out] *buff            destination buffer
+ * @param[in]   sector          sector number
+ * @param[in]   count           sector to read
+ *
+ * @retval RES_OK read successful
+ * @retval RES_ERROR read error
+ */
+//==============================================================================
+DRESULT _libfat_disk_read_direct(FILE *srcfile, uint8_t *buff, uint32_t sector, uint8_t count)
+{
+        return sys_cache_direct_read(srcfile, sector, _LIBFAT_MAX_SS, count, buff) == ESUCC ?
+               RES_OK : RES_ERROR;
+}
+
+//==============================================================================
+/**
+ * @brief Write Sector(s) directly to device (cache is not used)
+ *
+ * @param[in]  *srcfile         source file object
+ * @param[in]  *buff            source buffer
+ * @param[in]   sector          sector number
+ * @param[in]   count           sector to write
+ *
+ * @retval RES_OK write successful
+ * @retval RES_ERROR write error
+ */
+//==============================================================================
+DRESULT _libfat_disk_write_direct(FILE *srcfile, const uint8_t *buff, uint32_t sector, uint8_t count)
+{
+        return sys_cache_direct_write(srcfile, sector, _LIBFAT_MAX_SS, count, buff) == ESUCC ?
+               RES_OK : RES_ERROR;
+}
+
 //==============================================================================
 /**
  * @brief Miscellaneous Functions
@@ -104,13 +104,15 @@ typedef enum {
 ==============================================================================*/
 extern DRESULT  _libfat_disk_read       (FILE*, uint8_t*, uint32_t, uint8_t);
 extern DRESULT  _libfat_disk_write      (FILE*, const uint8_t*, uint32_t, uint8_t);
+extern DRESULT  _libfat_disk_read_direct (FILE*, uint8_t*, uint32_t, uint8_t);
+extern DRESULT  _libfat_disk_write_direct(FILE*, const uint8_t*, uint32_t, uint8_t);
 extern DRESULT  _libfat_disk_ioctl      (FILE*, uint8_t, void*);
 extern int      _libfat_create_mutex    (_LIBFAT_MUTEX_t*);
 extern int      _libfat_lock_access     (_LIBFAT_MUTEX_t);
 extern void     _libfat_unlock_access   (_LIBFAT_MUTEX_t);
 extern int      _libfat_delete_mutex    (_LIBFAT_MUTEX_t);
 extern uint32_t _libfat_get_fattime     (void);
-#if _LIBFAT_USE_LFN == 2
+#if (_LIBFAT_USE_LFN == 2) || _LIBFAT_USE_FASTSEEK
 extern void *   _libfat_malloc          (uint);
 extern void     _libfat_free            (void*);
 #endif
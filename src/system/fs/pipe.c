@@ -34,6 +34,7 @@
 #include "dnx/misc.h"
 #include "libc/errno.h"
 #include "kernel/kwrapper.h"
+#include "kernel/kpoll.h"
 #include "fs/pipe.h"
 
 /*==============================================================================
@@ -182,12 +183,24 @@ int _pipe_read(pipe_t *pipe, u8_t *buf, size_t count, size_t *rdcnt, bool non_bl
                                 break;
                         }
 
-                        u32_t tout = non_blocking || n ? 10 : PIPE_READ_TIMEOUT;
-                        if (_queue_receive(pipe->queue, &buf[n], tout) != ESUCC) {
-                                break;
+                        if (_queue_receive(pipe->queue, &buf[n], 0) != ESUCC) {
+                                // writers waiting for free space are notified
+                                // before pipe waits for next data
+                                if (n > 0) {
+                                        _kpoll_notify(pipe);
+                                }
+
+                                u32_t tout = non_blocking || n ? 10 : PIPE_READ_TIMEOUT;
+                                if (_queue_receive(pipe->queue, &buf[n], tout) != ESUCC) {
+                                        break;
+                                }
                         }
                 }
 
+                if (n > 0) {
+                        _kpoll_notify(pipe);
+                }
+
                 *rdcnt = n;
                 return ESUCC;
         } else {
@@ -222,12 +235,24 @@ int _pipe_write(pipe_t *pipe, const u8_t *buf, size_t count, size_t *wrcnt, bool
                                 break;
                         }
 
-                        u32_t tout = non_blocking ? 10 : PIPE_WRITE_TIMEOUT;
-                        if (_queue_send(pipe->queue, &buf[n], tout) != ESUCC) {
-                                break;
+                        if (_queue_send(pipe->queue, &buf[n], 0) != ESUCC) {
+                                // readers are notified before pipe waits for
+                                // free space
+                                if (n > 0) {
+                                        _kpoll_notify(pipe);
+                                }
+
+                                u32_t tout = non_blocking ? 10 : PIPE_WRITE_TIMEOUT;
+                                if (_queue_send(pipe->queue, &buf[n], tout) != ESUCC) {
+                                        break;
+                                }
                         }
                 }
 
+                if (n > 0) {
+                        _kpoll_notify(pipe);
+                }
+
                 *wrcnt = n;
                 return ESUCC;
         } else {
@@ -250,7 +275,9 @@ int _pipe_close(pipe_t *pipe)
                 pipe->closed = true;
 
                 const u8_t nul = '\0';
-                return _queue_send(pipe->queue, &nul, PIPE_WRITE_TIMEOUT);
+                int err = _queue_send(pipe->queue, &nul, PIPE_WRITE_TIMEOUT);
+                _kpoll_notify(pipe);
+                return err;
         } else {
                 return EINVAL;
         }
@@ -268,7 +295,50 @@ int _pipe_close(pipe_t *pipe)
 int _pipe_clear(pipe_t *pipe)
 {
         if (is_valid(pipe)) {
-                return _queue_reset(pipe->queue);
+                int err = _queue_reset(pipe->queue);
+                _kpoll_notify(pipe);
+                return err;
+        } else {
+                return EINVAL;
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Return readiness of pipe. Pipe is readable if contains data or is
+ *         closed and writable if has free space.
+ *
+ * @param  pipe         a pipe object
+ * @param  revents      ready events (POLLIN, POLLOUT, POLLHUP)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int _pipe_poll(pipe_t *pipe, int *revents)
+{
+        if (is_valid(pipe) && revents) {
+                _kpoll_watch(pipe);
+
+                size_t items = 0;
+                size_t space = 0;
+                _queue_get_number_of_items(pipe->queue, &items);
+                _queue_get_space_available(pipe->queue, &space);
+
+                *revents = 0;
+
+                if (items > 0 || pipe->closed) {
+                        *revents |= POLLIN;
+                }
+
+                if (space > 0 && !pipe->closed) {
+                        *revents |= POLLOUT;
+                }
+
+                if (pipe->closed) {
+                        *revents |= POLLHUP;
+                }
+
+                return ESUCC;
         } else {
                 return EINVAL;
         }
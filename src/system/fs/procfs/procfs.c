@@ -30,6 +30,7 @@
   Include files
 ==============================================================================*/
 #include "fs/fs.h"
+#include "dnx/procstat.h"
 
 /*==============================================================================
   Local symbolic constants/macros
@@ -40,6 +41,8 @@
 #define PATH_ROOT_BIN                   "/bin"
 #define PATH_ROOT_PID                   "/pid"
 #define PATH_ROOT_CPUINFO               "/cpuinfo"
+#define PATH_ROOT_STAT                  "/stat"
+#define PATH_ROOT_SYSCALLS              "/syscalls"
 
 #define FILE_BUFFER                     384
 #define PID_STR_LEN                     12
@@ -58,12 +61,25 @@ enum path_content {
         FILE_CONTENT_BIN,
         FILE_CONTENT_PID,
         FILE_CONTENT_CPUINFO,
+        FILE_CONTENT_STAT,
+        FILE_CONTENT_SYSCALLS,
         _FILE_CONTENT_COUNT
 };
 
 struct file_info {
         enum path_content content;
         int16_t           arg;
+        bool              rec_valid;    //!< record buffer contains record
+        size_t            rec_idx;      //!< index of buffered record
+        fpos_t            rec_pos;      //!< file position of buffered record
+        size_t            rec_len;      //!< length of buffered record
+        char             *rec_buf;      //!< record buffer
+};
+
+struct stat_file {
+        const char *name;               //!< file name
+        size_t      rec_size;           //!< record size
+        int       (*get)(size_t idx, void *rec);
 };
 
 struct dir_info {
@@ -77,12 +93,39 @@ struct dir_info {
 static int    procfs_readdir_root(struct procfs *hdl, DIR *dir);
 static int    procfs_readdir_pid (struct procfs *hdl, DIR *dir);
 static int    procfs_readdir_bin (struct procfs *hdl, DIR *dir);
+static int    procfs_readdir_stat(struct procfs *hdl, DIR *dir);
 static int    add_file_to_list   (struct procfs *hdl, int16_t arg, enum path_content content, void **object);
-static size_t get_file_content   (struct file_info *file_info, char *buff, size_t size);
+static int    get_record         (struct file_info *file, size_t idx, char *buf, size_t size, size_t *len);
+static int    read_content       (struct file_info *file, u8_t *dst, size_t count, fpos_t fpos, size_t *rdcnt);
+static size_t get_content_size   (struct file_info *file);
+static int    get_stat_proc      (size_t idx, void *rec);
+static int    get_stat_mem       (size_t idx, void *rec);
+static int    get_stat_cache     (size_t idx, void *rec);
+static int    get_stat_net       (size_t idx, void *rec);
+static int    get_stat_blkq      (size_t idx, void *rec);
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+static int    get_stat_syscall   (size_t idx, void *rec);
+#endif
+#if __OS_TRACE_ENABLE__ > 0
+static int    get_stat_trace     (size_t idx, void *rec);
+#endif
 
 /*==============================================================================
   Local object definitions
 ==============================================================================*/
+static const struct stat_file STAT_FILE[] = {
+        {.name = "proc",  .rec_size = sizeof(procstat_proc_t),  .get = get_stat_proc },
+        {.name = "mem",   .rec_size = sizeof(procstat_mem_t),   .get = get_stat_mem  },
+        {.name = "cache", .rec_size = sizeof(procstat_cache_t), .get = get_stat_cache},
+        {.name = "net",   .rec_size = sizeof(procstat_net_t),   .get = get_stat_net  },
+        {.name = "blkq",  .rec_size = sizeof(procstat_blkq_t),  .get = get_stat_blkq },
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+        {.name = "syscall", .rec_size = sizeof(procstat_syscall_t), .get = get_stat_syscall},
+#endif
+#if __OS_TRACE_ENABLE__ > 0
+        {.name = "trace", .rec_size = sizeof(procstat_trace_t), .get = get_stat_trace},
+#endif
+};
 
 /*==============================================================================
   Exported object definitions
@@ -123,7 +166,8 @@ API_FS_INIT(procfs, void **fs_handle, const char *src_path, const char *opts)
 
                         if (!(  isstreq(opts, PATH_ROOT)
                              || isstreq(opts, PATH_ROOT_BIN)
-                             || isstreq(opts, PATH_ROOT_PID)) ) {
+                             || isstreq(opts, PATH_ROOT_PID)
+                             || isstreq(opts, PATH_ROOT_STAT)) ) {
 
                                 err = ENOENT;
                                 goto finish;
@@ -274,6 +318,27 @@ API_FS_OPEN(procfs, void *fs_handle, void **fhdl, fpos_t *fpos, const char *path
         } else if (isstreq(mpath, PATH_ROOT_CPUINFO)) {
                 err = add_file_to_list(hdl, 0, FILE_CONTENT_CPUINFO, fhdl);
 
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+        // "/syscalls" path
+        } else if (isstreq(mpath, PATH_ROOT_SYSCALLS)) {
+                err = add_file_to_list(hdl, 0, FILE_CONTENT_SYSCALLS, fhdl);
+#endif
+
+        // "/stat" path
+        } else if (isstreq(mpath, PATH_ROOT_STAT)) {
+                err = add_file_to_list(hdl, -1, FILE_CONTENT_STAT, fhdl);
+
+        // "/stat/<file>" path
+        } else if (isstreqn(mpath, PATH_ROOT_STAT"/", strlen(PATH_ROOT_STAT) + 1)) {
+                mpath += strlen(PATH_ROOT_STAT) + 1;
+
+                for (size_t i = 0; i < ARRAY_SIZE(STAT_FILE); i++) {
+                        if (isstreq(mpath, STAT_FILE[i].name)) {
+                                err = add_file_to_list(hdl, i, FILE_CONTENT_STAT, fhdl);
+                                break;
+                        }
+                }
+
         } else {
                 err = ENOENT;
         }
@@ -300,11 +365,16 @@ API_FS_CLOSE(procfs, void *fs_handle, void *fhdl, bool force)
 {
         UNUSED_ARG1(force);
 
-        struct procfs *fsctx = fs_handle;
+        struct procfs    *fsctx = fs_handle;
+        struct file_info *file  = fhdl;
 
         int err = sys_mutex_lock(fsctx->resource_mtx, MAX_DELAY_MS);
         if (!err) {
                 int pos = sys_llist_find_begin(fsctx->file_list, fhdl);
+                if (pos >= 0 && file->rec_buf) {
+                        sys_free(cast(void**, &file->rec_buf));
+                }
+
                 err = sys_llist_erase(fsctx->file_list, pos) ? ESUCC : ENOENT;
 
                 sys_mutex_unlock(fsctx->resource_mtx);
@@ -371,23 +441,8 @@ API_FS_READ(procfs,
         struct file_info *file = fhdl;
         int               err  = ENOENT;
 
-        if (file && file->content < _FILE_CONTENT_COUNT) {
-
-                char *content;
-                err = sys_zalloc(FILE_BUFFER, cast(void**, &content));
-                if (!err) {
-                        size_t data_size = get_file_content(file, content, FILE_BUFFER);
-                        size_t seek      = min(*fpos, SIZE_MAX);
-                        if (seek > data_size) {
-                                *rdcnt = 0;
-                        } else {
-                                size_t n = (data_size - seek <= count) ? data_size - seek : count;
-                                strncpy((char *)dst, content + seek, n);
-                                *rdcnt = n;
-                        }
-
-                        sys_free(cast(void**, &content));
-                }
+        if (file && file->content < _FILE_CONTENT_COUNT && file->arg >= 0) {
+                err = read_content(file, dst, count, *fpos, rdcnt);
         }
 
         return err;
@@ -454,39 +509,33 @@ API_FS_FSTAT(procfs, void *fs_handle, void *fhdl, struct stat *stat)
         stat->st_gid   = 0;
         stat->st_uid   = 0;
 
-        char *content;
-        int err = sys_zalloc(FILE_BUFFER, cast(void**, &content));
-        if (!err) {
-
-                if (file->content < _FILE_CONTENT_COUNT) {
+        if (file->content < _FILE_CONTENT_COUNT) {
 
-                        if (file->arg >= 0) {
-                                stat->st_size = get_file_content(file, content, FILE_BUFFER);
-                                stat->st_type = FILE_TYPE_REGULAR;
+                if (file->arg >= 0) {
+                        stat->st_size = get_content_size(file);
+                        stat->st_type = FILE_TYPE_REGULAR;
 
-                                if (  (file->content == FILE_CONTENT_PID)
-                                   || (file->content == FILE_CONTENT_CPUINFO) ) {
+                        if (  (file->content == FILE_CONTENT_PID)
+                           || (file->content == FILE_CONTENT_CPUINFO)
+                           || (file->content == FILE_CONTENT_STAT) ) {
 
-                                        time_t t = 0;
-                                        sys_get_time(&t);
+                                time_t t = 0;
+                                sys_get_time(&t);
 
-                                        stat->st_mtime = t;
-                                        stat->st_ctime = t;
-                                }
+                                stat->st_mtime = t;
+                                stat->st_ctime = t;
+                        }
 
-                                if (file->content == FILE_CONTENT_BIN) {
-                                        stat->st_type  = FILE_TYPE_PROGRAM;
-                                        stat->st_mode |= S_IXUSR;
-                                }
-                        } else {
-                                stat->st_type = FILE_TYPE_DIR;
+                        if (file->content == FILE_CONTENT_BIN) {
+                                stat->st_type  = FILE_TYPE_PROGRAM;
+                                stat->st_mode |= S_IXUSR;
                         }
+                } else {
+                        stat->st_type = FILE_TYPE_DIR;
                 }
-
-                sys_free(cast(void**, &content));
         }
 
-        return err;
+        return ESUCC;
 }
 
 //==============================================================================
@@ -607,7 +656,7 @@ API_FS_OPENDIR(procfs, void *fs_handle, const char *path, DIR *dir)
 
                 if (isstreq(opath, PATH_ROOT)) {
                         dirinfo->dir_name = PATH_ROOT;
-                        dir->d_items      = 3;
+                        dir->d_items      = 4;
 
                 } else if (isstreq(opath, PATH_ROOT_PID"/")) {
                         dirinfo->dir_name = PATH_ROOT_PID;
@@ -617,6 +666,10 @@ API_FS_OPENDIR(procfs, void *fs_handle, const char *path, DIR *dir)
                         dirinfo->dir_name = PATH_ROOT_BIN;
                         dir->d_items      = sys_get_programs_table_size();
 
+                } else if (isstreq(opath, PATH_ROOT_STAT"/")) {
+                        dirinfo->dir_name = PATH_ROOT_STAT;
+                        dir->d_items      = ARRAY_SIZE(STAT_FILE);
+
                 } else {
                         sys_free(&dir->d_hdl);
                         err = ENOENT;
@@ -675,6 +728,9 @@ API_FS_READDIR(procfs, void *fs_handle, DIR *dir)
 
                 } else if (isstreq(dirinfo->dir_name, PATH_ROOT_BIN)) {
                         err = procfs_readdir_bin(fs_handle, dir);
+
+                } else if (isstreq(dirinfo->dir_name, PATH_ROOT_STAT)) {
+                        err = procfs_readdir_stat(fs_handle, dir);
                 }
         }
 
@@ -823,20 +879,29 @@ static int procfs_readdir_root(struct procfs *hdl, DIR *dir)
                 dir->dirent.filetype = FILE_TYPE_DIR;
                 break;
 
-        case 2: {
-                char *content;
-                err = sys_zalloc(FILE_BUFFER, cast(void**, &content));
-                if (!err) {
-                        struct file_info file = {.content = FILE_CONTENT_CPUINFO, .arg = 0};
-                        dir->dirent.name      = "cpuinfo";
-                        dir->dirent.filetype  = FILE_TYPE_REGULAR;
-                        dir->dirent.size      = get_file_content(&file, content, FILE_BUFFER);
+        case 2:
+                dir->dirent.name     = "stat";
+                dir->dirent.filetype = FILE_TYPE_DIR;
+                break;
 
-                        sys_free(cast(void**, &content));
-                }
+        case 3: {
+                struct file_info file = {.content = FILE_CONTENT_CPUINFO, .arg = 0};
+                dir->dirent.name      = "cpuinfo";
+                dir->dirent.filetype  = FILE_TYPE_REGULAR;
+                dir->dirent.size      = get_content_size(&file);
                 break;
         }
 
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+        case 4: {
+                struct file_info file = {.content = FILE_CONTENT_SYSCALLS, .arg = 0};
+                dir->dirent.name      = "syscalls";
+                dir->dirent.filetype  = FILE_TYPE_REGULAR;
+                dir->dirent.size      = get_content_size(&file);
+                break;
+        }
+#endif
+
         default:
                 err = ENOENT;
                 break;
@@ -863,24 +928,17 @@ static int procfs_readdir_pid(struct procfs *hdl, DIR *dir)
         int err = sys_process_get_stat_seek(dir->d_seek++, &stat);
         if (err == ESUCC) {
 
-                char *content;
-                err = sys_zalloc(FILE_BUFFER, cast(void**, &content));
-                if (!err) {
-
-                        struct dir_info *dirinfo = dir->d_hdl;
-
-                        sys_snprintf(dirinfo->name, sizeof(dirinfo->name),
-                                     "%u", stat.pid);
+                struct dir_info *dirinfo = dir->d_hdl;
 
-                        dir->dirent.name      = dirinfo->name;
-                        dir->dirent.filetype  = FILE_TYPE_REGULAR;
-                        dir->dirent.dev       = 0;
+                sys_snprintf(dirinfo->name, sizeof(dirinfo->name),
+                             "%u", stat.pid);
 
-                        struct file_info file = {.arg = stat.pid, .content = FILE_CONTENT_PID};
-                        dir->dirent.size      = get_file_content(&file, content, FILE_BUFFER);
+                dir->dirent.name      = dirinfo->name;
+                dir->dirent.filetype  = FILE_TYPE_REGULAR;
+                dir->dirent.dev       = 0;
 
-                        err = sys_free(cast(void**, &content));
-                }
+                struct file_info file = {.arg = stat.pid, .content = FILE_CONTENT_PID};
+                dir->dirent.size      = get_content_size(&file);
         }
 
         return err;
@@ -904,20 +962,48 @@ static int procfs_readdir_bin(struct procfs *hdl, DIR *dir)
 
         if (dir->d_seek < (size_t)sys_get_programs_table_size()) {
 
-                char *content;
-                err = sys_zalloc(FILE_BUFFER, cast(void**, &content));
-                if (!err) {
+                dir->dirent.filetype = FILE_TYPE_PROGRAM;
+                dir->dirent.name     = sys_get_programs_table()[dir->d_seek].name;
 
-                        dir->dirent.filetype = FILE_TYPE_PROGRAM;
-                        dir->dirent.name     = sys_get_programs_table()[dir->d_seek].name;
+                struct file_info file = {.arg = dir->d_seek, .content = FILE_CONTENT_BIN};
+                dir->dirent.size      = get_content_size(&file);
 
-                        struct file_info file = {.arg = dir->d_seek, .content = FILE_CONTENT_BIN};
-                        dir->dirent.size      = get_file_content(&file, content, FILE_BUFFER);
+                dir->d_seek++;
 
-                        dir->d_seek++;
+                err = ESUCC;
+        }
 
-                        err = sys_free(cast(void**, &content));
-                }
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Read directory
+ *
+ * @param[in ]          *hdl                    file system allocated memory
+ * @param[in,out]       *dir                    directory object
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+static int procfs_readdir_stat(struct procfs *hdl, DIR *dir)
+{
+        UNUSED_ARG1(hdl);
+
+        int err = ENOENT;
+
+        if (dir->d_seek < ARRAY_SIZE(STAT_FILE)) {
+
+                dir->dirent.filetype = FILE_TYPE_REGULAR;
+                dir->dirent.name     = STAT_FILE[dir->d_seek].name;
+                dir->dirent.dev      = 0;
+
+                struct file_info file = {.arg = dir->d_seek, .content = FILE_CONTENT_STAT};
+                dir->dirent.size      = get_content_size(&file);
+
+                dir->d_seek++;
+
+                err = ESUCC;
         }
 
         return err;
@@ -962,103 +1048,571 @@ static int add_file_to_list(struct procfs *hdl, int16_t arg,
 
 //==============================================================================
 /**
- * @brief Function return file content and size
+ * @brief Function generate selected record of file content. Text files are
+ *        divided to records (e.g. lines) that fit to the record buffer, so
+ *        content of any size is generated incrementally. Binary files have
+ *        records of fixed size.
  *
  * @param file          file information
- * @param buff          buffer
+ * @param idx           record index
+ * @param buf           record buffer
  * @param size          buffer size
+ * @param len           record length
  *
- * @return number of bytes written to buffer
+ * @return One of errno value (errno.h). ENOENT if record does not exist.
  */
 //==============================================================================
-static size_t get_file_content(struct file_info *file, char *buff, size_t size)
+static int get_record(struct file_info *file, size_t idx, char *buf, size_t size, size_t *len)
 {
-        size_t         len = 0;
+        int            err = ENOENT;
         process_stat_t stat;
 
+        *len = 0;
+
         switch (file->content) {
         case FILE_CONTENT_PID:
-                if (sys_process_get_stat_pid(file->arg, &stat) == ESUCC) {
-                        len = sys_snprintf(buff, size,
-                                           "Name: %s\n"
-                                           "PID: %d\n"
-                                           "Memory usage: %d bytes\n"
-                                           "Memory Block Count: %d\n"
-                                           "Open Files: %d\n"
-                                           "Open Dirs: %d\n"
-                                           "Open Mutexes: %d\n"
-                                           "Open Semaphores: %d\n"
-                                           "Open Queues: %d\n"
-                                           "Open Sockets: %d\n"
-                                           "Threads: %d\n"
-                                           "CPU Load: %d.%d%%\n"
-                                           "Stack Size: %d\n"
-                                           "Stack Usage: %d\n"
-                                           "Priority: %d\n",
-                                           stat.name,
-                                           stat.pid,
-                                           stat.memory_usage,
-                                           stat.memory_block_count,
-                                           stat.files_count,
-                                           stat.dir_count,
-                                           stat.mutexes_count,
-                                           stat.semaphores_count,
-                                           stat.queue_count,
-                                           stat.socket_count,
-                                           stat.threads_count,
-                                           stat.CPU_load / 10, stat.CPU_load % 10,
-                                           stat.stack_size,
-                                           stat.stack_max_usage,
-                                           stat.priority);
+                if (idx == 0 && sys_process_get_stat_pid(file->arg, &stat) == ESUCC) {
+                        *len = sys_snprintf(buf, size,
+                                            "Name: %s\n"
+                                            "PID: %d\n"
+                                            "Memory usage: %d bytes\n"
+                                            "Memory Block Count: %d\n"
+                                            "Open Files: %d\n"
+                                            "Open Dirs: %d\n"
+                                            "Open Mutexes: %d\n"
+                                            "Open Semaphores: %d\n"
+                                            "Open Queues: %d\n"
+                                            "Open Sockets: %d\n"
+                                            "Threads: %d\n"
+                                            "CPU Load: %d.%d%%\n"
+                                            "Stack Size: %d\n"
+                                            "Stack Usage: %d\n"
+                                            "Priority: %d\n",
+                                            stat.name,
+                                            stat.pid,
+                                            stat.memory_usage,
+                                            stat.memory_block_count,
+                                            stat.files_count,
+                                            stat.dir_count,
+                                            stat.mutexes_count,
+                                            stat.semaphores_count,
+                                            stat.queue_count,
+                                            stat.socket_count,
+                                            stat.threads_count,
+                                            stat.CPU_load / 10, stat.CPU_load % 10,
+                                            stat.stack_size,
+                                            stat.stack_max_usage,
+                                            stat.priority);
+                        err = ESUCC;
+
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+                } else if (idx == 1 && sys_process_get_stat_pid(file->arg, &stat) == ESUCC) {
+                        *len = sys_snprintf(buf, size,
+                                            "Syscalls: %u\n"
+                                            "Syscall Errors: %u\n"
+                                            "Syscall Time: %lu us\n",
+                                            stat.syscalls,
+                                            stat.syscall_errors,
+                                            stat.syscall_time);
+                        err = ESUCC;
+#endif
                 }
                 break;
 
         case FILE_CONTENT_CPUINFO:
-                len = sys_snprintf(buff, size,
-                                    "CPU name  : %s\n"
-                                    "CPU vendor: %s\n",
-                                    _CPUCTL_PLATFORM_NAME,
-                                    _CPUCTL_VENDOR_NAME);
-
-                FILE *pll;
-                if (sys_fopen(CLK_FILE_PATH, "r+", &pll) == ESUCC) {
-
-                        CLK_info_t clkinf;
-                        clkinf.iterator = 0;
-
-                        while (  sys_ioctl(pll, IOCTL_CLK__GET_CLK_INFO, &clkinf) == ESUCC
-                              && clkinf.name) {
-
-                                len += sys_snprintf(buff + len,
-                                                     size - len,
-                                                     "%16s: %d Hz\n",
-                                                     clkinf.name,
-                                                     cast(int, clkinf.freq_Hz));
-                        }
-
-                        sys_fclose(pll);
+                if (idx == 0) {
+                        *len = sys_snprintf(buf, size,
+                                            "CPU name  : %s\n"
+                                            "CPU vendor: %s\n",
+                                            _CPUCTL_PLATFORM_NAME,
+                                            _CPUCTL_VENDOR_NAME);
+                        err = ESUCC;
                 } else {
-                        len += sys_snprintf(buff + len, size - len,
-                                            "Warning: no '"CLK_FILE_PATH"' file to read clocks\n");
+                        // each clock is a separated record
+                        FILE *pll;
+                        if (sys_fopen(CLK_FILE_PATH, "r+", &pll) == ESUCC) {
+
+                                CLK_info_t clkinf;
+                                clkinf.iterator = idx - 1;
+
+                                if (  sys_ioctl(pll, IOCTL_CLK__GET_CLK_INFO, &clkinf) == ESUCC
+                                   && clkinf.name) {
+
+                                        *len = sys_snprintf(buf, size,
+                                                            "%16s: %d Hz\n",
+                                                            clkinf.name,
+                                                            cast(int, clkinf.freq_Hz));
+                                        err = ESUCC;
+                                }
+
+                                sys_fclose(pll);
+
+                        } else if (idx == 1) {
+                                *len = sys_snprintf(buf, size,
+                                                    "Warning: no '"CLK_FILE_PATH"' file to read clocks\n");
+                                err = ESUCC;
+                        }
                 }
                 break;
 
 #if __OS_SYSTEM_SHEBANG_ENABLE__ > 0
         case FILE_CONTENT_BIN: {
                 const struct _prog_data *pdata = sys_get_programs_table();
-                if (file->arg < sys_get_programs_table_size()) {
-                        len = sys_snprintf(buff, size, "#!%s\n", pdata[file->arg].name);
+                if (idx == 0 && file->arg < sys_get_programs_table_size()) {
+                        *len = sys_snprintf(buf, size, "#!%s\n", pdata[file->arg].name);
+                        err  = ESUCC;
+                }
+                break;
+        }
+#endif
+
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+        case FILE_CONTENT_SYSCALLS: {
+                // each system call is a separated record, unused calls are
+                // empty records
+                const char     *name;
+                _syscall_stat_t sc;
+
+                if (idx == 0) {
+                        *len = sys_snprintf(buf, size,
+                                            "%-18s %8s %6s %9s %9s %9s\n",
+                                            "syscall", "calls", "errors",
+                                            "wait[us]", "serv[us]", "max[us]");
+                        err = ESUCC;
+
+                } else if (sys_syscall_get_stat(idx - 1, &name, &sc) == ESUCC) {
+                        if (sc.calls > 0) {
+                                *len = sys_snprintf(buf, size,
+                                                    "%-18s %8u %6u %9u %9u %9u\n",
+                                                    name,
+                                                    sc.calls,
+                                                    sc.errors,
+                                                    cast(u32_t, sc.wait_time / sc.calls),
+                                                    cast(u32_t, sc.service_time / sc.calls),
+                                                    sc.max_time);
+                        }
+                        err = ESUCC;
                 }
                 break;
         }
 #endif
 
+        case FILE_CONTENT_STAT:
+                if (  (file->arg >= 0) && (cast(size_t, file->arg) < ARRAY_SIZE(STAT_FILE))
+                   && (STAT_FILE[file->arg].rec_size <= size) ) {
+
+                        memset(buf, 0, STAT_FILE[file->arg].rec_size);
+                        err = STAT_FILE[file->arg].get(idx, buf);
+                        if (!err) {
+                                *len = STAT_FILE[file->arg].rec_size;
+                        }
+                }
+                break;
+
         default:
                 break;
         }
 
-        return len;
+        *len = min(*len, size);
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function read file content from selected position. Content is
+ *        generated record by record as reader advances. Generated record is
+ *        kept in the file object, so next read that continues in the middle
+ *        of record uses the same snapshot of data. Reading from begin of
+ *        record generates fresh data.
+ *
+ * @param file          file information
+ * @param dst           destination buffer
+ * @param count         number of bytes to read
+ * @param fpos          file position
+ * @param rdcnt         number of read bytes
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+static int read_content(struct file_info *file, u8_t *dst, size_t count, fpos_t fpos, size_t *rdcnt)
+{
+        int err = ESUCC;
+
+        *rdcnt = 0;
+
+        if (!file->rec_buf) {
+                err = sys_zalloc(FILE_BUFFER, cast(void**, &file->rec_buf));
+                if (err) {
+                        return err;
+                }
+
+                file->rec_valid = false;
+        }
+
+        size_t recsz = 0;
+        if (file->content == FILE_CONTENT_STAT) {
+                recsz = STAT_FILE[file->arg].rec_size;
+        }
+
+        while (!err && count > 0) {
+
+                if (  !file->rec_valid
+                   || (fpos <= file->rec_pos)
+                   || (fpos >= file->rec_pos + file->rec_len) ) {
+
+                        size_t idx = 0;
+                        fpos_t pos = 0;
+
+                        if (recsz) {
+                                idx = fpos / recsz;
+                                pos = cast(fpos_t, idx) * recsz;
+
+                        } else if (file->rec_valid && fpos >= file->rec_pos) {
+                                idx = file->rec_idx;
+                                pos = file->rec_pos;
+
+                                if (fpos >= file->rec_pos + file->rec_len) {
+                                        idx++;
+                                        pos += file->rec_len;
+                                }
+                        }
+
+                        file->rec_valid = false;
+
+                        for (;;) {
+                                size_t len = 0;
+                                err = get_record(file, idx, file->rec_buf, FILE_BUFFER, &len);
+                                if (err) {
+                                        break;
+                                }
+
+                                file->rec_valid = true;
+                                file->rec_idx   = idx;
+                                file->rec_pos   = pos;
+                                file->rec_len   = len;
+
+                                if (fpos < pos + len) {
+                                        break;
+                                }
+
+                                idx++;
+                                pos += len;
+                        }
+
+                        if (err == ENOENT) {
+                                err = ESUCC;
+                                break;
+                        }
+
+                        if (err) {
+                                break;
+                        }
+                }
+
+                size_t offs = fpos - file->rec_pos;
+                size_t n    = min(count, file->rec_len - offs);
+
+                memcpy(dst, file->rec_buf + offs, n);
+
+                dst    += n;
+                fpos   += n;
+                count  -= n;
+                *rdcnt += n;
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function return size of file content.
+ *
+ * @param file          file information
+ *
+ * @return Content size in bytes.
+ */
+//==============================================================================
+static size_t get_content_size(struct file_info *file)
+{
+        size_t size = 0;
+
+        char *buf;
+        if (sys_zalloc(FILE_BUFFER, cast(void**, &buf)) == ESUCC) {
+
+                size_t len = 0;
+                for (size_t idx = 0; get_record(file, idx, buf, FILE_BUFFER, &len) == ESUCC; idx++) {
+                        size += len;
+                }
+
+                sys_free(cast(void**, &buf));
+        }
+
+        return size;
+}
+
+//==============================================================================
+/**
+ * @brief Function return process record.
+ *
+ * @param idx           process index
+ * @param rec           record
+ *
+ * @return One of errno value (errno.h). ENOENT if process does not exist.
+ */
+//==============================================================================
+static int get_stat_proc(size_t idx, void *rec)
+{
+        procstat_proc_t *proc = rec;
+
+        process_stat_t stat;
+        int err = sys_process_get_stat_seek(idx, &stat);
+        if (!err) {
+                proc->hdr.version        = PROCSTAT_VERSION;
+                proc->hdr.size           = sizeof(procstat_proc_t);
+                proc->pid                = stat.pid;
+                proc->memory_usage       = stat.memory_usage;
+                proc->memory_block_count = stat.memory_block_count;
+                proc->files_count        = stat.files_count;
+                proc->dir_count          = stat.dir_count;
+                proc->mutexes_count      = stat.mutexes_count;
+                proc->semaphores_count   = stat.semaphores_count;
+                proc->queue_count        = stat.queue_count;
+                proc->socket_count       = stat.socket_count;
+                proc->threads_count      = stat.threads_count;
+                proc->CPU_load           = stat.CPU_load;
+                proc->stack_size         = stat.stack_size;
+                proc->stack_max_usage    = stat.stack_max_usage;
+                proc->priority           = stat.priority;
+                proc->syscalls           = stat.syscalls;
+                proc->syscall_errors     = stat.syscall_errors;
+                proc->syscall_time       = stat.syscall_time;
+
+                if (stat.name) {
+                        strncpy(proc->name, stat.name, sizeof(proc->name) - 1);
+                }
+        } else {
+                err = ENOENT;
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function return memory record.
+ *
+ * @param idx           record index
+ * @param rec           record
+ *
+ * @return One of errno value (errno.h). ENOENT if record does not exist.
+ */
+//==============================================================================
+static int get_stat_mem(size_t idx, void *rec)
+{
+        procstat_mem_t *mem = rec;
+
+        if (idx > 0) {
+                return ENOENT;
+        }
+
+        _mm_mem_usage_t usage;
+        int err = sys_get_mem_usage_details(&usage);
+        if (!err) {
+                mem->hdr.version              = PROCSTAT_VERSION;
+                mem->hdr.size                 = sizeof(procstat_mem_t);
+                mem->size                     = sys_get_mem_size();
+                mem->used                     = sys_get_used_mem();
+                mem->free                     = sys_get_free_mem();
+                mem->static_memory_usage      = usage.static_memory_usage;
+                mem->kernel_memory_usage      = usage.kernel_memory_usage;
+                mem->filesystems_memory_usage = usage.filesystems_memory_usage;
+                mem->network_memory_usage     = usage.network_memory_usage;
+                mem->modules_memory_usage     = usage.modules_memory_usage;
+                mem->programs_memory_usage    = usage.programs_memory_usage;
+                mem->shared_memory_usage      = usage.shared_memory_usage;
+                mem->cached_memory_usage      = usage.cached_memory_usage;
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function return disc cache record.
+ *
+ * @param idx           record index
+ * @param rec           record
+ *
+ * @return One of errno value (errno.h). ENOENT if record does not exist.
+ */
+//==============================================================================
+static int get_stat_cache(size_t idx, void *rec)
+{
+        procstat_cache_t *cache = rec;
+
+        if (idx > 0) {
+                return ENOENT;
+        }
+
+        struct cache_stat stat;
+        int err = sys_cache_get_stat(&stat);
+        if (!err) {
+                cache->hdr.version = PROCSTAT_VERSION;
+                cache->hdr.size    = sizeof(procstat_cache_t);
+                cache->blocks      = stat.blocks;
+                cache->dirty       = stat.dirty;
+                cache->bytes       = stat.bytes;
+                cache->hits        = stat.hits;
+                cache->misses      = stat.misses;
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function return network record.
+ *
+ * @param idx           network family
+ * @param rec           record
+ *
+ * @return One of errno value (errno.h). ENOENT if record does not exist.
+ */
+//==============================================================================
+static int get_stat_net(size_t idx, void *rec)
+{
+#if __ENABLE_NETWORK__ == _YES_
+        procstat_net_t *net = rec;
+
+        if (idx == NET_FAMILY__INET) {
+                net->hdr.version = PROCSTAT_VERSION;
+                net->hdr.size    = sizeof(procstat_net_t);
+                net->family      = NET_FAMILY__INET;
+                net->state       = NET_INET_STATE__NOT_CONFIGURED;
+
+                NET_INET_status_t status;
+                if (sys_net_ifstatus(NET_FAMILY__INET, &status) == ESUCC) {
+                        net->state      = status.state;
+                        net->tx_bytes   = status.tx_bytes;
+                        net->rx_bytes   = status.rx_bytes;
+                        net->tx_packets = status.tx_packets;
+                        net->rx_packets = status.rx_packets;
+                }
+
+                return ESUCC;
+        }
+#else
+        UNUSED_ARG2(idx, rec);
+#endif
+        return ENOENT;
+}
+
+//==============================================================================
+/**
+ * @brief Function return block device queue record.
+ *
+ * @param idx           queue index
+ * @param rec           record
+ *
+ * @return One of errno value (errno.h). ENOENT if record does not exist.
+ */
+//==============================================================================
+static int get_stat_blkq(size_t idx, void *rec)
+{
+        procstat_blkq_t *blkq = rec;
+
+        dev_t dev;
+        struct blkq_stat stat;
+        int err = sys_blkq_get_stat(idx, &dev, &stat);
+        if (!err) {
+                blkq->hdr.version = PROCSTAT_VERSION;
+                blkq->hdr.size    = sizeof(procstat_blkq_t);
+                blkq->dev         = dev;
+                blkq->requests    = stat.requests;
+                blkq->merged      = stat.merged;
+                blkq->transfers   = stat.transfers;
+                blkq->expired     = stat.expired;
+                blkq->depth       = stat.depth;
+                blkq->max_depth   = stat.max_depth;
+                blkq->rd_bytes    = stat.rd_bytes;
+                blkq->wr_bytes    = stat.wr_bytes;
+        }
+
+        return err;
+}
+
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+//==============================================================================
+/**
+ * @brief Function return system call record.
+ *
+ * @param idx           system call number
+ * @param rec           record
+ *
+ * @return One of errno value (errno.h). ENOENT if record does not exist.
+ */
+//==============================================================================
+static int get_stat_syscall(size_t idx, void *rec)
+{
+        procstat_syscall_t *syscall = rec;
+
+        const char     *name;
+        _syscall_stat_t stat;
+        int err = sys_syscall_get_stat(idx, &name, &stat);
+        if (!err) {
+                syscall->hdr.version  = PROCSTAT_VERSION;
+                syscall->hdr.size     = sizeof(procstat_syscall_t);
+                syscall->no           = idx;
+                syscall->calls        = stat.calls;
+                syscall->errors       = stat.errors;
+                syscall->max_time     = stat.max_time;
+                syscall->wait_time    = stat.wait_time;
+                syscall->service_time = stat.service_time;
+
+                strncpy(syscall->name, name, sizeof(syscall->name) - 1);
+
+                for (size_t i = 0; i < min(_SYSCALL_STAT_HIST_BINS, PROCSTAT_SYSCALL_HIST_BINS); i++) {
+                        syscall->hist[i] = stat.hist[i];
+                }
+        }
+
+        return err;
 }
+#endif
+
+#if __OS_TRACE_ENABLE__ > 0
+//==============================================================================
+/**
+ * @brief Function return kernel event record.
+ *
+ * @param idx           record index
+ * @param rec           record
+ *
+ * @return One of errno value (errno.h). ENOENT if record does not exist.
+ */
+//==============================================================================
+static int get_stat_trace(size_t idx, void *rec)
+{
+        procstat_trace_t *trace = rec;
+
+        _ktrace_rec_t ev;
+        int err = sys_ktrace_get(idx, &ev);
+        if (!err) {
+                trace->hdr.version = PROCSTAT_VERSION;
+                trace->hdr.size    = sizeof(procstat_trace_t);
+                trace->seq         = ev.seq;
+                trace->timestamp   = ev.timestamp;
+                trace->pid         = ev.pid;
+                trace->thread      = ev.thread;
+                trace->event       = ev.event;
+                trace->arg[0]      = ev.arg[0];
+                trace->arg[1]      = ev.arg[1];
+        }
+
+        return err;
+}
+#endif
 
 /*==============================================================================
   End of file
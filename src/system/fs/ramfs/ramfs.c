@@ -420,6 +420,81 @@ API_FS_READDIR(ramfs, void *fs_handle, DIR *dir)
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief Read many directory entries with attributes
+ *
+ * @param[in ]          *fs_handle              file system allocated memory
+ * @param[in ]          *dir                    directory object
+ * @param[out]          *buf                    record buffer
+ * @param[in ]           size                   buffer size
+ * @param[in ]           flags                  read flags
+ * @param[out]          *len                    number of bytes put to buffer
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+API_FS_READDIR_BULK(ramfs, void *fs_handle, DIR *dir, void *buf, size_t size, int flags, size_t *len)
+{
+        UNUSED_ARG1(flags);
+
+        struct RAMFS *hdl = fs_handle;
+
+        int err = sys_mutex_lock(hdl->resource_mtx, MTX_TIMEOUT);
+        if (!err) {
+
+                node_t *parent = dir->d_hdl;
+                node_t *child;
+
+                while ((child = sys_llist_at(parent->data.llist_t, dir->d_seek))) {
+
+                        struct stat st;
+                        st.st_gid   = child->gid;
+                        st.st_mode  = child->mode;
+                        st.st_mtime = child->mtime;
+                        st.st_ctime = child->ctime;
+                        st.st_size  = child->size;
+                        st.st_uid   = child->uid;
+                        st.st_type  = child->type;
+                        st.st_dev   = 0;
+
+                        if (child->type == FILE_TYPE_DRV) {
+                                st.st_dev = child->data.dev_t;
+
+                                sys_mutex_unlock(hdl->resource_mtx);
+
+                                struct vfs_dev_stat dev_stat;
+                                if (sys_driver_stat(st.st_dev, &dev_stat) == ESUCC) {
+                                        st.st_size = dev_stat.st_size;
+                                } else {
+                                        st.st_size = 0;
+                                }
+
+                                err = sys_mutex_lock(hdl->resource_mtx, MTX_TIMEOUT);
+                                if (err) {
+                                        return err;
+                                }
+
+                                // list could be modified when mutex was unlocked
+                                if (child != sys_llist_at(parent->data.llist_t, dir->d_seek)) {
+                                        continue;
+                                }
+                        }
+
+                        if (sys_dirent_rec_put(buf, size, len, child->name, &st)) {
+                                dir->d_seek++;
+                        } else {
+                                err = (*len == 0) ? EINVAL : ESUCC;
+                                break;
+                        }
+                }
+
+                sys_mutex_unlock(hdl->resource_mtx);
+        }
+
+        return err;
+}
+
 //==============================================================================
 /**
  * @brief Remove file/directory
@@ -1045,6 +1120,160 @@ API_FS_READ(ramfs,
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief Write data from buffer vector to the file
+ *
+ * @param[in ]          *fs_handle              file system allocated memory
+ * @param[in ]          *fhdl                   file handle
+ * @param[in ]          *iov                    buffer vector
+ * @param[in ]           iovcnt                 number of buffers
+ * @param[in ]          *fpos                   position in file
+ * @param[out]          *wrcnt                  number of written bytes
+ * @param[in ]           fattr                  file attributes
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+API_FS_WRITEV(ramfs,
+              void               *fs_handle,
+              void               *fhdl,
+              const struct iovec *iov,
+              int                 iovcnt,
+              fpos_t             *fpos,
+              size_t             *wrcnt,
+              struct vfs_fattr    fattr)
+{
+        struct RAMFS *hdl = fs_handle;
+
+        int err = sys_mutex_lock(hdl->resource_mtx, MTX_TIMEOUT);
+        if (!err) {
+
+                err = ENOENT;
+
+                struct opened_file_info *opened_file = fhdl;
+                if (opened_file && opened_file->child) {
+                        node_t *node = opened_file->child;
+
+                        if (node->type == FILE_TYPE_REGULAR) {
+                                sys_get_time(&node->mtime);
+
+                                err = ESUCC;
+                                for (int i = 0; !err && i < iovcnt; i++) {
+                                        err = write_regular_file(node, iov[i].iov_base,
+                                                                 iov[i].iov_len,
+                                                                 *fpos + *wrcnt, wrcnt);
+                                }
+
+                        } else {
+                                sys_mutex_unlock(hdl->resource_mtx);
+
+                                // drivers and pipes: buffers are transferred one by one
+                                fpos_t pos = *fpos;
+                                err = ESUCC;
+                                for (int i = 0; !err && i < iovcnt; i++) {
+                                        size_t n = 0;
+                                        err = _ramfs_write(fs_handle, fhdl, iov[i].iov_base,
+                                                           iov[i].iov_len, &pos, &n, fattr);
+                                        if (!err) {
+                                                *wrcnt += n;
+                                                pos    += n;
+
+                                                if (n < iov[i].iov_len) {
+                                                        break;
+                                                }
+                                        }
+                                }
+
+                                return err;
+                        }
+                }
+
+                sys_mutex_unlock(hdl->resource_mtx);
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Read data from file to buffer vector
+ *
+ * @param[in ]          *fs_handle              file system allocated memory
+ * @param[in ]          *fhdl                   file handle
+ * @param[in ]          *iov                    buffer vector
+ * @param[in ]           iovcnt                 number of buffers
+ * @param[in ]          *fpos                   position in file
+ * @param[out]          *rdcnt                  number of read bytes
+ * @param[in ]           fattr                  file attributes
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+API_FS_READV(ramfs,
+             void               *fs_handle,
+             void               *fhdl,
+             const struct iovec *iov,
+             int                 iovcnt,
+             fpos_t             *fpos,
+             size_t             *rdcnt,
+             struct vfs_fattr    fattr)
+{
+        struct RAMFS *hdl = fs_handle;
+
+        int err = sys_mutex_lock(hdl->resource_mtx, MTX_TIMEOUT);
+        if (!err) {
+
+                err = ENOENT;
+
+                struct opened_file_info *opened_file = fhdl;
+                if (opened_file && opened_file->child) {
+                        node_t *node = opened_file->child;
+
+                        if (node->type == FILE_TYPE_REGULAR) {
+                                err = ESUCC;
+                                for (int i = 0; !err && i < iovcnt; i++) {
+                                        size_t n = 0;
+                                        err = read_regular_file(node, iov[i].iov_base,
+                                                                iov[i].iov_len,
+                                                                *fpos + *rdcnt, &n);
+                                        *rdcnt += n;
+
+                                        if (n < iov[i].iov_len) {
+                                                break;
+                                        }
+                                }
+
+                        } else {
+                                sys_mutex_unlock(hdl->resource_mtx);
+
+                                // drivers and pipes: buffers are transferred one by one
+                                fpos_t pos = *fpos;
+                                err = ESUCC;
+                                for (int i = 0; !err && i < iovcnt; i++) {
+                                        size_t n = 0;
+                                        err = _ramfs_read(fs_handle, fhdl, iov[i].iov_base,
+                                                          iov[i].iov_len, &pos, &n, fattr);
+                                        if (!err) {
+                                                *rdcnt += n;
+                                                pos    += n;
+
+                                                if (n < iov[i].iov_len) {
+                                                        break;
+                                                }
+                                        }
+                                }
+
+                                return err;
+                        }
+                }
+
+                sys_mutex_unlock(hdl->resource_mtx);
+        }
+
+        return err;
+}
+
 //==============================================================================
 /**
  * @brief IO operations on files
@@ -1084,6 +1313,10 @@ API_FS_IOCTL(ramfs, void *fs_handle, void *fhdl, int request, void *arg)
                                         sys_mutex_unlock(hdl->resource_mtx);
                                         return sys_pipe_clear(opened_file->child->data.pipe_t);
 
+                                case IOCTL_VFS__POLL:
+                                        sys_mutex_unlock(hdl->resource_mtx);
+                                        return sys_pipe_poll(opened_file->child->data.pipe_t, arg);
+
                                 default:
                                         err = EBADRQC;
                                         break;
@@ -269,8 +269,29 @@ API_FS_READ(romfs,
 //==============================================================================
 API_FS_IOCTL(romfs, void *fs_handle, void *fhdl, int request, void *arg)
 {
-        UNUSED_ARG4(fs_handle, fhdl, request, arg);
-        return ENOTSUP;
+        UNUSED_ARG1(fs_handle);
+
+        int err = ENOTSUP;
+
+        const romfs_entry_t *entry = fhdl;
+
+        switch (request) {
+        case IOCTL_VFS__MAP_RO:
+                if (entry && arg) {
+                        struct vfs_map *map = arg;
+                        map->addr = entry->data;
+                        map->size = entry->size ? *entry->size : 0;
+                        err = ESUCC;
+                } else {
+                        err = EINVAL;
+                }
+                break;
+
+        default:
+                break;
+        }
+
+        return err;
 }
 
 //==============================================================================
@@ -473,15 +473,20 @@ int _vfs_opendir(const struct vfs_path *path, DIR **dir)
                         err = get_path_base_FS(cwd_path, &external_path, &fs);
 
                         if (!err) {
-                                (*dir)->FS_hdl = fs->handle;
-                                (*dir)->FS_if  = fs->interface;
+                                (*dir)->FS_hdl    = fs->handle;
+                                (*dir)->FS_if     = fs->interface;
+                                (*dir)->d_path    = cwd_path;
+                                (*dir)->d_fspath  = external_path;
+                                (*dir)->d_pending = false;
 
                                 int priority = increase_task_priority();
                                 err = fs->interface->fs_opendir(fs->handle, external_path, *dir);
                                 restore_priority(priority);
                         }
 
-                        _kfree(_MM_KRN, cast(void**, &cwd_path));
+                        if (err) {
+                                _kfree(_MM_KRN, cast(void**, &cwd_path));
+                        }
                 }
 
                 if (!err) {
@@ -511,6 +516,7 @@ int _vfs_closedir(DIR *dir)
                 err = dir->FS_if->fs_closedir(dir->FS_hdl, dir);
                 if (!err) {
                         dir->header.type = RES_TYPE_UNKNOWN;
+                        _kfree(_MM_KRN, cast(void**, &dir->d_path));
                         _kfree(_MM_KRN, cast(void**, &dir));
                 }
         }
@@ -533,6 +539,12 @@ int _vfs_readdir(DIR *dir, dirent_t **dirent)
         int err = EINVAL;
 
         if (is_dir_valid(dir) && dirent) {
+                if (dir->d_pending) {
+                        dir->d_pending = false;
+                        *dirent = &dir->dirent;
+                        return ESUCC;
+                }
+
                 int priority = increase_task_priority();
 
                 err = dir->FS_if->fs_readdir(dir->FS_hdl, dir);
@@ -548,6 +560,124 @@ int _vfs_readdir(DIR *dir, dirent_t **dirent)
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief Function read many items of opened directory in single call.
+ *
+ * Buffer is filled by directory entry records (dirent_rec_t). Each record
+ * contains file attributes and name. If READDIR_STAT flag is set then all
+ * file attributes are read (mode, owner, times), otherwise only size, type,
+ * and device are set. If file system does not support bulk read then items
+ * are read one by one. End of directory is indicated by zero length.
+ *
+ * @param[in]  dir              directory object
+ * @param[out] buf              record buffer
+ * @param[in]  size             buffer size
+ * @param[in]  flags            read flags
+ * @param[out] len              number of bytes put to buffer
+ *
+ * @return One of errno values
+ */
+//==============================================================================
+int _vfs_readdir_bulk(DIR *dir, void *buf, size_t size, int flags, size_t *len)
+{
+        int err = EINVAL;
+
+        if (is_dir_valid(dir) && buf && size && len) {
+                *len = 0;
+
+                int priority = increase_task_priority();
+
+                if (dir->FS_if->fs_readdir_bulk && !dir->d_pending) {
+                        err = dir->FS_if->fs_readdir_bulk(dir->FS_hdl, dir,
+                                                          buf, size, flags, len);
+                } else {
+                        err = ESUCC;
+
+                        while (!err) {
+                                if (!dir->d_pending) {
+                                        dir->d_pending_seek = dir->d_seek;
+                                        err = dir->FS_if->fs_readdir(dir->FS_hdl, dir);
+                                        if (err) {
+                                                // end of directory
+                                                err = (err == ENOENT) ? ESUCC : err;
+                                                break;
+                                        }
+                                }
+
+                                struct stat st;
+                                memset(&st, 0, sizeof(st));
+                                st.st_size = dir->dirent.size;
+                                st.st_type = dir->dirent.filetype;
+                                st.st_dev  = (dir->dirent.filetype == FILE_TYPE_DRV)
+                                           ? dir->dirent.dev : 0;
+
+                                #if __OS_ENABLE_FSTAT__ == _YES_
+                                if (flags & READDIR_STAT) {
+                                        size_t pathlen = strlen(dir->d_fspath)
+                                                       + strlen(dir->dirent.name) + 1;
+
+                                        char *path = NULL;
+                                        if (_kmalloc(_MM_KRN, pathlen, cast(void**, &path)) == ESUCC) {
+                                                strcpy(path, dir->d_fspath);
+                                                strcat(path, dir->dirent.name);
+                                                dir->FS_if->fs_stat(dir->FS_hdl, path, &st);
+                                                _kfree(_MM_KRN, cast(void**, &path));
+                                        }
+                                }
+                                #endif
+
+                                if (!_vfs_dirent_rec_put(buf, size, len, dir->dirent.name, &st)) {
+                                        dir->d_pending = true;
+                                        err = (*len == 0) ? EINVAL : ESUCC;
+                                        break;
+                                }
+
+                                dir->d_pending = false;
+                        }
+                }
+
+                restore_priority(priority);
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function put directory entry record to the bulk read buffer.
+ *
+ * Function is used by bulk directory read implementations.
+ *
+ * @param[out]    buf           record buffer
+ * @param[in]     size          buffer size
+ * @param[in,out] len           number of used bytes in buffer
+ * @param[in]     name          file name
+ * @param[in]     stat          file attributes
+ *
+ * @return If record fits to the buffer true is returned, otherwise false.
+ */
+//==============================================================================
+bool _vfs_dirent_rec_put(void *buf, size_t size, size_t *len,
+                         const char *name, const struct stat *stat)
+{
+        size_t reclen = offsetof(dirent_rec_t, d_name) + strlen(name) + 1;
+        reclen = (reclen + sizeof(u64_t) - 1) & ~(sizeof(u64_t) - 1);
+
+        if ((*len + reclen) > size || reclen > UINT16_MAX) {
+                return false;
+        }
+
+        dirent_rec_t *rec = cast(dirent_rec_t*, cast(u8_t*, buf) + *len);
+        rec->d_reclen = reclen;
+        rec->d_stat   = *stat;
+        strcpy(rec->d_name, name);
+
+        *len += reclen;
+
+        return true;
+}
+
 //==============================================================================
 /**
  * @brief Function set position of read index.
@@ -561,7 +691,8 @@ int _vfs_readdir(DIR *dir, dirent_t **dirent)
 int _vfs_seekdir(DIR *dir, u32_t seek)
 {
         if (is_dir_valid(dir)) {
-                dir->d_seek = seek;
+                dir->d_seek    = seek;
+                dir->d_pending = false;
                 return ESUCC;
         } else {
                 return EINVAL;
@@ -581,7 +712,8 @@ int _vfs_seekdir(DIR *dir, u32_t seek)
 int _vfs_telldir(DIR *dir, u32_t *seek)
 {
         if (is_dir_valid(dir) && seek) {
-                *seek = dir->d_seek;
+                // pending entry was read from file system but not returned yet
+                *seek = dir->d_pending ? dir->d_pending_seek : dir->d_seek;
                 return ESUCC;
         } else {
                 return EINVAL;
@@ -788,6 +920,51 @@ int _vfs_chown(const struct vfs_path *path, uid_t owner, gid_t group)
 #endif
 
 #if __OS_ENABLE_FSTAT__ == _YES_
+//==============================================================================
+/**
+ * @brief Function returns readiness of the file (POLLIN, POLLOUT, POLLERR,
+ *        POLLHUP). Request is forwarded to the file system (and to the driver
+ *        in case of device files). Files that do not support readiness
+ *        reporting (e.g. regular files) are always ready for reading and
+ *        writing.
+ *
+ * @param[in]  *file            file object
+ * @param[out] *revents         ready events
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+int _vfs_fpoll(FILE *file, int *revents)
+{
+        int err = EINVAL;
+
+        if (is_file_valid(file) && revents) {
+                *revents = 0;
+
+                err = file->FS_if->fs_ioctl(file->FS_hdl, file->f_hdl,
+                                            IOCTL_VFS__POLL, revents);
+
+                if (err == EBADRQC || err == ENOTSUP || err == ENOENT) {
+                        *revents = POLLIN | POLLOUT;
+                        err      = ESUCC;
+
+                } else if (err) {
+                        *revents = POLLERR;
+                        err      = ESUCC;
+                }
+
+                if (!file->f_flag.rd) {
+                        *revents &= ~POLLIN;
+                }
+
+                if (!file->f_flag.wr) {
+                        *revents &= ~POLLOUT;
+                }
+        }
+
+        return err;
+}
+
 //==============================================================================
 /**
  * @brief Function returns file/dir status
@@ -1088,6 +1265,326 @@ int _vfs_fread(void *ptr, size_t size, size_t *rdcnt, FILE *file)
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief Function write data to file at selected position. File position
+ *        indicator is not changed, so several requests can be handled for
+ *        single file at the same time.
+ *
+ * @param[in]  ptr              address to data (src)
+ * @param[in]  size             number of bytes to write
+ * @param[in]  offset           file position
+ * @param[out] wrcnt            number of written bytes
+ * @param[in]  file             pointer to file object
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+int _vfs_fpwrite(const void *ptr, size_t size, fpos_t offset, size_t *wrcnt, FILE *file)
+{
+        int err = EINVAL;
+
+        if (ptr && size && wrcnt && is_file_valid(file)) {
+                if (file->f_flag.wr) {
+                        err = file->FS_if->fs_write(file->FS_hdl,
+                                                    file->f_hdl,
+                                                    ptr,
+                                                    size,
+                                                    &offset,
+                                                    wrcnt,
+                                                    file->f_flag.fattr);
+                        if (err) {
+                                file->f_flag.error = true;
+                        }
+                } else {
+                        err = EPERM;
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function read data from file at selected position. File position
+ *        indicator is not changed, so several requests can be handled for
+ *        single file at the same time.
+ *
+ * @param[out] ptr              address to data (dst)
+ * @param[in]  size             number of bytes to read
+ * @param[in]  offset           file position
+ * @param[out] rdcnt            number of read bytes
+ * @param[in]  file             pointer to file object
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+int _vfs_fpread(void *ptr, size_t size, fpos_t offset, size_t *rdcnt, FILE *file)
+{
+        int err = EINVAL;
+
+        if (ptr && size && rdcnt && is_file_valid(file)) {
+                if (file->f_flag.rd) {
+                        err = file->FS_if->fs_read(file->FS_hdl,
+                                                   file->f_hdl,
+                                                   ptr,
+                                                   size,
+                                                   &offset,
+                                                   rdcnt,
+                                                   file->f_flag.fattr);
+                        if (err) {
+                                file->f_flag.error = true;
+                        }
+                } else {
+                        err = EPERM;
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function write data from several buffers to file (gather write).
+ *
+ * If file system does not support vectored write then buffers are written
+ * one by one by using standard write interface.
+ *
+ * @param[in]  iov              buffer vector
+ * @param[in]  iovcnt           number of buffers in vector
+ * @param[out] wrcnt            number of written bytes
+ * @param[in]  file             pointer to file object
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+int _vfs_fwritev(const struct iovec *iov, int iovcnt, size_t *wrcnt, FILE *file)
+{
+        int err = EINVAL;
+
+        if (iov && (iovcnt > 0) && wrcnt && is_file_valid(file)) {
+
+                if (!file->FS_if->fs_writev) {
+                        *wrcnt = 0;
+                        err    = ESUCC;
+
+                        for (int i = 0; !err && (i < iovcnt); i++) {
+                                if (iov[i].iov_len == 0) {
+                                        continue;
+                                }
+
+                                size_t n = 0;
+                                err = _vfs_fwrite(iov[i].iov_base, iov[i].iov_len, &n, file);
+                                if (!err) {
+                                        *wrcnt += n;
+
+                                        if (n < iov[i].iov_len) {
+                                                break;
+                                        }
+                                }
+                        }
+
+                        return err;
+                }
+
+                if (file->f_flag.wr) {
+                        if (file->f_flag.append && file->f_flag.rd && file->f_flag.seekmod) {
+                                _vfs_fseek(file, 0, VFS_SEEK_END);
+                                file->f_flag.seekmod = false;
+                        }
+
+                        size_t size = 0;
+                        for (int i = 0; i < iovcnt; i++) {
+                                size += iov[i].iov_len;
+                        }
+
+                        err = file->FS_if->fs_writev(file->FS_hdl,
+                                                     file->f_hdl,
+                                                     iov,
+                                                     iovcnt,
+                                                     &file->f_lseek,
+                                                     wrcnt,
+                                                     file->f_flag.fattr);
+
+                        if (!err) {
+                                if ((*wrcnt < size) && !file->f_flag.fattr.non_blocking_wr) {
+                                        file->f_flag.eof = true;
+                                }
+
+                                if (cast(ssize_t, *wrcnt) >= 0) {
+                                        file->f_lseek += cast(u64_t, *wrcnt);
+                                }
+                        } else {
+                                file->f_flag.error = true;
+                        }
+                } else {
+                        file->f_flag.error = true;
+                        err = EPERM;
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function read data from file to several buffers (scatter read).
+ *
+ * If file system does not support vectored read then buffers are read
+ * one by one by using standard read interface.
+ *
+ * @param[in]  iov              buffer vector
+ * @param[in]  iovcnt           number of buffers in vector
+ * @param[out] rdcnt            number of read bytes
+ * @param[in]  file             pointer to file object
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+int _vfs_freadv(const struct iovec *iov, int iovcnt, size_t *rdcnt, FILE *file)
+{
+        int err = EINVAL;
+
+        if (iov && (iovcnt > 0) && rdcnt && is_file_valid(file)) {
+
+                if (!file->FS_if->fs_readv) {
+                        *rdcnt = 0;
+                        err    = ESUCC;
+
+                        for (int i = 0; !err && (i < iovcnt); i++) {
+                                if (iov[i].iov_len == 0) {
+                                        continue;
+                                }
+
+                                size_t n = 0;
+                                err = _vfs_fread(iov[i].iov_base, iov[i].iov_len, &n, file);
+                                if (!err) {
+                                        *rdcnt += n;
+
+                                        if (n < iov[i].iov_len) {
+                                                break;
+                                        }
+                                }
+                        }
+
+                        return err;
+                }
+
+                if (file->f_flag.rd) {
+                        size_t size = 0;
+                        for (int i = 0; i < iovcnt; i++) {
+                                size += iov[i].iov_len;
+                        }
+
+                        err = file->FS_if->fs_readv(file->FS_hdl,
+                                                    file->f_hdl,
+                                                    iov,
+                                                    iovcnt,
+                                                    &file->f_lseek,
+                                                    rdcnt,
+                                                    file->f_flag.fattr);
+
+                        if (!err) {
+                                if ((*rdcnt < size) && !file->f_flag.fattr.non_blocking_rd) {
+                                        file->f_flag.eof = true;
+                                }
+
+                                if (cast(ssize_t, *rdcnt) >= 0) {
+                                        file->f_lseek += cast(u64_t, *rdcnt);
+                                }
+                        } else {
+                                file->f_flag.error = true;
+                        }
+                } else {
+                        file->f_flag.error = true;
+                        err = EPERM;
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function copy data from one file to another in kernel space.
+ *
+ * If source file can be mapped (e.g. romfs) then data is written directly
+ * from file system memory, otherwise data is copied by using kernel buffer.
+ * Copy is finished when selected number of bytes is copied or end of source
+ * file is reached. If destination accepts less data than was read then
+ * position of seekable source is moved back; for other sources (pipe, TTY)
+ * the rest of data is lost and EIO is returned with number of copied bytes.
+ *
+ * @param[in]  src              source file
+ * @param[in]  dst              destination file
+ * @param[in]  count            number of bytes to copy
+ * @param[out] cpcnt            number of copied bytes
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+int _vfs_fcopy(FILE *src, FILE *dst, size_t count, size_t *cpcnt)
+{
+        int err = EINVAL;
+
+        if (is_file_valid(src) && is_file_valid(dst) && count && cpcnt) {
+                *cpcnt = 0;
+
+                struct vfs_map map;
+                err = _vfs_fmap(src, &map);
+                if (!err) {
+                        if (src->f_lseek < map.size) {
+                                size_t n = min(count, cast(size_t, map.size - src->f_lseek));
+                                err = _vfs_fwrite(cast(const u8_t*, map.addr) + src->f_lseek,
+                                                  n, cpcnt, dst);
+                                if (!err) {
+                                        src->f_lseek += *cpcnt;
+                                }
+                        }
+
+                        return err;
+                }
+
+                size_t bufsz = min(count, VFS_COPY_BUFFER_SIZE);
+                u8_t  *buf   = NULL;
+
+                while ((err = _kmalloc(_MM_KRN, bufsz, cast(void**, &buf))) == ENOMEM) {
+                        bufsz /= 2;
+                        if (bufsz < 128) {
+                                return ENOMEM;
+                        }
+                }
+
+                while (!err && count) {
+                        size_t rdcnt = 0;
+                        err = _vfs_fread(buf, min(count, bufsz), &rdcnt, src);
+                        if (err || rdcnt == 0) {
+                                break;
+                        }
+
+                        size_t wrcnt = 0;
+                        err = _vfs_fwrite(buf, rdcnt, &wrcnt, dst);
+                        if (!err) {
+                                *cpcnt += wrcnt;
+                                count  -= wrcnt;
+
+                                if (wrcnt < rdcnt) {
+                                        if (_vfs_fseekable(src)) {
+                                                src->f_lseek -= (rdcnt - wrcnt);
+                                        } else {
+                                                err = EIO;
+                                        }
+                                        break;
+                                }
+                        }
+                }
+
+                _kfree(_MM_KRN, cast(void**, &buf));
+        }
+
+        return err;
+}
+
 //==============================================================================
 /**
  * @brief Function set seek value
@@ -1194,6 +1691,12 @@ int _vfs_vfioctl(FILE *file, int rq, va_list arg)
                 case IOCTL_VFS__IS_NON_BLOCKING_WR_MODE:
                         *va_arg(arg, bool*) = file->f_flag.fattr.non_blocking_wr;
                         return ESUCC;
+
+                case IOCTL_VFS__MAP_RO:
+                        return _vfs_fmap(file, va_arg(arg, struct vfs_map*));
+
+                case IOCTL_VFS__POLL:
+                        return _vfs_fpoll(file, va_arg(arg, int*));
                 }
 
                 return file->FS_if->fs_ioctl(file->FS_hdl,
@@ -1204,6 +1707,35 @@ int _vfs_vfioctl(FILE *file, int rq, va_list arg)
         }
 }
 
+//==============================================================================
+/**
+ * @brief Function returns read-only pointer to the file content. Only file
+ *        systems that keep file content in contiguous memory (e.g. flash)
+ *        support this operation, other return ENOTSUP. The map is valid until
+ *        file is closed.
+ *
+ * @param[in]  *file            file object
+ * @param[out] *map             file map
+ *
+ * @return One of errno value (errno.h)
+ */
+//==============================================================================
+int _vfs_fmap(FILE *file, struct vfs_map *map)
+{
+        int err = EINVAL;
+
+        if (is_file_valid(file) && map) {
+                if (file->f_flag.rd && !file->f_flag.wr) {
+                        err = file->FS_if->fs_ioctl(file->FS_hdl, file->f_hdl,
+                                                    IOCTL_VFS__MAP_RO, map);
+                } else {
+                        err = EPERM;
+                }
+        }
+
+        return err;
+}
+
 //==============================================================================
 /**
  * @brief Function returns file/dir status
@@ -1229,6 +1761,22 @@ int _vfs_fstat(FILE *file, struct stat *stat)
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief Function check if data of file can be read again after seek (regular
+ *        file). Pipes, sockets and device files are treated as streams.
+ *
+ * @param[in] *file             file object
+ *
+ * @return True if file is seekable.
+ */
+//==============================================================================
+bool _vfs_fseekable(FILE *file)
+{
+        struct stat stat;
+        return (_vfs_fstat(file, &stat) == ESUCC) && (stat.st_type == FILE_TYPE_REGULAR);
+}
+
 //==============================================================================
 /**
  * @brief Function flush file data
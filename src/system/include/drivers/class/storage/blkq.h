@@ -0,0 +1,116 @@
+/*==============================================================================
+File    blkq.h
+
+Author  Daniel Zorychta
+
+Brief   Block device request queue.
+
+        Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+        This program is free software; you can redistribute it and/or modify
+        it under the terms of the GNU General Public License as published by
+        the Free Software Foundation and modified by the dnx RTOS exception.
+
+        NOTE: The modification  to the GPL is  included to allow you to
+              distribute a combined work that includes dnx RTOS without
+              being obliged to provide the source  code for proprietary
+              components outside of the dnx RTOS.
+
+        The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+        but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+        MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+        GNU General Public License for more details.
+
+        Full license text is available on the following file: doc/license.txt.
+
+==============================================================================*/
+
+/**
+@defgroup BLKQ_H_ BLKQ_H_
+
+Block device request queue. Requests of all tasks that access the same device
+are collected in a queue and dispatched by elevator (ascending position order)
+with deadline guarantee. Adjacent requests of the same direction are merged
+and dispatched as single multi-block transfer.
+*/
+/**@{*/
+
+#ifndef _BLKQ_H_
+#define _BLKQ_H_
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "fs/vfs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==============================================================================
+  Exported macros
+==============================================================================*/
+
+/*==============================================================================
+  Exported object types
+==============================================================================*/
+/**
+ * Block request.
+ */
+typedef struct blkq_req {
+        struct blkq_req *next;          //!< next request (queue internal)
+        dev_t            dev;           //!< device
+        u8_t            *buf;           //!< data buffer
+        u32_t            blkpos;        //!< block position
+        size_t           blksz;         //!< block size
+        size_t           blkcnt;        //!< block count
+        bool             write;         //!< write request
+        bool             done;          //!< request finished (queue internal)
+        u32_t            tref;          //!< submit time (queue internal)
+        int              err;           //!< request status
+} blkq_req_t;
+
+/**
+ * Queue statistics.
+ */
+struct blkq_stat {
+        u32_t requests;                 //!< number of submitted requests
+        u32_t merged;                   //!< number of requests merged with other request
+        u32_t transfers;                //!< number of driver transfers
+        u32_t expired;                  //!< number of requests dispatched by deadline
+        u16_t depth;                    //!< number of queued requests
+        u16_t max_depth;                //!< maximum number of queued requests
+        u64_t rd_bytes;                 //!< number of read bytes
+        u64_t wr_bytes;                 //!< number of written bytes
+};
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  Exported functions
+==============================================================================*/
+extern int _blkq_init(void);
+extern int _blkq_submit(blkq_req_t*, size_t);
+extern int _blkq_read(dev_t, u32_t, size_t, size_t, u8_t*);
+extern int _blkq_write(dev_t, u32_t, size_t, size_t, const u8_t*);
+extern int sys_blkq_get_stat(size_t, dev_t*, struct blkq_stat*);
+
+/*==============================================================================
+  Exported inline functions
+==============================================================================*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BLKQ_H_ */
+
+/**@}*/
+/*==============================================================================
+  End of file
+==============================================================================*/
@@ -225,6 +225,62 @@ enum SYS_FS_TYPE {
 #define API_FS_READ(fsname, ...)        _FS_EXTERN_C int _##fsname##_read(__VA_ARGS__)
 #endif
 
+#ifdef DOXYGEN
+/**
+ * @brief Macro creates unique name of file vectored write function.
+ *
+ * Function created by this macro is called by system when data from several
+ * buffers has to be written to selected file in single request. Function is
+ * optional. If file system does not implement it then system writes buffers
+ * one by one by using file write function.
+ *
+ * @note Macro can be used only by file system code.
+ *
+ * @param fsname        file system name
+ * @param fs_handle     [<b>void *</b>]         file system memory handler
+ * @param fhdl          [<b>void *</b>]         file handle (user defined)
+ * @param iov           [<b>const struct iovec *</b>] source buffer vector
+ * @param iovcnt        [<b>int</b>]            number of buffers in vector
+ * @param fpos          [<b>fpos_t *</b>]       file position indicator (can be modified)
+ * @param wrcnt         [<b>size_t *</b>]       number of wrote bytes
+ * @param fattr         [<b>struct vfs_fattr</b>] file access attributes
+ * @return One of @ref errno value.
+ *
+ * @see struct vfs_fattr
+ */
+#define API_FS_WRITEV(fsname, fs_handle, fhdl, iov, iovcnt, fpos, wrcnt, fattr)
+#else
+#define API_FS_WRITEV(fsname, ...)      _FS_EXTERN_C int _##fsname##_writev(__VA_ARGS__)
+#endif
+
+#ifdef DOXYGEN
+/**
+ * @brief Macro creates unique name of file vectored read function.
+ *
+ * Function created by this macro is called by system when data from selected
+ * file has to be read to several buffers in single request. Function is
+ * optional. If file system does not implement it then system reads buffers
+ * one by one by using file read function.
+ *
+ * @note Macro can be used only by file system code.
+ *
+ * @param fsname        file system name
+ * @param fs_handle     [<b>void *</b>]         file system memory handler
+ * @param fhdl          [<b>void *</b>]         file handle (user defined)
+ * @param iov           [<b>const struct iovec *</b>] destination buffer vector
+ * @param iovcnt        [<b>int</b>]            number of buffers in vector
+ * @param fpos          [<b>fpos_t *</b>]       file position indicator (can be modified)
+ * @param rdcnt         [<b>size_t *</b>]       number of read bytes
+ * @param fattr         [<b>struct vfs_fattr</b>] file access attributes
+ * @return One of @ref errno value.
+ *
+ * @see struct vfs_fattr
+ */
+#define API_FS_READV(fsname, fs_handle, fhdl, iov, iovcnt, fpos, rdcnt, fattr)
+#else
+#define API_FS_READV(fsname, ...)       _FS_EXTERN_C int _##fsname##_readv(__VA_ARGS__)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief Macro creates unique name of file ioctl function.
@@ -400,6 +456,36 @@ enum SYS_FS_TYPE {
 #define API_FS_READDIR(fsname, ...)     _FS_EXTERN_C int _##fsname##_readdir(__VA_ARGS__)
 #endif
 
+#ifdef DOXYGEN
+/**
+ * @brief Macro creates unique name of bulk read directory function.
+ *
+ * Function created by this macro is called by system when many directory
+ * entries have to be read in single request. Function is optional. If file
+ * system does not implement it then system reads entries one by one by using
+ * read directory function. Records shall be put to buffer by using
+ * sys_dirent_rec_put() function. Function shall stop when record does not
+ * fit to buffer; the entry shall be returned by next call. End of directory
+ * is indicated by zero length.
+ *
+ * @note Macro can be used only by file system code.
+ *
+ * @param fsname        file system name
+ * @param fs_handle     [<b>void *</b>]         file system memory handler
+ * @param dir           [<b>DIR *</b>]          directory object (already created)
+ * @param buf           [<b>void *</b>]         record buffer
+ * @param size          [<b>size_t</b>]         buffer size
+ * @param flags         [<b>int</b>]            read flags (@ref READDIR_STAT)
+ * @param len           [<b>size_t *</b>]       number of bytes put to buffer
+ * @return One of @ref errno value.
+ *
+ * @see DIR, dirent_rec_t
+ */
+#define API_FS_READDIR_BULK(fsname, fs_handle, dir, buf, size, flags, len)
+#else
+#define API_FS_READDIR_BULK(fsname, ...) _FS_EXTERN_C int _##fsname##_readdir_bulk(__VA_ARGS__)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief Macro creates unique name of file remove function.
@@ -936,6 +1022,23 @@ static inline int sys_pipe_clear(pipe_t *pipe)
         return _pipe_clear(pipe);
 }
 
+//==============================================================================
+/**
+ * @brief  Return readiness of pipe (POLLIN, POLLOUT, POLLHUP)
+ *
+ * @note Function can be used only by file system code.
+ *
+ * @param  pipe         a pipe object
+ * @param  revents      ready events
+ *
+ * @return One of @ref errno value.
+ */
+//==============================================================================
+static inline int sys_pipe_poll(pipe_t *pipe, int *revents)
+{
+        return _pipe_poll(pipe, revents);
+}
+
 //==============================================================================
 /**
  * @brief  Function return size of programs table (number of programs)
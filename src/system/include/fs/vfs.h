@@ -68,6 +68,9 @@ extern "C" {
 #define SEEK_END                                VFS_SEEK_END
 #endif
 
+/* maximum size of kernel buffer used by in-kernel file copy */
+#define VFS_COPY_BUFFER_SIZE                    __OS_SYSTEM_COPY_BUFFER_SIZE__
+
 /* file access flags. Doxygen documentation in "fs/fs.h" */
 #ifndef O_RDONLY
 #define O_RDONLY                                00
@@ -122,6 +125,8 @@ extern "C" {
 #define IOCTL_VFS__NON_BLOCKING_WR_MODE         _IO(VFS,  0x03)
 #define IOCTL_VFS__DEFAULT_WR_MODE              _IO(VFS,  0x04)
 #define IOCTL_VFS__IS_NON_BLOCKING_WR_MODE      _IO(VFS,  0x05)
+#define IOCTL_VFS__MAP_RO                       _IOR(VFS, 0x06, struct vfs_map*)
+#define IOCTL_VFS__POLL                         _IOR(VFS, 0x07, int*)
 
 /* file system identificator */
 #define _VFS_FILE_SYSTEM_MAGIC_NO               0xD9EFD24F
@@ -139,6 +144,12 @@ struct vfs_dev_stat {
         u8_t  st_minor;                 /**< device minor number  */
 };
 
+/** read-only file map. Doxygen documentation in sys/ioctl.h */
+struct vfs_map {
+        const void *addr;               /**< address of file content */
+        size_t      size;               /**< size of file content    */
+};
+
 /** file write/read attributtes. Doxygen documentation in fs/fs.h */
 struct vfs_fattr {
         bool non_blocking_rd:1;         /**< non-blocking file read access */
@@ -161,6 +172,9 @@ typedef struct vfs_FS_itf {
         int (*fs_opendir )(void *fshdl, const char *path, struct vfs_dir *dir);
         int (*fs_closedir)(void *fshdl, struct vfs_dir *dir);
         int (*fs_readdir )(void *fshdl, struct vfs_dir *dir);
+        int (*fs_writev  )(void *fshdl, void  *fhdl, const struct iovec *iov, int iovcnt, fpos_t *fpos, size_t *wrcnt, struct vfs_fattr attr); /* optional */
+        int (*fs_readv   )(void *fshdl, void  *fhdl, const struct iovec *iov, int iovcnt, fpos_t *fpos, size_t *rdcnt, struct vfs_fattr attr); /* optional */
+        int (*fs_readdir_bulk)(void *fshdl, struct vfs_dir *dir, void *buf, size_t size, int flags, size_t *len); /* optional */
     #if __OS_ENABLE_FSTAT__ == _YES_
         int (*fs_stat   )(void *fshdl, const char *path, struct stat *stat);
     #endif
@@ -221,6 +235,10 @@ struct vfs_dir {
         size_t              d_items;        //!< number of items
         size_t              d_seek;         //!< seek
         dirent_t            dirent;         //!< directory entry data
+        char               *d_path;         //!< absolute directory path
+        const char         *d_fspath;       //!< directory path in file system (part of d_path)
+        bool                d_pending;      //!< dirent read but not returned yet
+        size_t              d_pending_seek; //!< seek of pending dirent
 };
 
 typedef struct vfs_dir DIR;
@@ -253,6 +271,8 @@ extern int  _vfs_mkfifo     (const struct vfs_path*, mode_t);
 extern int  _vfs_opendir    (const struct vfs_path*, DIR**);
 extern int  _vfs_closedir   (DIR*);
 extern int  _vfs_readdir    (DIR*, dirent_t**);
+extern int  _vfs_readdir_bulk(DIR*, void*, size_t, int, size_t*);
+extern bool _vfs_dirent_rec_put(void*, size_t, size_t*, const char*, const struct stat*);
 extern int  _vfs_seekdir    (DIR*, u32_t);
 extern int  _vfs_telldir    (DIR*, u32_t*);
 extern int  _vfs_remove     (const struct vfs_path*);
@@ -265,10 +285,18 @@ extern int  _vfs_fopen      (const struct vfs_path*, const char*, FILE**);
 extern int  _vfs_fclose     (FILE*, bool);
 extern int  _vfs_fwrite     (const void*, size_t, size_t*, FILE*);
 extern int  _vfs_fread      (void*, size_t, size_t*, FILE*);
+extern int  _vfs_fpwrite    (const void*, size_t, fpos_t, size_t*, FILE*);
+extern int  _vfs_fpread     (void*, size_t, fpos_t, size_t*, FILE*);
+extern int  _vfs_fwritev    (const struct iovec*, int, size_t*, FILE*);
+extern int  _vfs_freadv     (const struct iovec*, int, size_t*, FILE*);
+extern int  _vfs_fcopy      (FILE*, FILE*, size_t, size_t*);
 extern int  _vfs_fseek      (FILE*, i64_t, int);
 extern int  _vfs_ftell      (FILE*, i64_t*);
 extern int  _vfs_vfioctl    (FILE*, int, va_list);
+extern int  _vfs_fmap       (FILE*, struct vfs_map*);
+extern int  _vfs_fpoll      (FILE*, int*);
 extern int  _vfs_fstat      (FILE*, struct stat*);
+extern bool _vfs_fseekable  (FILE*);
 extern int  _vfs_fflush     (FILE*);
 extern int  _vfs_feof       (FILE*, int*);
 extern int  _vfs_clearerr   (FILE*);
@@ -91,8 +91,10 @@ extern "C" {
 #define ECONNRESET      40      //!< Connection reset (POSIX.1)
 #define EISCONN         41      //!< Socket is connected (POSIX.1)
 #define EALREADY        42      //!< Connection already in progress
+#define EINPROGRESS     43      //!< Operation now in progress
+#define EBADF           44      //!< Bad file number
 #ifndef DOXYGEN
-#define _ENUMBER        43      //!< total supported errors
+#define _ENUMBER        45      //!< total supported errors
 #endif
 
 /*==============================================================================
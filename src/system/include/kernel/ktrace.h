@@ -0,0 +1,112 @@
+/*=========================================================================*//**
+@file    ktrace.h
+
+@author  Daniel Zorychta
+
+@brief   Kernel event tracer
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+#ifndef _KTRACE_H_
+#define _KTRACE_H_
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+#include "sys/types.h"
+#include "dnx/procstat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==============================================================================
+  Exported macros
+==============================================================================*/
+
+/*==============================================================================
+  Exported object types
+==============================================================================*/
+/**
+ * Traced events. Event numbers are the same as published in procstat.h.
+ */
+enum _ktrace_event {
+        _KTRACE_SWITCH          = PROCSTAT_TRACE_SWITCH,
+        _KTRACE_SYSCALL_ENTER   = PROCSTAT_TRACE_SYSCALL_ENTER,
+        _KTRACE_SYSCALL_EXIT    = PROCSTAT_TRACE_SYSCALL_EXIT,
+        _KTRACE_SYSCALL_BEGIN   = PROCSTAT_TRACE_SYSCALL_BEGIN,
+        _KTRACE_SYSCALL_END     = PROCSTAT_TRACE_SYSCALL_END,
+        _KTRACE_BLOCK_RECEIVE   = PROCSTAT_TRACE_BLOCK_RECEIVE,
+        _KTRACE_BLOCK_SEND      = PROCSTAT_TRACE_BLOCK_SEND,
+        _KTRACE_DRIVER_READ     = PROCSTAT_TRACE_DRIVER_READ,
+        _KTRACE_DRIVER_WRITE    = PROCSTAT_TRACE_DRIVER_WRITE,
+        _KTRACE_DRIVER_DONE     = PROCSTAT_TRACE_DRIVER_DONE,
+        _KTRACE_ALLOC           = PROCSTAT_TRACE_ALLOC,
+        _KTRACE_FREE            = PROCSTAT_TRACE_FREE,
+};
+
+/**
+ * Trace record.
+ */
+typedef struct {
+        u32_t seq;                      //!< event sequence number
+        u32_t timestamp;                //!< event time [us]
+        u16_t pid;                      //!< PID of active process
+        u8_t  thread;                   //!< thread of active process
+        u8_t  event;                    //!< event (enum _ktrace_event)
+        u32_t arg[2];                   //!< event arguments
+} _ktrace_rec_t;
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  Exported functions
+==============================================================================*/
+#if __OS_TRACE_ENABLE__ > 0
+extern void _ktrace(enum _ktrace_event, uintptr_t, uintptr_t);
+extern bool _ktrace_enable(bool);
+extern void _ktrace_clear(void);
+extern int  _ktrace_get(size_t, _ktrace_rec_t*);
+#else
+#define _ktrace(event, arg0, arg1)
+#define _ktrace_enable(enable) ((void)(enable), false)
+#define _ktrace_clear()
+#endif
+
+/*==============================================================================
+  Exported inline functions
+==============================================================================*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _KTRACE_H_ */
+/*==============================================================================
+  End of file
+==============================================================================*/
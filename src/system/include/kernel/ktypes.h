@@ -47,6 +47,16 @@ extern "C" {
 /*==============================================================================
   Exported symbolic constants/macros
 ==============================================================================*/
+/** KERNELSPACE/USERSPACE: asynchronous I/O operation codes */
+#define LIO_READ                0
+#define LIO_WRITE               1
+
+/** KERNELSPACE/USERSPACE: poll events */
+#define POLLIN                  0x0001
+#define POLLOUT                 0x0004
+#define POLLERR                 0x0008
+#define POLLHUP                 0x0010
+#define POLLNVAL                0x0020
 
 /*==============================================================================
   Exported types, enums definitions
@@ -107,6 +117,25 @@ typedef struct {
         StaticEventGroup_t buffer;
 } flag_t;
 
+/** KERNELSPACE/USERSPACE: asynchronous I/O control block */
+struct aiocb {
+        fd_t             aio_fildes;     //!< file descriptor
+        void            *aio_buf;        //!< data buffer
+        size_t           aio_nbytes;     //!< number of bytes to transfer
+        fpos_t           aio_offset;     //!< file position
+        int              aio_lio_opcode; //!< operation (LIO_READ, LIO_WRITE)
+        sem_t           *aio_sem;        //!< semaphore signaled at completion (optional)
+        volatile int     _aio_err;       //!< request status (private)
+        volatile ssize_t _aio_ret;       //!< request result (private)
+};
+
+/** KERNELSPACE/USERSPACE: poll descriptor */
+struct pollfd {
+        fd_t             fd;             //!< file descriptor or socket
+        short            events;         //!< requested events
+        short            revents;        //!< returned events
+};
+
 /*==============================================================================
    Exported object declarations
 ==============================================================================*/
@@ -88,6 +88,7 @@ enum mutex_type {
 
 extern void     _kernel_start                      (void);
 extern u32_t    _kernel_get_time_ms                (void);
+extern u32_t    _kernel_get_time_us                (void);
 extern u32_t    _kernel_get_tick_counter           (void);
 extern int      _kernel_get_number_of_tasks        (void);
 extern void     _kernel_scheduler_lock             (void);
@@ -110,6 +111,8 @@ extern void     _task_yield_from_ISR               (bool);
 extern task_t  *_task_get_handle                   (void);
 extern void     _task_set_tag                      (task_t*, void*);
 extern void    *_task_get_tag                      (task_t*);
+extern void     _task_notify                       (task_t*);
+extern int      _task_notify_wait                  (const u32_t);
 
 extern int      _semaphore_create                  (size_t, size_t, sem_t**);
 extern int      _semaphore_destroy                 (sem_t*);
@@ -53,9 +53,10 @@ extern "C" {
 #define STACK_DEPTH_VERY_HUGE           ((128 * (__OS_TASK_MIN_STACK_DEPTH__)) + (__OS_IRQ_STACK_DEPTH__))
 #define STACK_DEPTH_CUSTOM(depth)       ((depth) + (__OS_IRQ_STACK_DEPTH__))
 
-#define _PROCESS_SYSCALL_FLAG(tid)      (1 << (tid))
 #define _PROCESS_EXIT_FLAG(tid)         (1 << ((tid) + 12))
 
+#define _PROCESS_CPU_LOAD_PERIOD_MS     1000
+
 #define _GVAR_STRUCT_NAME               global_variables
 #define GLOBAL_VARIABLES_SECTION        struct _GVAR_STRUCT_NAME
 #define GLOBAL_VARIABLES_SECTION_BEGIN  struct _GVAR_STRUCT_NAME {
@@ -144,8 +145,22 @@ typedef struct {
         u16_t       stack_size;         //!< stack size
         u16_t       stack_max_usage;    //!< max stack usage
         i16_t       priority;           //!< priority
+        bool        zombie;             //!< process finished and wait for destroy
+        u32_t       syscalls;           //!< number of system calls
+        u32_t       syscall_errors;     //!< number of system calls finished with error
+        u64_t       syscall_time;       //!< total time of system calls [us]
 } process_stat_t;
 
+/** USERSPACE: thread statistics */
+typedef struct {
+        tid_t       tid;                //!< thread ID
+        i16_t       priority;           //!< priority
+        u16_t       CPU_load;           //!< CPU load (1% = 10)
+        u16_t       stack_free;         //!< free stack (levels)
+        u32_t       switches;           //!< number of context switches
+        u64_t       runtime;            //!< CPU time [us]
+} thread_stat_t;
+
 /** USERSPACE: thread attributes */
 typedef struct {
         size_t stack_depth;             //!< stack depth
@@ -159,6 +174,7 @@ typedef struct {
         u16_t avg1min;                  //!< average CPU load within 1 minute (1% = 10)
         u16_t avg5min;                  //!< average CPU load within 5 minutes (1% = 10)
         u16_t avg15min;                 //!< average CPU load within 15 minutes (1% = 10)
+        u16_t IRQ_load;                 //!< system tick interrupt load within 1 second (1% = 10)
 } avg_CPU_load_t;
 
 /*==============================================================================
@@ -171,6 +187,8 @@ extern struct _GVAR_STRUCT_NAME *global;
 extern int                      _errno;
 extern const struct _prog_data  _prog_table[];
 extern const int                _prog_table_size;
+extern const u16_t              _prog_hash_table[];
+extern const int                _prog_hash_table_size;
 
 /*==============================================================================
   Exported function prototypes
@@ -192,17 +210,24 @@ extern size_t      _process_get_count                   (void);
 extern _process_t *_process_get_active                  (void);
 extern int         _process_get_pid                     (_process_t*, pid_t*);
 extern int         _process_get_event_flags             (_process_t*, flag_t**);
+extern void        _process_thread_notify               (_process_t*, tid_t, task_t*);
 extern int         _process_get_priority                (pid_t, int*);
 extern int         _process_get_container               (pid_t, _process_t**);
 extern int         _process_get_stat_seek               (size_t, process_stat_t*);
 extern int         _process_get_stat_pid                (pid_t, process_stat_t*);
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+extern void        _process_syscall_stat_update         (_process_t*, u32_t, int);
+#endif
 extern tid_t       _process_get_active_thread           (void);
 extern u8_t        _process_get_max_threads             (_process_t*);
 extern int         _process_thread_create               (_process_t*, thread_func_t, const thread_attr_t*, void*, tid_t*);
 extern int         _process_thread_kill                 (_process_t*, tid_t);
 extern task_t     *_process_thread_get_task             (_process_t *proc, tid_t tid);
+extern int         _process_thread_get_stat_seek        (pid_t, size_t, thread_stat_t*);
 extern void        _task_switched_in                    (task_t *task, void *task_tag);
 extern void        _task_switched_out                   (task_t *task, void *task_tag);
+extern void        _task_tick_begin                     (void);
+extern void        _task_tick_end                       (void);
 extern void        _calculate_CPU_load                  (void);
 extern int         _get_average_CPU_load                (avg_CPU_load_t*);
 extern void        _task_get_process_container          (task_t*, _process_t**, tid_t*);
@@ -41,6 +41,7 @@ extern "C" {
 /*==============================================================================
   Exported macros
 ==============================================================================*/
+#define _SYSCALL_STAT_HIST_BINS         16
 
 /*==============================================================================
   Exported object types
@@ -60,6 +61,7 @@ typedef enum {// NAME                      | RETURN TYPE    | ARG 1
         SYSCALL_PROCESSGETSYNCFLAG,     // | int            | pid_t *pid                | flag_t **obj                        |                           |                           |                                           |
         SYSCALL_PROCESSSTATSEEK,        // | int            | size_t *seek              | process_stat_t *stat                |                           |                           |                                           |
         SYSCALL_PROCESSSTATPID,         // | int            | pid_t *pid                | process_stat_t *stat                |                           |                           |                                           |
+        SYSCALL_THREADSTATSEEK,         // | int            | pid_t *pid                | size_t *seek                        | thread_stat_t *stat       |                           |                                           |
         SYSCALL_PROCESSGETPID,          // | pid_t          |                           |                                     |                           |                           |                                           |
         SYSCALL_PROCESSGETPRIO,         // | int            | pid_t *pid                |                                     |                           |                           |                                           |
     #if __OS_ENABLE_GETCWD__ == _YES_
@@ -76,7 +78,8 @@ typedef enum {// NAME                      | RETURN TYPE    | ARG 1
         SYSCALL_MUTEXDESTROY,           // | void           | mutex_t *mutex            |                                     |                           |                           |                                           |
         SYSCALL_QUEUECREATE,            // | queue_t*       | const size_t *length      | const size_t *item_size             |                           |                           |                                           |
         SYSCALL_QUEUEDESTROY,           // | void           | queue_t *queue            |                                     |                           |                           |                                           |
-#define _SYSCALL_GROUP_0_OS_NON_BLOCKING  SYSCALL_QUEUEDESTROY // this group ends at ^this^ syscall --------------------------+---------------------------+---------------------------+-------------------------------------------+
+        SYSCALL_AIOSUBMIT,              // | int            | struct aiocb *aiocb       |                                     |                           |                           |                                           |
+#define _SYSCALL_GROUP_0_OS_NON_BLOCKING  SYSCALL_AIOSUBMIT    // this group ends at ^this^ syscall --------------------------+---------------------------+---------------------------+-------------------------------------------+
         SYSCALL_THREADKILL,             // | int            | tid_t *tid                |                                     |                           |                           |                                           |
         SYSCALL_PROCESSCREATE,          // | pid_t          | const char *command       | process_attr_t *attr                |                           |                           |                                           |
         SYSCALL_PROCESSCLEANZOMBIE,     // | int            | pid_t *pid                | int *status                         |                           |                           |                                           |
@@ -98,6 +101,7 @@ typedef enum {// NAME                      | RETURN TYPE    | ARG 1
         SYSCALL_OPENDIR,                // | DIR*           | const char *pathname      |                                     |                           |                           |                                           |
         SYSCALL_CLOSEDIR,               // | int            | DIR *dir                  |                                     |                           |                           |                                           |
         SYSCALL_READDIR,                // | dirent_t*      | DIR *dir                  |                                     |                           |                           |                                           |
+        SYSCALL_READDIRBULK,            // | ssize_t        | DIR *dir                  | void *buf                           | size_t *size              | int *flags                |                                           |
     #if __OS_ENABLE_REMOVE__ == _YES_
         SYSCALL_REMOVE,                 // | int            | const char *path          |                                     |                           |                           |                                           |
     #endif
@@ -123,9 +127,13 @@ typedef enum {// NAME                      | RETURN TYPE    | ARG 1
         SYSCALL_FCLOSE,                 // | int            | FILE *file                |                                     |                           |                           |                                           |
         SYSCALL_FWRITE,                 // | size_t         | const void *src           | size_t *size                        | size_t *count             | FILE *file                |                                           |
         SYSCALL_FREAD,                  // | size_t         | void *dst                 | size_t *size                        | size_t *count             | FILE *file                |                                           |
+        SYSCALL_WRITEV,                 // | ssize_t        | FILE *file                | const struct iovec *iov             | int *iovcnt               |                           |                                           |
+        SYSCALL_READV,                  // | ssize_t        | FILE *file                | const struct iovec *iov             | int *iovcnt               |                           |                                           |
+        SYSCALL_FCOPY,                  // | ssize_t        | FILE *src                 | FILE *dst                           | size_t *len               |                           |                                           |
         SYSCALL_FSEEK,                  // | int            | FILE *file                | i64_t  *seek                        | int    *origin            |                           |                                           |
         SYSCALL_IOCTL,                  // | int            | FILE *file                | int *request                        | va_list *arg              |                           |                                           |
         SYSCALL_FFLUSH,                 // | int            | FILE *file                |                                     |                           |                           |                                           |
+        SYSCALL_POLL,                   // | int            | struct pollfd *fds        | size_t *nfds                        | u32_t *timeout            |                           |                                           |
         SYSCALL_SYNC,                   // | void           |                           |                                     |                           |                           |                                           |
     #if __OS_ENABLE_TIMEMAN__ == _YES_
         SYSCALL_GETTIME,                // | time_t         |                           |                                     |                           |                           |                                           |
@@ -145,6 +153,7 @@ typedef enum {// NAME                      | RETURN TYPE    | ARG 1
         SYSCALL_NETACCEPT,              // | int            | SOCKET *socket            | SOCKET **new_socket                 |                           |                           |                                           |
         SYSCALL_NETRECV,                // | int            | SOCKET *socket            | void *buf                           | size_t *len               | NET_flags_t *flags        |                                           |
         SYSCALL_NETSEND,                // | int            | SOCKET *socket            | const void *buf                     | size_t *len               | NET_flags_t *flags        |                                           |
+        SYSCALL_NETSENDFILE,            // | int            | SOCKET *socket            | FILE *file                          | size_t *len               |                           |                                           |
         SYSCALL_NETGETHOSTBYNAME,       // | int            | NET_family_t *family      | const char *name                    | void *addr                | size_t *addr_size         |                                           |
         SYSCALL_NETSETRECVTIMEOUT,      // | int            | SOCKET *socket            | uint32_t *timeout                   |                           |                           |                                           |
         SYSCALL_NETSETSENDTIMEOUT,      // | int            | SOCKET *socket            | uint32_t *timeout                   |                           |                           |                                           |
@@ -159,6 +168,16 @@ typedef enum {// NAME                      | RETURN TYPE    | ARG 1
         _SYSCALL_COUNT
 } syscall_t;
 
+/** KERNELSPACE: system call statistics (times in microseconds) */
+typedef struct {
+        u32_t calls;                            //!< number of calls
+        u32_t errors;                           //!< number of calls finished with error
+        u32_t max_time;                         //!< maximum call time (wait + service)
+        u64_t wait_time;                        //!< total time of waiting in queue
+        u64_t service_time;                     //!< total time of handling
+        u32_t hist[_SYSCALL_STAT_HIST_BINS];    //!< log2 histogram of call time
+} _syscall_stat_t;
+
 /*==============================================================================
   Exported objects
 ==============================================================================*/
@@ -171,6 +190,12 @@ extern pid_t _syscall_client_PID[__OS_TASK_MAX_SYSTEM_THREADS__];
 extern void syscall(syscall_t syscall, void *retptr, ...);
 extern int  _syscall_init();
 extern int  _syscall_kworker_process(int, char**);
+extern int  _syscall_aio_cancel(struct _process*);
+extern int  _syscall_aio_suspend(const struct aiocb *const[], int, u32_t);
+extern int  _syscall_aio_fclose(FILE*);
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+extern int  _syscall_get_stat(size_t, const char**, _syscall_stat_t*);
+#endif
 
 /*==============================================================================
   Exported inline functions
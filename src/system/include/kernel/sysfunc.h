@@ -55,13 +55,17 @@
 #include "lib/stropt.h"
 #include "kernel/errno.h"
 #include "kernel/printk.h"
+#include "kernel/ktrace.h"
+#include "kernel/kpoll.h"
 #include "kernel/kwrapper.h"
 #include "kernel/time.h"
 #include "kernel/process.h"
 #include "kernel/syscall.h"
 #include "mm/cache.h"
+#include "net/netm.h"
 #include "fs/vfs.h"
 #include "drivers/drvctrl.h"
+#include "drivers/class/storage/blkq.h"
 #include "cpu/cpuctl.h"
 
 #ifdef __cplusplus
@@ -2296,6 +2300,33 @@ static inline int sys_readdir(DIR *dir, dirent_t **dirent)
         return _vfs_readdir(dir, dirent);
 }
 
+//==============================================================================
+/**
+ * @brief Function puts directory entry record to bulk read buffer.
+ *
+ * The function is used by file systems that implement bulk directory read
+ * (API_FS_READDIR_BULK). Record is aligned and put at offset <i>len</i> of
+ * buffer, the <i>len</i> is increased by record length.
+ *
+ * @note Function can be used only by file system code.
+ *
+ * @param buf           record buffer
+ * @param size          buffer size
+ * @param len           number of used bytes in buffer
+ * @param name          file name
+ * @param stat          file attributes
+ *
+ * @return If record fits to the buffer then true is returned, otherwise false.
+ *
+ * @see API_FS_READDIR_BULK
+ */
+//==============================================================================
+static inline bool sys_dirent_rec_put(void *buf, size_t size, size_t *len,
+                                      const char *name, const struct stat *stat)
+{
+        return _vfs_dirent_rec_put(buf, size, len, name, stat);
+}
+
 //==============================================================================
 /**
  * @brief Function remove selected file.
@@ -2992,6 +3023,75 @@ static inline int sys_fflush(FILE *file)
         return _vfs_fflush(file);
 }
 
+//==============================================================================
+/**
+ * @brief Function notifies threads waiting in poll() that readiness was changed.
+ *
+ * The function should be called by driver that supports
+ * @ref IOCTL_VFS__POLL request each time when device becomes ready for
+ * reading or writing (e.g. new data was received). Threads that poll the
+ * object registered by sys_poll_watch() check readiness of their files
+ * again; other waiting threads are not woken.
+ *
+ * @note Function can be used only by file system or driver code. Function
+ *       cannot be called from interrupt.
+ *
+ * @param obj   changed object (e.g. device handle), NULL wakes all threads
+ *
+ * @b Example
+ * @code
+        // ...
+
+        API_MOD_IOCTL(DEV, void *device_handle, int request, void *arg)
+        {
+                switch (request) {
+                case IOCTL_VFS__POLL:
+                        sys_poll_watch(device_handle);
+                        *cast(int*, arg) = has_data ? POLLIN : 0;
+                        return ESUCC;
+
+                // ...
+                }
+        }
+
+        static void rx_thread(void *device_handle)
+        {
+                // ... data received
+                sys_poll_notify(device_handle);
+        }
+
+        // ...
+   @endcode
+ *
+ * @see sys_poll_watch()
+ */
+//==============================================================================
+static inline void sys_poll_notify(const void *obj)
+{
+        _kpoll_notify(obj);
+}
+
+//==============================================================================
+/**
+ * @brief Function registers object of file that is polled at the moment.
+ *
+ * The function should be called by driver in @ref IOCTL_VFS__POLL request
+ * handler. Thread waiting in poll() is then woken only when the same object
+ * is passed to sys_poll_notify(). If driver does not register object then
+ * thread is woken by notification of any object.
+ *
+ * @note Function can be used only by file system or driver code.
+ *
+ * @param obj   object (e.g. device handle)
+ *
+ * @see sys_poll_notify()
+ */
+//==============================================================================
+static inline void sys_poll_watch(const void *obj)
+{
+        _kpoll_watch(obj);
+}
+
 //==============================================================================
 /**
  * @brief Function tests the end-of-file indicator.
@@ -5015,6 +5115,44 @@ static inline size_t sys_get_mem_size()
         return _mm_get_mem_size();
 }
 
+//==============================================================================
+/**
+ * @brief  Function return memory usage details (static, kernel, file systems,
+ *         network, modules, programs, shared and cache memory).
+ *
+ * @note Function can be used only by file system or driver code.
+ *
+ * @param  usage        memory usage container
+ *
+ * @return One of errno value.
+ *
+ * @see sys_get_used_mem(), sys_get_free_mem()
+ */
+//==============================================================================
+static inline int sys_get_mem_usage_details(_mm_mem_usage_t *usage)
+{
+        return _mm_get_mem_usage_details(usage);
+}
+
+#if __ENABLE_NETWORK__ == _YES_
+//==============================================================================
+/**
+ * @brief  Function return status of selected network family.
+ *
+ * @note Function can be used only by file system or driver code.
+ *
+ * @param  family       network family
+ * @param  status       status container (family specific)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static inline int sys_net_ifstatus(NET_family_t family, NET_generic_status_t *status)
+{
+        return _net_ifstatus(family, status);
+}
+#endif
+
 //==============================================================================
 /**
  * @brief Function return OS time in milliseconds.
@@ -5748,6 +5886,119 @@ extern int sys_cache_write(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt
 //==============================================================================
 extern int sys_cache_read(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt, u8_t *buf);
 
+//==============================================================================
+/**
+ * @brief Function write blocks to selected file omitting cache (direct I/O).
+ *        Blocks are written to the driver in single request and cached blocks
+ *        of the written range are dropped. Function should be used for bulk
+ *        data transfers to not evict file system metadata from cache.
+ *
+ * @note Function can be used only by file system code.
+ *
+ * @param  file         file to write
+ * @param  blkpos       block position
+ * @param  blksz        block size
+ * @param  blkcnt       block count
+ * @param  buf          buffer to write from (blocks)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+extern int sys_cache_direct_write(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt, const u8_t *buf);
+
+//==============================================================================
+/**
+ * @brief Function read blocks from selected file omitting cache (direct I/O).
+ *        Blocks are read from the driver in single request and are not cached.
+ *        Dirty cached blocks of the read range are used instead of device
+ *        data. Function should be used for bulk data transfers to not evict
+ *        file system metadata from cache.
+ *
+ * @note Function can be used only by file system code.
+ *
+ * @param  file         file to read
+ * @param  blkpos       block position
+ * @param  blksz        block size
+ * @param  blkcnt       block count
+ * @param  buf          buffer to read (blocks)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+extern int sys_cache_direct_read(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt, u8_t *buf);
+
+//==============================================================================
+/**
+ * @brief  Function return statistics of cache subsystem (number of cached and
+ *         dirty blocks, cached data size, number of cache hits and misses).
+ *
+ * @note Function can be used only by file system or driver code.
+ *
+ * @param  stat         statistics container
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+extern int sys_cache_get_stat(struct cache_stat *stat);
+
+//==============================================================================
+/**
+ * @brief  Function return statistics of block device request queue (number
+ *         of requests, merged requests, driver transfers, queue depth, and
+ *         transferred bytes). Queues are created at first access to device.
+ *
+ * @note Function can be used only by file system or driver code.
+ *
+ * @param  idx          queue index
+ * @param  dev          queue device
+ * @param  stat         statistics container
+ *
+ * @return One of errno value. ENOENT if queue of selected index does not exist.
+ */
+//==============================================================================
+extern int sys_blkq_get_stat(size_t idx, dev_t *dev, struct blkq_stat *stat);
+
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+//==============================================================================
+/**
+ * @brief  Function return statistics of selected system call (number of
+ *         calls and errors, queue wait and service time, call time histogram).
+ *
+ * @note Function can be used only by file system or driver code.
+ *
+ * @param  no           system call number
+ * @param  name         system call name (can be NULL)
+ * @param  stat         statistics container
+ *
+ * @return One of errno value. ENOENT if system call does not exist.
+ */
+//==============================================================================
+static inline int sys_syscall_get_stat(size_t no, const char **name, _syscall_stat_t *stat)
+{
+        return _syscall_get_stat(no, name, stat);
+}
+#endif
+
+#if __OS_TRACE_ENABLE__ > 0
+//==============================================================================
+/**
+ * @brief  Function return record of kernel event tracer. Records are indexed
+ *         from the oldest one.
+ *
+ * @note Function can be used only by file system or driver code.
+ *
+ * @param  idx          record index
+ * @param  rec          record
+ *
+ * @return One of errno value. ENOENT if record of selected index does not exist.
+ */
+//==============================================================================
+static inline int sys_ktrace_get(size_t idx, _ktrace_rec_t *rec)
+{
+        return _ktrace_get(idx, rec);
+}
+#endif
+
 //==============================================================================
 /**
  * @brief  Function register new memory region. The region object should be
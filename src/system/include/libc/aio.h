@@ -0,0 +1,314 @@
+/*=========================================================================*//**
+@file    aio.h
+
+@author  Daniel Zorychta
+
+@brief   Asynchronous file input/output.
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/**
+\defgroup aio-h <aio.h>
+
+The library is used to read and write files asynchronously. Request is
+queued to the system I/O threads and calling thread continues execution.
+Request completion can be checked by using aio_error() function, signaled
+by semaphore assigned to the request, or waited by using aio_suspend()
+function. Several requests can be pending for the same file; each request
+transfers data at own file position (file position indicator of the file is
+not changed) and requests of the same file are realized one by one in
+submission order.
+
+Closing the file or exit of the process cancels pending requests of the file
+or process (request finishes with @ref ECANCELED error). Request that is
+already running is finished before the file or process is released.
+
+@note Control block and data buffer must be valid until request is finished.
+
+*/
+/**@{*/
+
+#ifndef _AIO_H_
+#define _AIO_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <sys/types.h>
+#include <kernel/syscall.h>
+#include <kernel/kwrapper.h>
+#include <kernel/builtinfunc.h>
+#include <kernel/errno.h>
+
+/*==============================================================================
+  Exported macros
+==============================================================================*/
+#ifdef DOXYGEN
+/** @brief Read operation. */
+#define LIO_READ                0
+
+/** @brief Write operation. */
+#define LIO_WRITE               1
+#endif
+
+/*==============================================================================
+  Exported object types
+==============================================================================*/
+#ifdef DOXYGEN
+/**
+ * @brief Asynchronous I/O control block.
+ *
+ * Fields started with underscore are private and should not be used directly.
+ *
+ * @see aio_read(), aio_write(), aio_error(), aio_return(), aio_suspend()
+ */
+struct aiocb {
+        fd_t             aio_fildes;     //!< file descriptor
+        void            *aio_buf;        //!< data buffer
+        size_t           aio_nbytes;     //!< number of bytes to transfer
+        fpos_t           aio_offset;     //!< file position
+        int              aio_lio_opcode; //!< operation (LIO_READ, LIO_WRITE)
+        sem_t           *aio_sem;        //!< semaphore signaled at completion (optional)
+        volatile int     _aio_err;       //!< request status (private)
+        volatile ssize_t _aio_ret;       //!< request result (private)
+};
+#endif
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  Exported functions
+==============================================================================*/
+
+/*==============================================================================
+  Exported inline functions
+==============================================================================*/
+//==============================================================================
+/**
+ * @brief Function queues asynchronous read request.
+ *
+ * The function aio_read() queues request that reads <i>aio_nbytes</i> bytes
+ * from the file <i>aio_fildes</i> at position <i>aio_offset</i> to the
+ * buffer <i>aio_buf</i>. Function returns immediately. When request is
+ * finished then semaphore <i>aio_sem</i> is signaled (if set).
+ *
+ * @param aiocb         control block
+ *
+ * @exception | @ref EINVAL
+ * @exception | @ref EBADF
+ * @exception | @ref ENOMEM
+ * @exception | @ref EAGAIN
+ *
+ * @return On success, \b 0 is returned. On error, \b -1 is returned, and
+ * \b errno is set appropriately.
+ *
+ * @b Example
+ * @code
+        #include <stdio.h>
+        #include <aio.h>
+
+        // ...
+
+        u8_t buf[512];
+
+        struct aiocb cb = {
+                .aio_fildes = fileno(file),
+                .aio_buf    = buf,
+                .aio_nbytes = sizeof(buf),
+                .aio_offset = 0
+        };
+
+        if (aio_read(&cb) == 0) {
+                // ... do other work ...
+
+                const struct aiocb *list[] = {&cb};
+                aio_suspend(list, 1, MAX_DELAY_MS);
+
+                if (aio_error(&cb) == 0) {
+                        ssize_t n = aio_return(&cb);
+                        // ...
+                }
+        }
+
+        // ...
+   @endcode
+ *
+ * @see aio_write(), aio_error(), aio_return(), aio_suspend()
+ */
+//==============================================================================
+static inline int aio_read(struct aiocb *aiocb)
+{
+        int r = -1;
+        if (aiocb) {
+                aiocb->aio_lio_opcode = LIO_READ;
+        }
+        syscall(SYSCALL_AIOSUBMIT, &r, aiocb);
+        return r;
+}
+
+//==============================================================================
+/**
+ * @brief Function queues asynchronous write request.
+ *
+ * The function aio_write() queues request that writes <i>aio_nbytes</i>
+ * bytes from the buffer <i>aio_buf</i> to the file <i>aio_fildes</i> at
+ * position <i>aio_offset</i>. Function returns immediately. When request is
+ * finished then semaphore <i>aio_sem</i> is signaled (if set).
+ *
+ * @param aiocb         control block
+ *
+ * @exception | @ref EINVAL
+ * @exception | @ref EBADF
+ * @exception | @ref ENOMEM
+ * @exception | @ref EAGAIN
+ *
+ * @return On success, \b 0 is returned. On error, \b -1 is returned, and
+ * \b errno is set appropriately.
+ *
+ * @b Example
+ * @code
+        #include <stdio.h>
+        #include <aio.h>
+
+        // ...
+
+        // double buffering: one buffer is written while second is filled
+        static u8_t buf[2][512];
+        struct aiocb cb[2] = {0};
+        sem_t *sem = semaphore_new(2, 0);
+        fpos_t pos = 0;
+
+        for (int i = 0; i < 2; i++) {
+                cb[i].aio_fildes = fileno(file);
+                cb[i].aio_buf    = buf[i];
+                cb[i].aio_nbytes = sizeof(buf[i]);
+                cb[i].aio_sem    = sem;
+        }
+
+        for (int i = 0; sampling; i ^= 1) {
+                const struct aiocb *list[] = {&cb[i]};
+                aio_suspend(list, 1, MAX_DELAY_MS);
+
+                fill_buffer(buf[i]);
+
+                cb[i].aio_offset = pos;
+                pos += sizeof(buf[i]);
+                aio_write(&cb[i]);
+        }
+
+        // ...
+   @endcode
+ *
+ * @see aio_read(), aio_error(), aio_return(), aio_suspend()
+ */
+//==============================================================================
+static inline int aio_write(struct aiocb *aiocb)
+{
+        int r = -1;
+        if (aiocb) {
+                aiocb->aio_lio_opcode = LIO_WRITE;
+        }
+        syscall(SYSCALL_AIOSUBMIT, &r, aiocb);
+        return r;
+}
+
+//==============================================================================
+/**
+ * @brief Function returns status of asynchronous request.
+ *
+ * @param aiocb         control block
+ *
+ * @return @ref EINPROGRESS if request is not finished yet, \b 0 if request
+ * finished successfully, otherwise error number of finished request.
+ *
+ * @see aio_read(), aio_write(), aio_return()
+ */
+//==============================================================================
+static inline int aio_error(const struct aiocb *aiocb)
+{
+        return aiocb ? aiocb->_aio_err : EINVAL;
+}
+
+//==============================================================================
+/**
+ * @brief Function returns result of finished asynchronous request.
+ *
+ * @param aiocb         control block
+ *
+ * @return Number of transferred bytes, or \b -1 if request failed or is not
+ * finished yet.
+ *
+ * @see aio_read(), aio_write(), aio_error()
+ */
+//==============================================================================
+static inline ssize_t aio_return(struct aiocb *aiocb)
+{
+        return (aiocb && aiocb->_aio_err != EINPROGRESS) ? aiocb->_aio_ret : -1;
+}
+
+//==============================================================================
+/**
+ * @brief Function waits for completion of asynchronous requests.
+ *
+ * The function aio_suspend() blocks calling thread until at least one
+ * request from <i>list</i> is finished (also canceled) or timeout expired.
+ * NULL entries in the list are ignored. Calling thread waits itself, system
+ * I/O threads are not occupied.
+ *
+ * @param list          list of control blocks
+ * @param nent          number of list entries
+ * @param timeout       timeout in milliseconds
+ *
+ * @exception | @ref ETIME
+ * @exception | @ref ENOMEM
+ *
+ * @return On success, \b 0 is returned. On error, \b -1 is returned, and
+ * \b errno is set appropriately.
+ *
+ * @see aio_read(), aio_write(), aio_error()
+ */
+//==============================================================================
+static inline int aio_suspend(const struct aiocb *const list[], int nent, u32_t timeout)
+{
+        int err = _builtinfunc(syscall_aio_suspend, list, nent, timeout);
+        if (err) {
+                _errno = err;
+        }
+        return err ? -1 : 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _AIO_H_ */
+
+/**@}*/
+/*==============================================================================
+  End of file
+==============================================================================*/
@@ -51,6 +51,16 @@ extern "C" {
 /*==============================================================================
   Exported macros
 ==============================================================================*/
+#ifdef DOXYGEN
+        /* macro defined in sys/types.h */
+        /**
+         * @brief Flag of readdir_bulk(): read all file attributes.
+         *
+         * If flag is set then all fields of record's <i>d_stat</i> are set.
+         * Otherwise only size, type and device fields are valid.
+         */
+        #define READDIR_STAT
+#endif
 
 /*==============================================================================
   Exported object types
@@ -71,6 +81,14 @@ extern "C" {
                 tfile_t filetype;       /*!< File type.*/
                 dev_t   dev;            /*!< Device address (if file type is driver).*/
         } dirent_t;
+
+        /* type defined in sys/types.h */
+        /** @brief Directory entry record used by bulk directory read. */
+        typedef struct dirent_rec {
+                u16_t       d_reclen;   /*!< Record length (offset to next record).*/
+                struct stat d_stat;     /*!< File attributes.*/
+                char        d_name[];   /*!< File name.*/
+        } dirent_rec_t;
 #else
         #ifndef __DIR_TYPE_DEFINED__
                 typedef struct vfs_dir DIR;
@@ -253,6 +271,72 @@ static inline struct dirent *readdir(DIR *dir)
         return dirent;
 }
 
+//==============================================================================
+/**
+ * @brief Function reads many directory entries in single call.
+ *
+ * The function fills buffer <i>buf</i> of size <i>size</i> by directory entry
+ * records (@ref dirent_rec_t) of directory stream <i>dir</i>. Each record
+ * contains file name and attributes, the <i>d_reclen</i> field is an offset
+ * to the next record. If <i>flags</i> contains @ref READDIR_STAT then all file
+ * attributes are read (mode, owner, modification time), so separate stat()
+ * call for each entry is not needed. Entries that do not fit to the buffer
+ * are returned by next call.
+ *
+ * @param dir           directory object
+ * @param buf           record buffer (aligned to 8 bytes)
+ * @param size          buffer size
+ * @param flags         read flags (0 or @ref READDIR_STAT)
+ *
+ * @exception | @ref EINVAL
+ * @exception | @ref ENOMEM
+ * @exception | ...
+ *
+ * @return On success, the number of bytes put to buffer is returned. On end
+ * of directory, 0 is returned. On error, \b -1 is returned, and \b errno is
+ * set appropriately (@ref EINVAL if buffer is too small for single record).
+ *
+ * @b Example
+ * @code
+        #include <stdio.h>
+        #include <dirent.h>
+        #include <errno.h>
+
+        // ...
+
+        DIR *dir = opendir("/foo/bar");
+        if (dir) {
+                static u64_t buf[128];
+                ssize_t len;
+
+                while ((len = readdir_bulk(dir, buf, sizeof(buf), READDIR_STAT)) > 0) {
+                        for (ssize_t off = 0; off < len;) {
+                                dirent_rec_t *rec = (dirent_rec_t *)((u8_t *)buf + off);
+
+                                printf("%s %u\n", rec->d_name, (uint)rec->d_stat.st_size);
+
+                                off += rec->d_reclen;
+                        }
+                }
+
+                closedir(dir);
+        } else {
+                perror("/foo/bar");
+        }
+
+        // ...
+   @endcode
+ *
+ * @see opendir(), readdir(), closedir()
+ */
+//==============================================================================
+static inline ssize_t readdir_bulk(DIR *dir, void *buf, size_t size, int flags)
+{
+        ssize_t r = -1;
+        syscall(SYSCALL_READDIRBULK, &r, dir, buf, &size, &flags);
+        return r;
+}
+
 //==============================================================================
 /**
  * Set the position of a directory stream.
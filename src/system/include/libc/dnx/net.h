@@ -217,6 +217,7 @@ extern "C" {
 #include <kernel/syscall.h>
 #include <kernel/builtinfunc.h>
 #include <stddef.h>
+#include <stdio.h>
 #include <net/netm.h>
 #include <lib/unarg.h>
 #include <errno.h>
@@ -616,6 +617,40 @@ static inline int socket_send(SOCKET *socket, const void *buf, size_t len, NET_f
 #endif
 }
 
+//==============================================================================
+/**
+ * @brief  The function is used to transmit file content to another transport
+ *         end-point. socket_sendfile() may be used only when the socket is in
+ *         a connected state. Data is read and sent in kernel space, so user
+ *         buffer is not required. If file can be mapped (e.g. romfs file)
+ *         then data is sent directly from file system memory.
+ *         Transfer starts at current file position. If socket accepts
+ *         less data than was read from stream file (pipe, TTY) then number
+ *         of sent bytes is returned and @ref errno is set to @ref EIO.
+ *
+ * @param  socket       The socket to use to send the data.
+ * @param  file         The file to send.
+ * @param  len          Maximum number of bytes to send.
+ *
+ * @return Number of bytes actually sent on the socket (0 at end of file), or
+ *         -1 on error and @ref errno value is set appropriately.
+ *
+ * @see socket_send(), socket_write()
+ */
+//==============================================================================
+static inline int socket_sendfile(SOCKET *socket, FILE *file, size_t len)
+{
+#if __ENABLE_NETWORK__ == _YES_
+        int result = -1;
+        syscall(SYSCALL_NETSENDFILE, &result, socket, file, &len);
+        return result;
+#else
+        UNUSED_ARG3(socket, file, len);
+        _errno = ENOTSUP;
+        return -1;
+#endif
+}
+
 //==============================================================================
 /**
  * @brief  The function is used to transmit a message to another transport
@@ -50,6 +50,7 @@ extern "C" {
 #include <kernel/khooks.h>
 #include <kernel/process.h>
 #include <kernel/printk.h>
+#include <kernel/ktrace.h>
 #include <mm/mm.h>
 #include <drivers/drvctrl.h>
 
@@ -89,7 +90,8 @@ typedef _mm_mem_usage_t memstat_t;
 /**
  * @brief Average CPU load
  *
- * The type contains average CPU load in 1, 5, and 15 minute periods. Values are
+ * The type contains average CPU load in 1, 5, and 15 minute periods. Averages
+ * are exponentially weighted moving averages updated every second. Values are
  * presented in tens of percents (1% is 10).
  *
  * @see get_average_CPU_load()
@@ -99,6 +101,7 @@ typedef struct {
         u16_t avg1min;                  /*!< average CPU load within 1 minute (1% = 10).*/
         u16_t avg5min;                  /*!< average CPU load within 5 minutes (1% = 10).*/
         u16_t avg15min;                 /*!< average CPU load within 15 minutes (1% = 10).*/
+        u16_t IRQ_load;                 /*!< system tick interrupt load within 1 second (1% = 10).*/
 } avg_CPU_load_t;
 #endif
 
@@ -1025,6 +1028,66 @@ static inline bool detect_kernel_panic(FILE *file)
         return r;
 }
 
+//==============================================================================
+/**
+ * @brief Function enable or disable kernel event tracer.
+ *
+ * The function trace_enable() starts or stops recording of kernel events
+ * (context switches, system calls, blocking, driver calls, memory allocations).
+ * Recorded events are available in the <i>/proc/stat/trace</i> file. Function
+ * does nothing if tracer is disabled in system configuration.
+ *
+ * @param  enable       true to start, false to stop recording
+ *
+ * @return Previous state of recording.
+ *
+ * @b Example
+ * @code
+        #include <dnx/os.h>
+
+        // ...
+
+        trace_clear();
+        bool prev = trace_enable(true);
+
+        // operation to trace
+
+        trace_enable(prev);
+
+        // ...
+
+   @endcode
+ */
+//==============================================================================
+static inline bool trace_enable(bool enable)
+{
+        return _builtinfunc(ktrace_enable, enable);
+}
+
+//==============================================================================
+/**
+ * @brief Function clear kernel event tracer buffer.
+ *
+ * The function trace_clear() drops all recorded kernel events.
+ *
+ * @b Example
+ * @code
+        #include <dnx/os.h>
+
+        // ...
+
+        trace_clear();
+
+        // ...
+
+   @endcode
+ */
+//==============================================================================
+static inline void trace_clear(void)
+{
+        _builtinfunc(ktrace_clear);
+}
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,275 @@
+/*=========================================================================*//**
+@file    procstat.h
+
+@author  Daniel Zorychta
+
+@brief   Binary records of procfs statistic files.
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/**
+\defgroup dnx-procstat-h <dnx/procstat.h>
+
+The library describes binary files of the <b>stat</b> directory of procfs
+(e.g. <i>/proc/stat/proc</i>). Files contain array of fixed size records that
+can be read directly to the structures without text parsing:
+
+\li <b>proc</b> -- one @ref procstat_proc_t record per process,
+\li <b>mem</b> -- one @ref procstat_mem_t record,
+\li <b>cache</b> -- one @ref procstat_cache_t record,
+\li <b>net</b> -- one @ref procstat_net_t record per network family,
+\li <b>blkq</b> -- one @ref procstat_blkq_t record per block device queue,
+\li <b>syscall</b> -- one @ref procstat_syscall_t record per system call
+    number. File exists if system call statistics are enabled in configuration,
+\li <b>trace</b> -- one @ref procstat_trace_t record per kernel event (oldest
+    first). File exists if kernel event tracer is enabled in configuration.
+
+Each record starts with @ref procstat_hdr_t header that contains layout
+version and record size. New fields are added only at the end of records, so
+collector should check version and use <i>size</i> field as offset of the
+next record.
+
+@b Example
+@code
+        #include <stdio.h>
+        #include <dnx/procstat.h>
+
+        // ...
+
+        FILE *f = fopen("/proc/stat/proc", "r");
+        if (f) {
+                procstat_proc_t rec;
+
+                while (fread(&rec, 1, sizeof(rec), f) == sizeof(rec)) {
+                        if (rec.hdr.version == PROCSTAT_VERSION) {
+                                printf("%s: %u bytes\n", rec.name, rec.memory_usage);
+                        }
+                }
+
+                fclose(f);
+        }
+
+        // ...
+@endcode
+
+*/
+/**@{*/
+
+#ifndef _PROCSTAT_H_
+#define _PROCSTAT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <sys/types.h>
+
+/*==============================================================================
+  Exported macros
+==============================================================================*/
+/** Current version of records layout. */
+#define PROCSTAT_VERSION                1
+
+/** Maximum length of process name (with null terminator). */
+#define PROCSTAT_NAME_LEN               32
+
+/** Maximum length of system call name (with null terminator). */
+#define PROCSTAT_SYSCALL_NAME_LEN       20
+
+/** Number of bins of system call time histogram. Bin 0 counts calls shorter
+    than 16 us, bin n counts calls shorter than 2^(n+4) us (and not shorter than
+    2^(n+3) us), the last bin counts also all longer calls. */
+#define PROCSTAT_SYSCALL_HIST_BINS      16
+
+/** Trace event: context switch. Task switched in is described by record PID
+    and thread; arg[0]: task handle. */
+#define PROCSTAT_TRACE_SWITCH           1
+
+/** Trace event: client requested system call; arg[0]: syscall number. */
+#define PROCSTAT_TRACE_SYSCALL_ENTER    2
+
+/** Trace event: system call returned to client; arg[0]: syscall number,
+    arg[1]: errno value. */
+#define PROCSTAT_TRACE_SYSCALL_EXIT     3
+
+/** Trace event: kworker thread started system call; arg[0]: syscall number,
+    arg[1]: client PID. */
+#define PROCSTAT_TRACE_SYSCALL_BEGIN    4
+
+/** Trace event: kworker thread finished system call; arg[0]: syscall number,
+    arg[1]: errno value. */
+#define PROCSTAT_TRACE_SYSCALL_END      5
+
+/** Trace event: task blocked on queue, mutex or semaphore take; arg[0]: object. */
+#define PROCSTAT_TRACE_BLOCK_RECEIVE    6
+
+/** Trace event: task blocked on queue send; arg[0]: object. */
+#define PROCSTAT_TRACE_BLOCK_SEND       7
+
+/** Trace event: driver read; arg[0]: device ID, arg[1]: number of bytes. */
+#define PROCSTAT_TRACE_DRIVER_READ      8
+
+/** Trace event: driver write; arg[0]: device ID, arg[1]: number of bytes. */
+#define PROCSTAT_TRACE_DRIVER_WRITE     9
+
+/** Trace event: driver read/write finished; arg[0]: device ID, arg[1]: errno value. */
+#define PROCSTAT_TRACE_DRIVER_DONE      10
+
+/** Trace event: memory allocated; arg[0]: address, arg[1]: block size. */
+#define PROCSTAT_TRACE_ALLOC            11
+
+/** Trace event: memory freed; arg[0]: address, arg[1]: block size. */
+#define PROCSTAT_TRACE_FREE             12
+
+/*==============================================================================
+  Exported object types
+==============================================================================*/
+/** Record header. */
+typedef struct {
+        u16_t version;                  /*!< Record layout version (PROCSTAT_VERSION).*/
+        u16_t size;                     /*!< Record size in bytes.*/
+} procstat_hdr_t;
+
+/** Process record (file: proc). */
+typedef struct {
+        procstat_hdr_t hdr;             /*!< Record header.*/
+        u32_t pid;                      /*!< Process ID.*/
+        u32_t memory_usage;             /*!< Memory allocated by process.*/
+        u16_t memory_block_count;       /*!< Number of used memory blocks.*/
+        u16_t files_count;              /*!< Number of opened files.*/
+        u16_t dir_count;                /*!< Number of opened directories.*/
+        u16_t mutexes_count;            /*!< Number of used mutexes.*/
+        u16_t semaphores_count;         /*!< Number of used semaphores.*/
+        u16_t queue_count;              /*!< Number of used queues.*/
+        u16_t socket_count;             /*!< Number of used sockets.*/
+        u16_t threads_count;            /*!< Number of threads.*/
+        u16_t CPU_load;                 /*!< CPU load (1% = 10).*/
+        u16_t stack_size;               /*!< Stack size.*/
+        u16_t stack_max_usage;          /*!< Maximum stack usage.*/
+        i16_t priority;                 /*!< Priority.*/
+        char  name[PROCSTAT_NAME_LEN];  /*!< Process name.*/
+        u32_t syscalls;                 /*!< Number of system calls.*/
+        u32_t syscall_errors;           /*!< Number of system calls finished with error.*/
+        u64_t syscall_time;             /*!< Total time of system calls [us].*/
+} procstat_proc_t;
+
+/** Memory record (file: mem). */
+typedef struct {
+        procstat_hdr_t hdr;             /*!< Record header.*/
+        u32_t size;                     /*!< Memory size.*/
+        u32_t used;                     /*!< Used memory.*/
+        u32_t free;                     /*!< Free memory.*/
+        i32_t static_memory_usage;      /*!< Memory used statically at build time.*/
+        i32_t kernel_memory_usage;      /*!< Memory used by kernel.*/
+        i32_t filesystems_memory_usage; /*!< Memory used by file systems.*/
+        i32_t network_memory_usage;     /*!< Memory used by network subsystem.*/
+        i32_t modules_memory_usage;     /*!< Memory used by modules (drivers).*/
+        i32_t programs_memory_usage;    /*!< Memory used by programs.*/
+        i32_t shared_memory_usage;      /*!< Memory used by shared buffers.*/
+        i32_t cached_memory_usage;      /*!< Memory used by disc caches.*/
+} procstat_mem_t;
+
+/** Disc cache record (file: cache). */
+typedef struct {
+        procstat_hdr_t hdr;             /*!< Record header.*/
+        u32_t blocks;                   /*!< Number of cached blocks.*/
+        u32_t dirty;                    /*!< Number of dirty blocks.*/
+        u32_t bytes;                    /*!< Size of cached data.*/
+        u32_t hits;                     /*!< Number of blocks read from cache.*/
+        u32_t misses;                   /*!< Number of blocks read from device.*/
+} procstat_cache_t;
+
+/** Network record (file: net). */
+typedef struct {
+        procstat_hdr_t hdr;             /*!< Record header.*/
+        u16_t family;                   /*!< Network family (NET_family_t).*/
+        u16_t state;                    /*!< Family specific state (e.g. NET_INET_state_t).*/
+        u64_t tx_bytes;                 /*!< Number of transmitted bytes.*/
+        u64_t rx_bytes;                 /*!< Number of received bytes.*/
+        u64_t tx_packets;               /*!< Number of transmitted packets.*/
+        u64_t rx_packets;               /*!< Number of received packets.*/
+} procstat_net_t;
+
+/** Block device queue record (file: blkq). */
+typedef struct {
+        procstat_hdr_t hdr;             /*!< Record header.*/
+        u32_t dev;                      /*!< Device ID.*/
+        u32_t requests;                 /*!< Number of submitted requests.*/
+        u32_t merged;                   /*!< Number of requests merged with other request.*/
+        u32_t transfers;                /*!< Number of driver transfers.*/
+        u32_t expired;                  /*!< Number of requests dispatched by deadline.*/
+        u16_t depth;                    /*!< Number of queued requests.*/
+        u16_t max_depth;                /*!< Maximum number of queued requests.*/
+        u64_t rd_bytes;                 /*!< Number of read bytes.*/
+        u64_t wr_bytes;                 /*!< Number of written bytes.*/
+} procstat_blkq_t;
+
+/** System call record (file: syscall). Times are in microseconds. Call time
+    is counted from sending request to kworker queue. */
+typedef struct {
+        procstat_hdr_t hdr;             /*!< Record header.*/
+        u32_t no;                       /*!< System call number.*/
+        char  name[PROCSTAT_SYSCALL_NAME_LEN]; /*!< System call name.*/
+        u32_t calls;                    /*!< Number of calls.*/
+        u32_t errors;                   /*!< Number of calls finished with error.*/
+        u32_t max_time;                 /*!< Maximum call time.*/
+        u64_t wait_time;                /*!< Total time of waiting in kworker queue.*/
+        u64_t service_time;             /*!< Total time of handling.*/
+        u32_t hist[PROCSTAT_SYSCALL_HIST_BINS]; /*!< Call time histogram.*/
+} procstat_syscall_t;
+
+/** Kernel event record (file: trace). */
+typedef struct {
+        procstat_hdr_t hdr;             /*!< Record header.*/
+        u32_t seq;                      /*!< Event sequence number.*/
+        u32_t timestamp;                /*!< Event time [us] (wraps after ~71 minutes).*/
+        u16_t pid;                      /*!< PID of active process (0 if kernel task).*/
+        u8_t  thread;                   /*!< Thread of active process.*/
+        u8_t  event;                    /*!< Event (PROCSTAT_TRACE_*).*/
+        u32_t arg[2];                   /*!< Event arguments.*/
+} procstat_trace_t;
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  Exported functions
+==============================================================================*/
+
+/*==============================================================================
+  Exported inline functions
+==============================================================================*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PROCSTAT_H_ */
+
+/**@}*/
+/*==============================================================================
+  End of file
+==============================================================================*/
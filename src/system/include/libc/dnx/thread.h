@@ -183,8 +183,25 @@ typedef struct {
         u16_t       stack_max_usage;    /*!< max stack usage.*/
         i16_t       priority;           /*!< priority.*/
         bool        zombie;             /*!< process finished and wait for destory.*/
+        u32_t       syscalls;           /*!< number of system calls.*/
+        u32_t       syscall_errors;     /*!< number of system calls finished with error.*/
+        u64_t       syscall_time;       /*!< total time of system calls [us].*/
 } process_stat_t;
 
+/**
+ * @brief Thread statistics container.
+ *
+ * The type represent thread statistics.
+ */
+typedef struct {
+        tid_t       tid;                /*!< thread ID.*/
+        i16_t       priority;           /*!< priority.*/
+        u16_t       CPU_load;           /*!< CPU load (1% = 10).*/
+        u16_t       stack_free;         /*!< free stack (levels).*/
+        u32_t       switches;           /*!< number of context switches.*/
+        u64_t       runtime;            /*!< CPU time [us].*/
+} thread_stat_t;
+
 /**
  * @brief Thread function pointer
  */
@@ -488,6 +505,52 @@ static inline int process_stat(pid_t pid, process_stat_t *stat)
         return r;
 }
 
+//==============================================================================
+/**
+ * @brief Function returns statistics of selected thread of process.
+ *
+ * The function thread_stat_seek() return statistics of thread of process
+ * selected by <i>pid</i>. Existing threads of process are selected by
+ * <i>seek</i> (starting from 0). CPU load and CPU time are provided if CPU
+ * load monitoring is enabled in system configuration.
+ *
+ * @param pid       PID
+ * @param seek      thread index
+ * @param stat      statistics
+ *
+ * @exception | @ref EINVAL
+ * @exception | @ref ENOENT
+ *
+ * @return Return 0 on success. On error, -1 is returned, and
+ * <b>errno</b> is set appropriately.
+ *
+ * @b Example
+ * @code
+        #include <dnx/thread.h>
+        #include <unistd.h>
+
+        // ...
+
+        thread_stat_t stat;
+        size_t        seek = 0;
+        while (thread_stat_seek(getpid(), seek++, &stat) == 0) {
+                printf("Thread %d: %u context switches\n", stat.tid, stat.switches);
+        }
+
+        // ...
+
+   @endcode
+ *
+ * @see process_stat()
+ */
+//==============================================================================
+static inline int thread_stat_seek(pid_t pid, size_t seek, thread_stat_t *stat)
+{
+        int r = -1;
+        syscall(SYSCALL_THREADSTATSEEK, &r, &pid, &seek, stat);
+        return r;
+}
+
 //==============================================================================
 /**
  * @brief Function returns PID of current process.
@@ -0,0 +1,168 @@
+/*=========================================================================*//**
+@file    poll.h
+
+@author  Daniel Zorychta
+
+@brief   Waiting for readiness of files and sockets.
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/**
+\defgroup poll-h <poll.h>
+
+The library is used to wait for readiness of several files and sockets at
+once. Calling thread sleeps until at least one object is ready or timeout
+expires. Pipes, sockets and drivers that support @ref IOCTL_VFS__POLL request
+(e.g. TTY) report readiness, other files are always ready.
+
+*/
+/**@{*/
+
+#ifndef _POLL_H_
+#define _POLL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <sys/types.h>
+#include <kernel/syscall.h>
+#include <kernel/kwrapper.h>
+#include <kernel/errno.h>
+
+/*==============================================================================
+  Exported macros
+==============================================================================*/
+#ifdef DOXYGEN
+/** @brief Data can be read without blocking. */
+#define POLLIN                  0x0001
+
+/** @brief Data can be written without blocking. */
+#define POLLOUT                 0x0004
+
+/** @brief Error condition (returned even if not requested). */
+#define POLLERR                 0x0008
+
+/** @brief Object was closed by peer (returned even if not requested). */
+#define POLLHUP                 0x0010
+
+/** @brief Invalid descriptor (returned even if not requested). */
+#define POLLNVAL                0x0020
+#endif
+
+/*==============================================================================
+  Exported object types
+==============================================================================*/
+#ifdef DOXYGEN
+/**
+ * @brief Poll descriptor.
+ *
+ * Field <i>fd</i> is file descriptor (fileno()) or socket pointer casted to
+ * @ref fd_t. Descriptors equal to \b -1 are ignored.
+ *
+ * @see poll()
+ */
+struct pollfd {
+        fd_t             fd;             //!< file descriptor or socket
+        short            events;         //!< requested events
+        short            revents;        //!< returned events
+};
+#endif
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  Exported functions
+==============================================================================*/
+
+/*==============================================================================
+  Exported inline functions
+==============================================================================*/
+//==============================================================================
+/**
+ * @brief Function waits for readiness of files and sockets.
+ *
+ * The function poll() waits until at least one of <i>nfds</i> objects
+ * described by <i>fds</i> is ready for requested <i>events</i> or timeout
+ * expires. Ready events are returned in <i>revents</i> field of each
+ * descriptor. Thread does not consume CPU time while waiting.
+ *
+ * @param fds           poll descriptors
+ * @param nfds          number of descriptors
+ * @param timeout       timeout in milliseconds (0: no waiting, -1: no timeout)
+ *
+ * @exception | @ref EINVAL
+ * @exception | @ref ENOMEM
+ *
+ * @return Number of ready descriptors, \b 0 on timeout. On error, \b -1 is
+ * returned, and \b errno is set appropriately.
+ *
+ * @b Example
+ * @code
+        #include <stdio.h>
+        #include <poll.h>
+        #include <dnx/net.h>
+
+        // ...
+
+        struct pollfd fds[] = {
+                {.fd = (fd_t)socket,    .events = POLLIN},
+                {.fd = fileno(pipe),    .events = POLLIN},
+        };
+
+        while (poll(fds, 2, -1) > 0) {
+                if (fds[0].revents & POLLIN) {
+                        // ... read socket
+                }
+
+                if (fds[1].revents & POLLIN) {
+                        // ... read pipe
+                }
+        }
+
+        // ...
+   @endcode
+ */
+//==============================================================================
+static inline int poll(struct pollfd *fds, size_t nfds, int timeout)
+{
+        u32_t tout = (timeout < 0) ? MAX_DELAY_MS : (u32_t)timeout;
+        int   r    = -1;
+        syscall(SYSCALL_POLL, &r, fds, &nfds, &tout);
+        return r;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _POLL_H_ */
+
+/**@}*/
+/*==============================================================================
+  End of file
+==============================================================================*/
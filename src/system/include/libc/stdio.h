@@ -220,13 +220,16 @@ static inline FILE *fopen(const char *path, const char *mode)
 /**
  * @brief Function closes selected file.
  *
- * The fclose() function closes the created stream <i>file</i>.
+ * The fclose() function closes the created stream <i>file</i>. Pending
+ * asynchronous requests of the file are canceled; calling thread waits for
+ * running request before file is closed.
  *
  * @param file          file to close
  *
  * @exception | @ref EINVAL
  * @exception | @ref ENOENT
  * @exception | @ref EFAULT
+ * @exception | @ref EBUSY
  *
  * @return Upon successful completion \b 0 is returned. Otherwise, @ref EOF is
  * returned and @ref errno is set to indicate the error. In either case any
@@ -255,6 +258,7 @@ static inline FILE *fopen(const char *path, const char *mode)
 static inline int fclose(FILE *file)
 {
         int r = EOF;
+        _builtinfunc(syscall_aio_fclose, file);
         syscall(SYSCALL_FCLOSE, &r, file);
         return r;
 }
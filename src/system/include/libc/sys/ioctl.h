@@ -106,6 +106,56 @@ extern "C" {
  * @see   ioctl()
  */
 #define IOCTL_VFS__DEFAULT_WR_MODE
+
+/**
+ * @brief Request returns read-only pointer to the file content.
+ *
+ * Request returns address and size of file content if file system keeps
+ * file in contiguous memory (e.g. romfs). File must be opened in read-only
+ * mode. The returned memory is valid until file is closed. Data can be
+ * used directly without copying (e.g. by socket_send() with
+ * @ref NET_FLAGS__NOCOPY flag). File systems that cannot map file content
+ * return @ref ENOTSUP error.
+ *
+ * @param [WR] @ref struct vfs_map*      file map
+ *
+ * @b Example
+ * @code
+        // ...
+
+        FILE *file = fopen("/rom/index.html", "r");
+        if (file) {
+                struct vfs_map map;
+                if (ioctl(fileno(file), IOCTL_VFS__MAP_RO, &map) == 0) {
+                        socket_send(socket, map.addr, map.size, NET_FLAGS__NOCOPY);
+                }
+
+                fclose(file);
+        }
+
+        // ...
+   @endcode
+ *
+ * @see   ioctl()
+ */
+#define IOCTL_VFS__MAP_RO
+
+/**
+ * @brief Request returns readiness of the file.
+ *
+ * Request returns events of file that are ready at the moment: @ref POLLIN,
+ * @ref POLLOUT, @ref POLLERR, @ref POLLHUP. Request is used by poll()
+ * function and should be implemented by drivers that can wait for data
+ * (the driver should register its object by <i>sys_poll_watch()</i> in
+ * this request and call <i>sys_poll_notify()</i> with the same object when
+ * readiness is changed). Files that do not support this request are always
+ * ready.
+ *
+ * @param [WR] int*     ready events
+ *
+ * @see   ioctl(), poll()
+ */
+#define IOCTL_VFS__POLL
 #endif
 
 /*==============================================================================
@@ -50,6 +50,10 @@ extern "C" {
 /*==============================================================================
   Exported macros
 ==============================================================================*/
+#ifndef DOXYGEN // Doxygen documentation inserted in dirent.h file
+/** @brief Bulk directory read flag: read all file attributes. */
+#define READDIR_STAT            (1 << 0)
+#endif
 
 /*==============================================================================
   Exported object types
@@ -200,6 +204,15 @@ struct stat {
         tfile_t st_type;        /*!< Type of file.*/
 };
 
+#ifndef DOXYGEN // Doxygen documentation inserted in dirent.h file
+/** @brief Directory entry record used by bulk directory read. */
+typedef struct dirent_rec {
+        u16_t       d_reclen;   //!< Record length (offset to next record)
+        struct stat d_stat;     //!< File attributes
+        char        d_name[];   //!< File name
+} dirent_rec_t;
+#endif
+
 /** file system statistic */
 struct statfs {
         u32_t       f_type;     /*!< File system type. @see @ref SYS_FS_TYPE*/
@@ -211,6 +224,14 @@ struct statfs {
         const char *f_fsname;   /*!< File system name.*/
 };
 
+#ifndef DOXYGEN // Doxygen documentation inserted in sys/uio.h file
+/** @brief I/O vector (buffer) used by vectored read and write operations. */
+struct iovec {
+        void   *iov_base;       //!< Buffer address
+        size_t  iov_len;        //!< Buffer size in bytes
+};
+#endif
+
 /*==============================================================================
   Exported objects
 ==============================================================================*/
@@ -0,0 +1,210 @@
+/*=========================================================================*//**
+@file    uio.h
+
+@author  Daniel Zorychta
+
+@brief   Vectored I/O operations.
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/**
+\defgroup sys-uio-h <sys/uio.h>
+
+The library is used to read and write several buffers in single operation.
+
+*/
+/**@{*/
+
+#ifndef _UIO_H_
+#define _UIO_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include <sys/types.h>
+#include <kernel/syscall.h>
+
+/*==============================================================================
+  Exported macros
+==============================================================================*/
+
+/*==============================================================================
+  Exported object types
+==============================================================================*/
+#ifdef DOXYGEN
+/**
+ * @brief I/O vector (buffer) used by vectored read and write operations.
+ *
+ * @see readv(), writev()
+ */
+struct iovec {
+        void   *iov_base;       //!< Buffer address
+        size_t  iov_len;        //!< Buffer size in bytes
+};
+#endif
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  Exported functions
+==============================================================================*/
+
+/*==============================================================================
+  Exported inline functions
+==============================================================================*/
+//==============================================================================
+/**
+ * @brief Function writes data from several buffers to file.
+ *
+ * The function writev() writes <i>iovcnt</i> buffers described by <i>iov</i>
+ * to the file associated with the file descriptor <i>fd</i>. Buffers are
+ * written in array order in single system request. Operation is handled
+ * natively by file system if supported, otherwise buffers are written one by
+ * one.
+ *
+ * @param fd            file descriptor
+ * @param iov           buffer vector
+ * @param iovcnt        number of buffers
+ *
+ * @exception | @ref EINVAL
+ * @exception | @ref ENOMEM
+ * @exception | @ref ENOSPC
+ * @exception | @ref EPERM
+ * @exception | ...
+ *
+ * @return On success, the number of bytes written is returned. On error,
+ * \b -1 is returned, and \b errno is set appropriately.
+ *
+ * @b Example
+ * @code
+        #include <stdio.h>
+        #include <sys/uio.h>
+
+        // ...
+
+        FILE *file = fopen("/foo/bar", "w");
+        if (file) {
+                struct header hdr = {...};
+                u8_t payload[128] = {...};
+
+                struct iovec iov[2] = {
+                        {.iov_base = &hdr,    .iov_len = sizeof(hdr)},
+                        {.iov_base = payload, .iov_len = sizeof(payload)}
+                };
+
+                if (writev(fileno(file), iov, 2) != sizeof(hdr) + sizeof(payload)) {
+                        perror("/foo/bar");
+                }
+
+                fclose(file);
+        }
+
+        // ...
+   @endcode
+ *
+ * @see readv()
+ */
+//==============================================================================
+static inline ssize_t writev(fd_t fd, const struct iovec *iov, int iovcnt)
+{
+        ssize_t r = -1;
+        syscall(SYSCALL_WRITEV, &r, (FILE*)fd, iov, &iovcnt);
+        return r;
+}
+
+//==============================================================================
+/**
+ * @brief Function reads data from file to several buffers.
+ *
+ * The function readv() reads data from the file associated with the file
+ * descriptor <i>fd</i> into <i>iovcnt</i> buffers described by <i>iov</i>.
+ * Buffers are filled in array order in single system request. Operation is
+ * handled natively by file system if supported, otherwise buffers are read
+ * one by one.
+ *
+ * @param fd            file descriptor
+ * @param iov           buffer vector
+ * @param iovcnt        number of buffers
+ *
+ * @exception | @ref EINVAL
+ * @exception | @ref ENOMEM
+ * @exception | @ref EPERM
+ * @exception | ...
+ *
+ * @return On success, the number of bytes read is returned (a short count
+ * means end of file). On error, \b -1 is returned, and \b errno is set
+ * appropriately.
+ *
+ * @b Example
+ * @code
+        #include <stdio.h>
+        #include <sys/uio.h>
+
+        // ...
+
+        FILE *file = fopen("/foo/bar", "r");
+        if (file) {
+                struct header hdr;
+                u8_t payload[128];
+
+                struct iovec iov[2] = {
+                        {.iov_base = &hdr,    .iov_len = sizeof(hdr)},
+                        {.iov_base = payload, .iov_len = sizeof(payload)}
+                };
+
+                ssize_t n = readv(fileno(file), iov, 2);
+                if (n < 0) {
+                        perror("/foo/bar");
+                }
+
+                fclose(file);
+        }
+
+        // ...
+   @endcode
+ *
+ * @see writev()
+ */
+//==============================================================================
+static inline ssize_t readv(fd_t fd, const struct iovec *iov, int iovcnt)
+{
+        ssize_t r = -1;
+        syscall(SYSCALL_READV, &r, (FILE*)fd, iov, &iovcnt);
+        return r;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _UIO_H_ */
+
+/**@}*/
+/*==============================================================================
+  End of file
+==============================================================================*/
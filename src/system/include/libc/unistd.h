@@ -437,6 +437,59 @@ static inline void sync(void)
         syscall(SYSCALL_SYNC, NULL);
 }
 
+//==============================================================================
+/**
+ * @brief Function copies data between files.
+ *
+ * The copy_file_range() function copies up to <i>len</i> bytes from file
+ * <i>fd_in</i> to file <i>fd_out</i>. Data is copied in kernel space so it
+ * is not transferred through user buffer. Copy starts at current positions
+ * of both files, file positions are moved by number of copied bytes. If
+ * source file can be mapped (e.g. romfs) then data is written directly from
+ * file system memory. If destination accepts less data than was read from
+ * source that can not seek (pipe, TTY) then number of copied bytes is
+ * returned and @ref errno is set to @ref EIO (the rest of data is lost).
+ *
+ * @param fd_in         source file descriptor
+ * @param fd_out        destination file descriptor
+ * @param len           number of bytes to copy
+ *
+ * @exception | @ref EINVAL
+ * @exception | @ref ENOMEM
+ * @exception | @ref ENOSPC
+ * @exception | @ref EPERM
+ * @exception | @ref EIO
+ * @exception | ...
+ *
+ * @return On success, the number of copied bytes is returned (0 if end of
+ * source file is reached). On error, \b -1 is returned, and \b errno is set
+ * appropriately.
+ *
+ * @b Example
+ * @code
+        #include <stdio.h>
+        #include <unistd.h>
+
+        // ...
+
+        FILE *src = fopen("/foo/bar", "r");
+        FILE *dst = fopen("/foo/baz", "w");
+
+        if (src && dst) {
+                while (copy_file_range(fileno(src), fileno(dst), 16384) > 0);
+        }
+
+        // ...
+   @endcode
+ */
+//==============================================================================
+static inline ssize_t copy_file_range(fd_t fd_in, fd_t fd_out, size_t len)
+{
+        ssize_t r = -1;
+        syscall(SYSCALL_FCOPY, &r, (struct vfs_file*)fd_in, (struct vfs_file*)fd_out, &len);
+        return r;
+}
+
 //==============================================================================
 /**
  * @brief Function return group ID of current user.
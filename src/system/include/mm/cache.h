@@ -86,6 +86,17 @@ enum cache_mode {
         CACHE_WRITE_BACK
 };
 
+/**
+ * Cache statistics.
+ */
+struct cache_stat {
+        u32_t blocks;                   //!< number of cached blocks
+        u32_t dirty;                    //!< number of dirty blocks
+        u32_t bytes;                    //!< size of cached data
+        u32_t hits;                     //!< number of blocks read from cache
+        u32_t misses;                   //!< number of blocks read from device
+};
+
 /*==============================================================================
   Exported objects
 ==============================================================================*/
@@ -96,6 +107,9 @@ enum cache_mode {
 extern int  sys_cache_drop(FILE*);
 extern int  sys_cache_write(FILE*, u32_t, size_t, size_t, const u8_t*, enum cache_mode);
 extern int  sys_cache_read(FILE*, u32_t, size_t, size_t, u8_t*);
+extern int  sys_cache_direct_write(FILE*, u32_t, size_t, size_t, const u8_t*);
+extern int  sys_cache_direct_read(FILE*, u32_t, size_t, size_t, u8_t*);
+extern int  sys_cache_get_stat(struct cache_stat*);
 extern int  _cache_init(void);
 extern void _cache_sync(void);
 extern void _cache_drop(void);
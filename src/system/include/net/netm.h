@@ -182,6 +182,8 @@ typedef struct {
   Exported functions
 ==============================================================================*/
 #ifndef DOXYGEN
+struct vfs_file;
+
 extern int   _net_ifup(NET_family_t, const NET_generic_config_t*);
 extern int   _net_ifdown(NET_family_t);
 extern int   _net_ifstatus(NET_family_t, NET_generic_status_t*);
@@ -195,6 +197,7 @@ extern int   _net_socket_recv(SOCKET*, void*, size_t, NET_flags_t, size_t*);
 extern int   _net_socket_recvfrom(SOCKET*, void*, size_t, NET_flags_t, NET_generic_sockaddr_t*, size_t*);
 extern int   _net_socket_send(SOCKET*, const void*, size_t, NET_flags_t, size_t*);
 extern int   _net_socket_sendto(SOCKET*, const void*, size_t, NET_flags_t, const NET_generic_sockaddr_t*, size_t*);
+extern int   _net_socket_sendfile(SOCKET*, struct vfs_file*, size_t, size_t*);
 extern int   _net_socket_set_recv_timeout(SOCKET*, uint32_t);
 extern int   _net_socket_set_send_timeout(SOCKET*, uint32_t);
 extern int   _net_socket_get_recv_timeout(SOCKET*, uint32_t*);
@@ -203,6 +206,7 @@ extern int   _net_socket_connect(SOCKET*, const NET_generic_sockaddr_t*);
 extern int   _net_socket_disconnect(SOCKET*);
 extern int   _net_socket_shutdown(SOCKET*, NET_shut_t);
 extern int   _net_socket_getaddress(SOCKET*, NET_generic_sockaddr_t*);
+extern int   _net_socket_poll(SOCKET*, int*);
 extern u16_t _net_hton_u16(NET_family_t, u16_t);
 extern u32_t _net_hton_u32(NET_family_t, u32_t);
 extern u64_t _net_hton_u64(NET_family_t, u64_t);
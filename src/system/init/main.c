@@ -34,6 +34,7 @@
 #include "mm/cache.h"
 #include "mm/mm.h"
 #include "mm/shm.h"
+#include "drivers/class/storage/blkq.h"
 #include "fs/vfs.h"
 #include "lib/unarg.h"
 #include "kernel/syscall.h"
@@ -114,6 +115,7 @@ int main(void)
 {
         _cpuctl_init();
         _assert(ESUCC == _mm_init());
+        _assert(ESUCC == _blkq_init());
 
 #if __OS_SYSTEM_FS_CACHE_ENABLE__ > 0
         _assert(ESUCC == _cache_init());
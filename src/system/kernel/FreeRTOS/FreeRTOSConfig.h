@@ -155,6 +155,13 @@ extern void  vApplicationSwitchedOut(void);
 
 #define traceTASK_SWITCHED_OUT()                _task_switched_out(pxCurrentTCB, pxCurrentTCB->pxTaskTag)
 #define traceTASK_SWITCHED_IN()                 _task_switched_in(pxCurrentTCB, pxCurrentTCB->pxTaskTag)
+#define traceTASK_INCREMENT_TICK(tick)          _task_tick_begin()
+
+#if __OS_TRACE_ENABLE__ > 0
+#include "kernel/ktrace.h"
+#define traceBLOCKING_ON_QUEUE_RECEIVE(q)       _ktrace(_KTRACE_BLOCK_RECEIVE, (uintptr_t)(q), 0)
+#define traceBLOCKING_ON_QUEUE_SEND(q)          _ktrace(_KTRACE_BLOCK_SEND, (uintptr_t)(q), 0)
+#endif
 
 #if __OS_ENABLE_SYS_ASSERT__ > 0
 extern void _assert_hook(bool assert, const char *msg);
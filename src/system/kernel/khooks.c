@@ -59,7 +59,6 @@ static u32_t sec_divider;
   Exported object definitions
 ==============================================================================*/
 u32_t        _uptime_counter_sec = 0;
-extern u32_t _CPU_total_time;
 
 /*==============================================================================
   Function definitions
@@ -106,14 +105,11 @@ void vApplicationStackOverflowHook(TaskHandle_t taskHdl, char *taskName)
 //==============================================================================
 void vApplicationTickHook(void)
 {
-#if (__OS_MONITOR_CPU_LOAD__ > 0)
-        _CPU_total_time += _cpuctl_get_CPU_load_counter_delta();
-#endif
+        _task_tick_end();
 
         if (++sec_divider >= configTICK_RATE_HZ) {
                 sec_divider = 0;
                 _uptime_counter_sec++;
-                _calculate_CPU_load();
         }
 }
 
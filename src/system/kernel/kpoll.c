@@ -0,0 +1,312 @@
+/*=========================================================================*//**
+@file    kpoll.c
+
+@author  Daniel Zorychta
+
+@brief   Readiness multiplexing of files and sockets
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include "config.h"
+#include "kernel/kpoll.h"
+#include "kernel/kwrapper.h"
+#include "kernel/errno.h"
+#include "fs/vfs.h"
+#include "net/netm.h"
+#include "lib/cast.h"
+
+/*==============================================================================
+  Local macros
+==============================================================================*/
+#define POLL_ALWAYS                     (POLLERR | POLLHUP | POLLNVAL)
+
+/*==============================================================================
+  Local object types
+==============================================================================*/
+typedef struct poll_waiter {
+        struct poll_waiter *next;       //!< next waiting thread
+        sem_t              *sem;        //!< semaphore signaled by notification
+        task_t             *task;       //!< waiting thread
+        const void        **obj;        //!< watched object of each descriptor (NULL: any)
+        size_t              nobj;       //!< number of descriptors
+        size_t              cur;        //!< descriptor checked at the moment
+} poll_waiter_t;
+
+/*==============================================================================
+  Local function prototypes
+==============================================================================*/
+static short poll_object(struct pollfd *pfd);
+static bool  is_waiting_for(poll_waiter_t *waiter, const void *obj);
+
+/*==============================================================================
+  Local objects
+==============================================================================*/
+static poll_waiter_t *waiters;
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  External objects
+==============================================================================*/
+
+/*==============================================================================
+  Function definitions
+==============================================================================*/
+
+//==============================================================================
+/**
+ * @brief  Function check readiness of selected object (file or socket).
+ *
+ * @param  pfd          poll descriptor
+ *
+ * @return Ready events (requested events and error conditions).
+ */
+//==============================================================================
+static short poll_object(struct pollfd *pfd)
+{
+        res_header_t *res     = cast(res_header_t*, pfd->fd);
+        int           revents = POLLNVAL;
+
+        if (res) {
+                switch (res->type) {
+                case RES_TYPE_FILE:
+                        if (_vfs_fpoll(cast(FILE*, res), &revents) != ESUCC) {
+                                revents = POLLNVAL;
+                        }
+                        break;
+
+#if __ENABLE_NETWORK__ == _YES_
+                case RES_TYPE_SOCKET:
+                        if (_net_socket_poll(cast(SOCKET*, res), &revents) != ESUCC) {
+                                revents = POLLNVAL;
+                        }
+                        break;
+#endif
+
+                default:
+                        break;
+                }
+        }
+
+        return revents & (pfd->events | POLL_ALWAYS);
+}
+
+//==============================================================================
+/**
+ * @brief  Function wait until at least one of selected files or sockets is
+ *         ready for requested operation. Objects notify change of readiness
+ *         by _kpoll_notify(), so waiting thread does not consume CPU time.
+ *         Object that reports readiness registers itself by _kpoll_watch(),
+ *         then thread is woken only by notification of its objects.
+ *         Descriptors equal to -1 are ignored (sockets are pointers, so any
+ *         other value is valid).
+ *
+ * @param  fds          poll descriptors
+ * @param  nfds         number of descriptors
+ * @param  timeout      timeout [ms] (0: check only, MAX_DELAY_MS: no timeout)
+ * @param  nready       number of ready descriptors (0 if timeout)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int _kpoll(struct pollfd *fds, size_t nfds, u32_t timeout, size_t *nready)
+{
+        if ((!fds && nfds) || !nready) {
+                return EINVAL;
+        }
+
+        poll_waiter_t waiter = {.next = NULL, .sem = NULL, .obj = NULL, .nobj = nfds};
+        u32_t         tref   = _kernel_get_time_ms();
+        int           err    = ESUCC;
+
+        for (;;) {
+                size_t n = 0;
+
+                for (size_t i = 0; i < nfds; i++) {
+                        fds[i].revents = 0;
+
+                        if (fds[i].fd != -1) {
+                                waiter.cur     = i;
+                                fds[i].revents = poll_object(&fds[i]);
+                                n += fds[i].revents ? 1 : 0;
+                        }
+                }
+
+                *nready = n;
+
+                if (n || (timeout == 0)) {
+                        break;
+                }
+
+                // waiter is registered before second check, so notification
+                // that comes between check and wait is not lost; objects are
+                // unknown until second check (woken by any notification)
+                if (waiter.sem == NULL) {
+                        err = _kzalloc(_MM_KRN, (nfds ? nfds : 1) * sizeof(void*),
+                                       cast(void**, &waiter.obj));
+                        if (err) {
+                                break;
+                        }
+
+                        err = _semaphore_create(1, 0, &waiter.sem);
+                        if (err) {
+                                break;
+                        }
+
+                        waiter.task = _task_get_handle();
+
+                        _kernel_scheduler_lock();
+                        {
+                                waiter.next = waiters;
+                                waiters     = &waiter;
+                        }
+                        _kernel_scheduler_unlock();
+
+                        continue;
+                }
+
+                u32_t elapsed = _kernel_get_time_ms() - tref;
+
+                if (timeout == MAX_DELAY_MS) {
+                        _semaphore_wait(waiter.sem, MAX_DELAY_MS);
+
+                } else if (elapsed < timeout) {
+                        _semaphore_wait(waiter.sem, timeout - elapsed);
+
+                } else {
+                        break;
+                }
+        }
+
+        if (waiter.sem) {
+                _kernel_scheduler_lock();
+                {
+                        poll_waiter_t **w = &waiters;
+                        while (*w && (*w != &waiter)) {
+                                w = &(*w)->next;
+                        }
+
+                        if (*w) {
+                                *w = waiter.next;
+                        }
+                }
+                _kernel_scheduler_unlock();
+
+                _semaphore_destroy(waiter.sem);
+        }
+
+        if (waiter.obj) {
+                _kfree(_MM_KRN, cast(void**, &waiter.obj));
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function register object of currently checked descriptor. Function
+ *         is called by object (pipe, socket, driver) when readiness is
+ *         requested; notification of this object wakes the polling thread.
+ *         Object is identified by any pointer that is used by _kpoll_notify().
+ *
+ * @param  obj          object
+ */
+//==============================================================================
+void _kpoll_watch(const void *obj)
+{
+        if (waiters && obj) {
+                task_t *task = _task_get_handle();
+
+                _kernel_scheduler_lock();
+                {
+                        for (poll_waiter_t *w = waiters; w; w = w->next) {
+                                if (w->task == task) {
+                                        if (w->cur < w->nobj) {
+                                                w->obj[w->cur] = obj;
+                                        }
+                                        break;
+                                }
+                        }
+                }
+                _kernel_scheduler_unlock();
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Function check if waiter shall be woken by notification of object.
+ *
+ * @param  waiter       waiter
+ * @param  obj          notified object (NULL: any)
+ *
+ * @return True if waiter watches object.
+ */
+//==============================================================================
+static bool is_waiting_for(poll_waiter_t *waiter, const void *obj)
+{
+        if (obj == NULL) {
+                return true;
+        }
+
+        for (size_t i = 0; i < waiter->nobj; i++) {
+                if ((waiter->obj[i] == NULL) || (waiter->obj[i] == obj)) {
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+//==============================================================================
+/**
+ * @brief  Function notify polling threads that readiness of object was
+ *         changed. Only threads that watch the object (or descriptor that
+ *         object is not known yet) are woken and check their objects again.
+ *         Function is called by pipes, sockets and drivers that support
+ *         IOCTL_VFS__POLL request. Function cannot be called from interrupt.
+ *
+ * @param  obj          changed object (NULL: all threads are woken)
+ */
+//==============================================================================
+void _kpoll_notify(const void *obj)
+{
+        if (waiters) {
+                _kernel_scheduler_lock();
+                {
+                        for (poll_waiter_t *w = waiters; w; w = w->next) {
+                                if (is_waiting_for(w, obj)) {
+                                        _semaphore_signal(w->sem);
+                                }
+                        }
+                }
+                _kernel_scheduler_unlock();
+        }
+}
+
+/*==============================================================================
+  End of file
+==============================================================================*/
@@ -0,0 +1,180 @@
+/*=========================================================================*//**
+@file    ktrace.c
+
+@author  Daniel Zorychta
+
+@brief   Kernel event tracer
+
+@note    Copyright (C) 2018 Daniel Zorychta <daniel.zorychta@gmail.com>
+
+         This program is free software; you can redistribute it and/or modify
+         it under the terms of the GNU General Public License as published by
+         the Free Software Foundation and modified by the dnx RTOS exception.
+
+         NOTE: The modification  to the GPL is  included to allow you to
+               distribute a combined work that includes dnx RTOS without
+               being obliged to provide the source  code for proprietary
+               components outside of the dnx RTOS.
+
+         The dnx RTOS  is  distributed  in the hope  that  it will be useful,
+         but WITHOUT  ANY  WARRANTY;  without  even  the implied  warranty of
+         MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+         GNU General Public License for more details.
+
+         Full license text is available on the following file: doc/license.txt.
+
+
+*//*==========================================================================*/
+
+/*==============================================================================
+  Include files
+==============================================================================*/
+#include "config.h"
+#include "kernel/ktrace.h"
+#include "kernel/kwrapper.h"
+#include "kernel/process.h"
+#include "kernel/errno.h"
+
+#if __OS_TRACE_ENABLE__ > 0
+
+/*==============================================================================
+  Local macros
+==============================================================================*/
+
+/*==============================================================================
+  Local object types
+==============================================================================*/
+typedef struct {
+        _ktrace_rec_t rec[__OS_TRACE_BUFFER_LENGTH__];
+        u32_t         seq;              //!< sequence number of next record
+        u32_t         first;            //!< sequence number of first valid record
+        bool          enabled;
+} ktrace_t;
+
+/*==============================================================================
+  Local function prototypes
+==============================================================================*/
+
+/*==============================================================================
+  Local objects
+==============================================================================*/
+static ktrace_t ktrace = {.enabled = true};
+
+/*==============================================================================
+  Exported objects
+==============================================================================*/
+
+/*==============================================================================
+  External objects
+==============================================================================*/
+
+/*==============================================================================
+  Function definitions
+==============================================================================*/
+
+//==============================================================================
+/**
+ * @brief  Function record kernel event in the trace buffer. When buffer is
+ *         full the oldest record is overwritten. Function can be called from
+ *         any context (task, IRQ, context switch).
+ *
+ * @param  event        event
+ * @param  arg0         event argument 0
+ * @param  arg1         event argument 1
+ */
+//==============================================================================
+void _ktrace(enum _ktrace_event event, uintptr_t arg0, uintptr_t arg1)
+{
+        if (!ktrace.enabled) {
+                return;
+        }
+
+        _process_t *proc   = _process_get_active();
+        pid_t       pid    = 0;
+        tid_t       thread = 0;
+
+        if (proc) {
+                _process_get_pid(proc, &pid);
+                thread = _process_get_active_thread();
+        }
+
+        UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+                _ktrace_rec_t *rec = &ktrace.rec[ktrace.seq % __OS_TRACE_BUFFER_LENGTH__];
+
+                rec->seq       = ktrace.seq++;
+                rec->timestamp = _kernel_get_time_us();
+                rec->pid       = pid;
+                rec->thread    = thread;
+                rec->event     = event;
+                rec->arg[0]    = arg0;
+                rec->arg[1]    = arg1;
+
+                if ((ktrace.seq - ktrace.first) > __OS_TRACE_BUFFER_LENGTH__) {
+                        ktrace.first = ktrace.seq - __OS_TRACE_BUFFER_LENGTH__;
+                }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+//==============================================================================
+/**
+ * @brief  Function enable or disable event recording.
+ *
+ * @param  enable       true to enable recording
+ *
+ * @return Previous state.
+ */
+//==============================================================================
+bool _ktrace_enable(bool enable)
+{
+        bool prev      = ktrace.enabled;
+        ktrace.enabled = enable;
+        return prev;
+}
+
+//==============================================================================
+/**
+ * @brief  Function drop all recorded events.
+ */
+//==============================================================================
+void _ktrace_clear(void)
+{
+        UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+        ktrace.first = ktrace.seq;
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+//==============================================================================
+/**
+ * @brief  Function return selected record. Records are indexed from the oldest
+ *         one. If tracing is enabled then buffer moves during reading, thus
+ *         sequence number of record should be used to detect lost events.
+ *
+ * @param  idx          record index
+ * @param  rec          record
+ *
+ * @return One of errno value. ENOENT if record does not exist.
+ */
+//==============================================================================
+int _ktrace_get(size_t idx, _ktrace_rec_t *rec)
+{
+        int err = ENOENT;
+
+        UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+                if (idx < (ktrace.seq - ktrace.first)) {
+                        u32_t seq = ktrace.first + idx;
+                        *rec = ktrace.rec[seq % __OS_TRACE_BUFFER_LENGTH__];
+                        err  = ESUCC;
+                }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+
+        return err;
+}
+
+#endif
+/*==============================================================================
+  End of file
+==============================================================================*/
@@ -131,6 +131,26 @@ u32_t _kernel_get_time_ms(void)
         return (xTaskGetTickCount() * (1000/(configTICK_RATE_HZ)));
 }
 
+//==============================================================================
+/**
+ * @brief Function return OS time in microseconds. Function can be called from
+ *        any context (task, IRQ, context switch).
+ *
+ * @return a OS time in microseconds (wraps after ~71 minutes)
+ */
+//==============================================================================
+u32_t _kernel_get_time_us(void)
+{
+        UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+
+        u32_t us = (xTaskGetTickCountFromISR() * (1000000/(configTICK_RATE_HZ)))
+                 + _cpuctl_get_tick_elapsed_us();
+
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+
+        return us;
+}
+
 //==============================================================================
 /**
  * @brief Function return tick counter
@@ -474,6 +494,39 @@ void *_task_get_tag(task_t *taskhdl)
         return (void*)xTaskGetApplicationTaskTag(taskhdl);
 }
 
+//==============================================================================
+/**
+ * @brief Function send notification to the task. Notifications are counted,
+ *        each one releases one _task_notify_wait() call.
+ *
+ * @param[in] *taskhdl          task handle
+ *
+ * @return None
+ */
+//==============================================================================
+void _task_notify(task_t *taskhdl)
+{
+        xTaskNotifyGive(taskhdl);
+}
+
+//==============================================================================
+/**
+ * @brief Function wait for notification of the current task.
+ *
+ * @param[in] blocktime_ms      timeout value
+ *
+ * @return One of errno values.
+ */
+//==============================================================================
+int _task_notify_wait(const u32_t blocktime_ms)
+{
+        if (ulTaskNotifyTake(pdFALSE, MS2TICK((TickType_t)blocktime_ms))) {
+                return ESUCC;
+        } else {
+                return ETIME;
+        }
+}
+
 //==============================================================================
 /**
  * @brief Function create binary semaphore
@@ -40,8 +40,9 @@
 #include "kernel/kpanic.h"
 #include "kernel/printk.h"
 #include "kernel/sysfunc.h"
+#include "kernel/syscall.h"
 #include "kernel/khooks.h"
-#include "lib/llist.h"
+#include "kernel/ktrace.h"
 #include "lib/cast.h"
 #include "dnx/misc.h"
 #include "mm/shm.h"
@@ -68,30 +69,75 @@
 #define FLAG_DETACHED                   (1 << 0)
 #define FLAG_KWORKER                    (1 << 1)
 
+#define PID_MAX                         1000
+#define PID_HASH_SIZE                   32
+#define PID_HASH(pid)                   ((pid) & (PID_HASH_SIZE - 1))
+
+#define RES_HASH_SIZE                   16
+#define RES_HASH(_res)                  (((cast(uintptr_t, _res) >> 3) ^ (cast(uintptr_t, _res) >> 7)) & (RES_HASH_SIZE - 1))
+
+/* fixed-point EWMA of CPU load sampled every second: exp(-1/(60*n)) << 16 */
+#define LOAD_FSHIFT                     16
+#define LOAD_FIXED_1                    (1 << LOAD_FSHIFT)
+#define LOAD_EXP_1MIN                   64453
+#define LOAD_EXP_5MIN                   65318
+#define LOAD_EXP_15MIN                  65463
+
 /*==============================================================================
   Local types, enums definitions
 ==============================================================================*/
 typedef struct _prog_data pdata_t;
 
+typedef struct {
+        size_t           memory_usage;  //!< size of allocated memory blocks
+        u16_t            memory_blocks; //!< number of allocated memory blocks
+        u16_t            files;         //!< number of opened files
+        u16_t            dirs;          //!< number of opened directories
+        u16_t            mutexes;       //!< number of mutexes
+        u16_t            semaphores;    //!< number of semaphores and flags
+        u16_t            queues;        //!< number of queues
+        u16_t            sockets;       //!< number of sockets
+} res_count_t;
+
+typedef struct {
+        u64_t            runtime;       //!< CPU time [cycles]
+        u64_t            runtime_ref;   //!< CPU time at last load calculation
+        u32_t            switches;      //!< number of context switches
+        u16_t            CPU_load;      //!< CPU load (10 = 1%)
+} thread_cpu_t;
+
 struct _process {
         res_header_t     header;        //!< resource header
+        _process_t      *prev;          //!< previous process on list
+        _process_t     **list;          //!< list that contains process
+        _process_t      *pid_next;      //!< next process in PID hash bucket
         task_t          **task;         //!< process tasks
-        flag_t          *event;         //!< events for exit indicator and syscall finish
+        flag_t          *event;         //!< events for exit indicator
         FILE            *f_stdin;       //!< stdin file
         FILE            *f_stdout;      //!< stdout file
         FILE            *f_stderr;      //!< stderr file
         void            *globals;       //!< address to global variables
-        res_header_t    *res_list;      //!< list of used resources
+        res_header_t    *res_hash[RES_HASH_SIZE]; //!< used resources hashed by address
+        res_count_t      res_count;     //!< number of used resources by type
         char            *cwd;           //!< current working path
         const pdata_t   *pdata;         //!< program data
         char            **argv;         //!< program arguments
         u8_t             argc;          //!< number of arguments
         pid_t            pid;           //!< process ID
         int              errnov;        //!< program error number
-        u32_t            timecnt;       //!< counter used to calculate CPU load
+#if __OS_MONITOR_CPU_LOAD__ > 0
+        thread_cpu_t    *thread_cpu;    //!< CPU usage of threads
+        u64_t            runtime;       //!< CPU time of all threads [cycles]
+        u64_t            runtime_ref;   //!< CPU time at last load calculation
+#endif
         u16_t            CPU_load;      //!< CPU load (10 = 1%)
         i8_t             status;        //!< program status (return value)
         u8_t             flag;          //!< control flags
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+        u32_t            syscalls;      //!< number of system calls
+        u32_t            syscall_errors;//!< number of system calls finished with error
+        u64_t            syscall_time;  //!< total time of system calls [us]
+#endif
 };
 
 typedef struct {
@@ -106,14 +152,21 @@ static void process_code(void *mainfn);
 static void thread_code(void *args);
 static void process_destroy_all_resources(_process_t *proc);
 static int  resource_destroy(res_header_t *resource);
+static void resource_count(_process_t *proc, res_header_t *resource, int n);
 static int  argtab_create(const char *str, u8_t *argc, char **argv[]);
 static void argtab_destroy(char **argv);
 static int  find_program(const char *name, const struct _prog_data **prog);
 static int  allocate_process_globals(_process_t *proc, const struct _prog_data *usrprog);
 static int  process_apply_attributes(_process_t *proc, const process_attr_t *attr);
 static void process_get_stat(_process_t *proc, process_stat_t *stat);
-static void process_move_list(_process_t *proc, _process_t **list_from, _process_t **list_to);
+static void thread_get_stat(_process_t *proc, tid_t tid, thread_stat_t *stat);
+static void process_list_add(_process_t *proc, _process_t **list);
+static void process_list_remove(_process_t *proc);
+static void process_move_list(_process_t *proc, _process_t **list_to);
 static int  get_pid(pid_t *pid);
+static void pid_register(_process_t *proc);
+static void pid_release(_process_t *proc);
+static _process_t *find_process(pid_t pid);
 
 #if __OS_SYSTEM_SHEBANG_ENABLE__ > 0
 static bool is_cmd_path(const char *cmd);
@@ -124,23 +177,31 @@ static int  analyze_shebang(_process_t *proc, const char *cmd, char **cmdarg);
   Local object definitions
 ==============================================================================*/
 static pid_t          PID_cnt;
+static u32_t          PID_bitmap[(PID_MAX + 31) / 32];
+static _process_t    *PID_hash[PID_HASH_SIZE];
+static size_t         process_count;
 static _process_t    *active_process_list;
 static _process_t    *destroy_process_list;
 static _process_t    *zombie_process_list;
 static _process_t    *active_process;
 static tid_t          active_thread;
-static u32_t          CPU_total_time_last;
-static avg_CPU_load_t avg_CPU_load_calc;
 static avg_CPU_load_t avg_CPU_load_result;
+#if __OS_MONITOR_CPU_LOAD__ > 0
+static u64_t          CPU_total_time;
+static u64_t          CPU_switch_ref;
+static u64_t          CPU_IRQ_time;
+static u64_t          CPU_IRQ_ref;
+static u64_t          CPU_tick_ref;
+static u64_t          CPU_total_time_ref;
+static u64_t          CPU_IRQ_time_ref;
+static u32_t          avg_CPU_load_calc[3];
+#endif
 static mutex_t       *process_mtx;
 static mutex_t       *kworker_mtx;
 
 /*==============================================================================
   Exported object definitions
 ==============================================================================*/
-/* CPU total time */
-u32_t _CPU_total_time = 0;
-
 /* standard input */
 FILE *stdin = NULL;
 
@@ -161,7 +222,8 @@ struct _GVAR_STRUCT_NAME *global = NULL;
 ==============================================================================*/
 extern const struct _prog_data _prog_table[];
 extern const int               _prog_table_size;
-extern u32_t                   _uptime_counter_sec;
+extern const u16_t             _prog_hash_table[];
+extern const int               _prog_hash_table_size;
 
 /*==============================================================================
   Function definitions
@@ -245,6 +307,12 @@ KERNELSPACE int _process_create(const char *cmd, const process_attr_t *attr, pid
                                cast(void*, &proc->task));
                 if (err) goto finish;
 
+#if __OS_MONITOR_CPU_LOAD__ > 0
+                err = _kzalloc(_MM_KRN, sizeof(thread_cpu_t) * PROC_MAX_THREADS(proc),
+                               cast(void*, &proc->thread_cpu));
+                if (err) goto finish;
+#endif
+
                 ATOMIC(process_mtx) {
                         err = _task_create(process_code,
                                            proc->pdata->name,
@@ -262,15 +330,8 @@ KERNELSPACE int _process_create(const char *cmd, const process_attr_t *attr, pid
                                         *pid = proc->pid;
                                 }
 
-                                if (active_process_list == NULL) {
-                                        active_process_list = proc;
-
-                                } else {
-                                        proc->header.next = cast(res_header_t*,
-                                                                 active_process_list);
-
-                                        active_process_list = proc;
-                                }
+                                process_list_add(proc, &active_process_list);
+                                pid_register(proc);
                         }
                 }
         }
@@ -282,6 +343,10 @@ KERNELSPACE int _process_create(const char *cmd, const process_attr_t *attr, pid
                 }
 
                 if (proc) {
+                        ATOMIC(process_mtx) {
+                                pid_release(proc);
+                        }
+
                         process_destroy_all_resources(proc);
                         _kfree(_MM_KRN, cast(void**, &proc));
                 }
@@ -299,17 +364,27 @@ KERNELSPACE int _process_create(const char *cmd, const process_attr_t *attr, pid
 KERNELSPACE void _process_clean_up_killed_processes(void)
 {
         ATOMIC(process_mtx) {
-                while (destroy_process_list) {
-                        _process_t *proc = destroy_process_list;
+                _process_t *next = destroy_process_list;
+
+                while (next) {
+                        _process_t *proc = next;
+                        next = cast(_process_t*, proc->header.next);
+
+                        /*
+                         * Process with running asynchronous request is
+                         * destroyed when request is finished.
+                         */
+                        if (_syscall_aio_cancel(proc) != ESUCC) {
+                                continue;
+                        }
 
                         process_destroy_all_resources(proc);
 
                         if (not (proc->flag & FLAG_DETACHED)) {
-                                process_move_list(proc,
-                                                  &destroy_process_list,
-                                                  &zombie_process_list);
+                                process_move_list(proc, &zombie_process_list);
                         } else {
-                                destroy_process_list = cast(_process_t *, proc->header.next);
+                                process_list_remove(proc);
+                                pid_release(proc);
                                 _flag_destroy(proc->event);
                                 proc->event = NULL;
                                 _kfree(_MM_KRN, cast(void*, &proc));
@@ -333,28 +408,26 @@ KERNELSPACE int _process_kill(pid_t pid)
         int err = ESRCH;
 
         ATOMIC(process_mtx) {
-                foreach_process(proc, active_process_list) {
-                        if (proc->pid == pid) {
-                                if (proc->event) {
-                                        _flag_set(proc->event, _PROCESS_EXIT_FLAG(0));
-                                }
+                _process_t *proc = find_process(pid);
 
-                                u8_t threads = PROC_MAX_THREADS(proc);
+                if (proc && (proc->list == &active_process_list)) {
+                        if (proc->event) {
+                                _flag_set(proc->event, _PROCESS_EXIT_FLAG(0));
+                        }
 
-                                for (int i = 0; i < threads; i++) {
-                                        if (proc->task[i]) {
-                                                _task_destroy(proc->task[i]);
-                                                proc->task[i] = NULL;
-                                        }
+                        u8_t threads = PROC_MAX_THREADS(proc);
+
+                        for (int i = 0; i < threads; i++) {
+                                if (proc->task[i]) {
+                                        task_t *task = proc->task[i];
+                                        proc->task[i] = NULL;
+                                        _task_destroy(task);
                                 }
+                        }
 
-                                process_move_list(proc,
-                                                  &active_process_list,
-                                                  &destroy_process_list);
+                        process_move_list(proc, &destroy_process_list);
 
-                                err = ESUCC;
-                                break;
-                        }
+                        err = ESUCC;
                 }
         }
 
@@ -374,28 +447,16 @@ KERNELSPACE void _process_remove_zombie(_process_t *proc, int *status)
         _assert(is_proc_valid(proc));
 
         ATOMIC(process_mtx) {
-                _process_t *prev = NULL;
-                foreach_process(p, zombie_process_list) {
-                        if (p == proc) {
-
-                                if (prev) {
-                                        prev->header.next = proc->header.next;
-                                } else {
-                                        zombie_process_list = cast(_process_t *,
-                                                                   proc->header.next);
-                                }
-
-                                if (status) {
-                                        *status = proc->status;
-                                }
-
-                                _flag_destroy(proc->event);
-                                _kfree(_MM_KRN, cast(void*, &proc));
+                if (proc->list == &zombie_process_list) {
+                        process_list_remove(proc);
+                        pid_release(proc);
 
-                                break;
-                        } else {
-                                prev = p;
+                        if (status) {
+                                *status = proc->status;
                         }
+
+                        _flag_destroy(proc->event);
+                        _kfree(_MM_KRN, cast(void*, &proc));
                 }
         }
 }
@@ -439,12 +500,13 @@ KERNELSPACE void _process_exit(_process_t *proc, int status)
 
                         for (int i = 1; i < threads; i++) {
                                 if (proc->task[i]) {
-                                        _task_destroy(proc->task[i]);
+                                        task_t *task = proc->task[i];
                                         proc->task[i] = NULL;
+                                        _task_destroy(task);
                                 }
                         }
 
-                        process_move_list(proc, &active_process_list, &destroy_process_list);
+                        process_move_list(proc, &destroy_process_list);
 
                         proc->task[0] = NULL;
                 }
@@ -602,33 +664,68 @@ KERNELSPACE int _process_get_stat_pid(pid_t pid, process_stat_t *stat)
                 err = ENOENT;
 
                 ATOMIC(process_mtx) {
-                        _process_t *proc = NULL;
-
-                        foreach_process(p, active_process_list) {
-                                if (p->pid == pid) {
-                                        proc = p;
-                                        goto finish;
-                                }
+                        _process_t *proc = find_process(pid);
+                        if (proc) {
+                                process_get_stat(proc, stat);
+                                err = ESUCC;
                         }
+                }
+        }
 
-                        foreach_process(p, destroy_process_list) {
-                                if (p->pid == pid) {
-                                        proc = p;
-                                        goto finish;
-                                }
-                        }
+        return err;
+}
 
-                        foreach_process(p, zombie_process_list) {
-                                if (p->pid == pid) {
-                                        proc = p;
-                                        goto finish;
-                                }
-                        }
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+//==============================================================================
+/**
+ * @brief  Function add finished system call to process statistics. Function
+ *         is called by kworker thread with locked scheduler.
+ *
+ * @param  proc     client process
+ * @param  time     system call time [us]
+ * @param  err      system call status
+ */
+//==============================================================================
+KERNELSPACE void _process_syscall_stat_update(_process_t *proc, u32_t time, int err)
+{
+        if (is_proc_valid(proc)) {
+                proc->syscalls++;
+                proc->syscall_errors += err ? 1 : 0;
+                proc->syscall_time   += time;
+        }
+}
+#endif
 
-                        finish:
-                        if (proc) {
-                                process_get_stat(proc, stat);
-                                err = ESUCC;
+//==============================================================================
+/**
+ * @brief  Function gets statistics of thread of selected process.
+ *
+ * @param  pid      PID
+ * @param  seek     thread index (existing threads only)
+ * @param  stat     statistics
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+KERNELSPACE int _process_thread_get_stat_seek(pid_t pid, size_t seek, thread_stat_t *stat)
+{
+        int err = EINVAL;
+
+        if (pid && stat) {
+                err = ENOENT;
+
+                ATOMIC(process_mtx) {
+                        _process_t *proc = find_process(pid);
+
+                        if (proc && (proc->list == &active_process_list)) {
+                                u8_t threads = PROC_MAX_THREADS(proc);
+                                for (tid_t tid = 0; tid < threads; tid++) {
+                                        if (proc->task[tid] && (seek-- == 0)) {
+                                                thread_get_stat(proc, tid, stat);
+                                                err = ESUCC;
+                                                break;
+                                        }
+                                }
                         }
                 }
         }
@@ -681,23 +778,7 @@ KERNELSPACE const char *_process_get_name(_process_t *proc)
 //==============================================================================
 KERNELSPACE size_t _process_get_count(void)
 {
-        size_t count = 0;
-
-        ATOMIC(process_mtx) {
-                foreach_process(proc, active_process_list) {
-                        count++;
-                }
-
-                foreach_process(p, destroy_process_list) {
-                        count++;
-                }
-
-                foreach_process(p, zombie_process_list) {
-                        count++;
-                }
-        }
-
-        return count;
+        return process_count;
 }
 
 //==============================================================================
@@ -758,6 +839,31 @@ KERNELSPACE int _process_get_event_flags(_process_t *proc, flag_t **flag)
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief  Function notify thread that waits for system call completion.
+ *         Notification is not sent if thread was killed in the meantime
+ *         (thread slot is cleared before task is destroyed).
+ *
+ * @param  proc         process container
+ * @param  tid          thread ID
+ * @param  task         task of thread
+ */
+//==============================================================================
+KERNELSPACE void _process_thread_notify(_process_t *proc, tid_t tid, task_t *task)
+{
+        _kernel_scheduler_lock();
+        {
+                if (  is_proc_valid(proc) && proc->task
+                   && (tid < PROC_MAX_THREADS(proc))
+                   && (proc->task[tid] == task) ) {
+
+                        _task_notify(task);
+                }
+        }
+        _kernel_scheduler_unlock();
+}
+
 //==============================================================================
 /**
  * @brief  Function return priority of selected process.
@@ -774,18 +880,11 @@ KERNELSPACE int _process_get_priority(pid_t pid, int *prio)
 
         if (pid && prio) {
                 ATOMIC(process_mtx) {
-                        if (active_process->pid == pid) {
-                                *prio = _task_get_priority(active_process->task[0]);
-                                err   = ESUCC;
+                        _process_t *proc = find_process(pid);
 
-                        } else {
-                                foreach_process(proc, active_process_list) {
-                                        if (proc->pid == pid) {
-                                                *prio  = _task_get_priority(proc->task[0]);
-                                                err = ESUCC;
-                                                break;
-                                        }
-                                }
+                        if (proc && (proc->list == &active_process_list)) {
+                                *prio = _task_get_priority(proc->task[0]);
+                                err   = ESUCC;
                         }
                 }
         }
@@ -809,40 +908,11 @@ KERNELSPACE int _process_get_container(pid_t pid, _process_t **process)
 
         if (pid && process) {
                 ATOMIC(process_mtx) {
-                        if (active_process->pid == pid) {
-                                *process = active_process;
+                        _process_t *proc = find_process(pid);
+                        if (proc) {
+                                *process = proc;
                                 err = ESUCC;
                         }
-
-                        if (err) {
-                                foreach_process(proc, active_process_list) {
-                                        if (proc->pid == pid) {
-                                                *process = proc;
-                                                err = ESUCC;
-                                                break;
-                                        }
-                                }
-                        }
-
-                        if (err) {
-                                foreach_process(proc, destroy_process_list) {
-                                        if (proc->pid == pid) {
-                                                *process = proc;
-                                                err = ESUCC;
-                                                break;
-                                        }
-                                }
-                        }
-
-                        if (err) {
-                                foreach_process(proc, zombie_process_list) {
-                                        if (proc->pid == pid) {
-                                                *process = proc;
-                                                err = ESUCC;
-                                                break;
-                                        }
-                                }
-                        }
                 }
         }
 
@@ -898,12 +968,10 @@ KERNELSPACE int _process_register_resource(_process_t *proc, res_header_t *resou
                 mutex_t *mtx = (proc == _kworker_proc) ? kworker_mtx : process_mtx;
 
                 ATOMIC(mtx) {
-                        if (proc->res_list == NULL) {
-                                proc->res_list = resource;
-                        } else {
-                                resource->next = proc->res_list;
-                                proc->res_list = resource;
-                        }
+                        res_header_t **bucket = &proc->res_hash[RES_HASH(resource)];
+                        resource->next = *bucket;
+                        *bucket = resource;
+                        resource_count(proc, resource, 1);
                 }
 
                 return ESUCC;
@@ -933,18 +1001,20 @@ KERNELSPACE int _process_release_resource(_process_t *proc, res_header_t *resour
                 mutex_t *mtx = (proc == _kworker_proc) ? kworker_mtx : process_mtx;
 
                 ATOMIC(mtx) {
-                        res_header_t *prev     = NULL;
-                        int           max_deep = 1024;
+                        res_header_t **bucket   = &proc->res_hash[RES_HASH(resource)];
+                        res_header_t  *prev     = NULL;
+                        int            max_deep = 1024;
 
-                        foreach_resource(curr, proc->res_list) {
+                        foreach_resource(curr, *bucket) {
                                 if (curr == resource) {
                                         if (curr->type == type) {
-                                                if (proc->res_list == curr) {
-                                                        proc->res_list = proc->res_list->next;
+                                                if (*bucket == curr) {
+                                                        *bucket = curr->next;
                                                 } else {
                                                         prev->next = curr->next;
                                                 }
 
+                                                resource_count(proc, curr, -1);
                                                 obj_to_destroy = curr;
                                         } else {
                                                 err = EFAULT;
@@ -1017,6 +1087,10 @@ KERNELSPACE int _process_thread_create(_process_t          *proc,
                                 args->func = func;
                                 args->arg  = arg;
 
+#if __OS_MONITOR_CPU_LOAD__ > 0
+                                memset(&proc->thread_cpu[id], 0, sizeof(thread_cpu_t));
+#endif
+
                                 err = _task_create(thread_code, "",
                                                    (attr ? attr->stack_depth : STACK_DEPTH_LOW),
                                                    args, proc, &proc->task[id]);
@@ -1024,8 +1098,7 @@ KERNELSPACE int _process_thread_create(_process_t          *proc,
 
                                         if (proc->event) {
                                                 _flag_clear(proc->event,
-                                                            _PROCESS_EXIT_FLAG(id) |
-                                                            _PROCESS_SYSCALL_FLAG(id));
+                                                            _PROCESS_EXIT_FLAG(id));
                                         }
 
                                         if (attr) {
@@ -1063,8 +1136,9 @@ KERNELSPACE int _process_thread_kill(_process_t *proc, tid_t tid)
 
         if (is_proc_valid(proc) && is_tid_in_range(proc, tid)) {
                 ATOMIC(process_mtx) {
-                        _task_destroy(proc->task[tid]);
+                        task_t *task = proc->task[tid];
                         proc->task[tid] = NULL;
+                        _task_destroy(task);
 
                         if (proc->event) {
                                 _flag_set(proc->event, _PROCESS_EXIT_FLAG(tid));
@@ -1140,47 +1214,85 @@ KERNELSPACE void _task_get_process_container(task_t *taskhdl, _process_t **proc,
 
 //==============================================================================
 /**
- * @brief Function calculate general CPU load.
- *        Calculate are average values for 1/60, 1, 5, and 15 minutes.
+ * @brief Function calculate CPU load of processes and threads, and average CPU
+ *        load. Averages of 1, 5, and 15 minutes are exponentially weighted
+ *        moving averages. Function is called by kworker thread every
+ *        _PROCESS_CPU_LOAD_PERIOD_MS milliseconds.
  */
 //==============================================================================
 KERNELSPACE void _calculate_CPU_load(void)
 {
-        // calculates 1 second CPU load of all processes
-        avg_CPU_load_calc.avg1sec = 0;
-
-        // atomic section is not needed because this function is called from IRQ
-        foreach_process(proc, active_process_list) {
-                proc->CPU_load = proc->timecnt / (_CPU_total_time / 1000);
-                proc->timecnt  = 0;
-                avg_CPU_load_calc.avg1sec += proc->CPU_load;
+#if __OS_MONITOR_CPU_LOAD__ > 0
+        static const u32_t exp[3] = {LOAD_EXP_1MIN, LOAD_EXP_5MIN, LOAD_EXP_15MIN};
+
+        _critical_section_begin();
+        u64_t total = CPU_total_time;
+        u64_t irq   = CPU_IRQ_time;
+        _critical_section_end();
+
+        u64_t elapsed = total - CPU_total_time_ref;
+        u64_t period  = elapsed / 1000;
+        u64_t irqtime = irq - CPU_IRQ_time_ref;
+
+        if (period == 0) {
+                return;
         }
 
-        _CPU_total_time     = 0;
-        CPU_total_time_last = 0;
+        CPU_total_time_ref = total;
+        CPU_IRQ_time_ref   = irq;
 
-        // calculates 1 min average CPU load
-        avg_CPU_load_calc.avg1min += avg_CPU_load_calc.avg1sec;
-        avg_CPU_load_calc.avg1min /= 2;
-        if (_uptime_counter_sec % 60 == 0) {
-                avg_CPU_load_result.avg1min = avg_CPU_load_calc.avg1min;
+        u32_t load = 0;
 
-                // calculates 5 min average CPU load
-                avg_CPU_load_calc.avg5min  += avg_CPU_load_calc.avg1min;
-                avg_CPU_load_calc.avg5min  /= 2;
+        ATOMIC(process_mtx) {
+                foreach_process(proc, active_process_list) {
+                        u8_t threads = PROC_MAX_THREADS(proc);
 
-                if (_uptime_counter_sec % 300 == 0) {
-                        avg_CPU_load_result.avg5min = avg_CPU_load_calc.avg5min;
+                        for (tid_t tid = 0; tid < threads; tid++) {
+                                thread_cpu_t *cpu = &proc->thread_cpu[tid];
 
-                        // calculates 15 min average CPU load
-                        avg_CPU_load_calc.avg15min += avg_CPU_load_calc.avg5min;
-                        avg_CPU_load_calc.avg15min /= 2;
+                                _critical_section_begin();
+                                u64_t runtime = cpu->runtime;
+                                _critical_section_end();
 
-                        if (_uptime_counter_sec % 900 == 0) {
-                                avg_CPU_load_result.avg15min = avg_CPU_load_calc.avg15min;
+                                cpu->CPU_load    = min(1000, (runtime - cpu->runtime_ref) / period);
+                                cpu->runtime_ref = runtime;
                         }
+
+                        _critical_section_begin();
+                        u64_t runtime = proc->runtime;
+                        _critical_section_end();
+
+                        proc->CPU_load    = min(1000, (runtime - proc->runtime_ref) / period);
+                        proc->runtime_ref = runtime;
+
+                        load += proc->CPU_load;
+                }
+        }
+
+        load = min(1000, load);
+
+        avg_CPU_load_result.avg1sec  = load;
+        avg_CPU_load_result.IRQ_load = min(1000, irqtime / period);
+
+        // the same load is applied for each second if calculation was delayed
+        u32_t freq = _cpuctl_get_CPU_load_counter_freq();
+        u32_t sec  = freq ? ((elapsed + (freq / 2)) / freq) : 1;
+        sec = max(1, min(sec, 900));
+
+        u16_t *avg[3] = {&avg_CPU_load_result.avg1min,
+                         &avg_CPU_load_result.avg5min,
+                         &avg_CPU_load_result.avg15min};
+
+        for (int i = 0; i < 3; i++) {
+                for (u32_t n = 0; n < sec; n++) {
+                        avg_CPU_load_calc[i] = ( (u64_t)avg_CPU_load_calc[i] * exp[i]
+                                               + (u64_t)(load << LOAD_FSHIFT) * (LOAD_FIXED_1 - exp[i])
+                                               ) >> LOAD_FSHIFT;
                 }
+
+                *avg[i] = (avg_CPU_load_calc[i] + (LOAD_FIXED_1 / 2)) >> LOAD_FSHIFT;
         }
+#endif
 }
 
 //==============================================================================
@@ -1257,35 +1369,72 @@ USERSPACE static void thread_code(void *arg)
 
 //==============================================================================
 /**
- * Function move process from selected list to another.
+ * Function add process at the beginning of selected list. Function must be
+ * called with locked process mutex.
  *
- * @param  proc         process to move
- * @param  list_from    source list
- * @param  list_to      destination list
+ * @param  proc         process to add
+ * @param  list         destination list
  */
 //==============================================================================
-static void process_move_list(_process_t *proc, _process_t **list_from, _process_t **list_to)
+static void process_list_add(_process_t *proc, _process_t **list)
 {
-        ATOMIC(process_mtx) {
-                _process_t *prev = NULL;
-                foreach_process(p, *list_from) {
-                        if (p == proc) {
+        proc->prev        = NULL;
+        proc->header.next = cast(res_header_t*, *list);
+        proc->list        = list;
 
-                                if (prev) {
-                                        prev->header.next = proc->header.next;
-                                } else {
-                                        *list_from = cast(_process_t*, proc->header.next);
-                                }
+        if (*list) {
+                (*list)->prev = proc;
+        }
 
-                                proc->header.next = cast(struct res_header*, *list_to);
+        *list = proc;
 
-                                *list_to = proc;
+        process_count++;
+}
 
-                                break;
-                        } else {
-                                prev = p;
-                        }
+//==============================================================================
+/**
+ * Function remove process from list that contains it. Function must be called
+ * with locked process mutex.
+ *
+ * @param  proc         process to remove
+ */
+//==============================================================================
+static void process_list_remove(_process_t *proc)
+{
+        if (proc->list) {
+                _process_t *next = cast(_process_t*, proc->header.next);
+
+                if (proc->prev) {
+                        proc->prev->header.next = proc->header.next;
+                } else {
+                        *proc->list = next;
+                }
+
+                if (next) {
+                        next->prev = proc->prev;
                 }
+
+                proc->header.next = NULL;
+                proc->prev        = NULL;
+                proc->list        = NULL;
+
+                process_count--;
+        }
+}
+
+//==============================================================================
+/**
+ * Function move process from its list to another.
+ *
+ * @param  proc         process to move
+ * @param  list_to      destination list
+ */
+//==============================================================================
+static void process_move_list(_process_t *proc, _process_t **list_to)
+{
+        ATOMIC(process_mtx) {
+                process_list_remove(proc);
+                process_list_add(proc, list_to);
         }
 }
 
@@ -1304,14 +1453,21 @@ static void process_destroy_all_resources(_process_t *proc)
         if (proc->task) {
                 for (tid_t tid = 0; tid < threads; tid++) {
                         if (proc->task[tid]) {
-                                _task_destroy(proc->task[tid]);
+                                task_t *task = proc->task[tid];
                                 proc->task[tid] = NULL;
+                                _task_destroy(task);
                         }
                 }
 
                 _kfree(_MM_KRN, cast(void*, &proc->task));
         }
 
+#if __OS_MONITOR_CPU_LOAD__ > 0
+        if (proc->thread_cpu) {
+                _kfree(_MM_KRN, cast(void*, &proc->thread_cpu));
+        }
+#endif
+
         if (proc->argv) {
                 argtab_destroy(proc->argv);
                 proc->argv = NULL;
@@ -1319,16 +1475,20 @@ static void process_destroy_all_resources(_process_t *proc)
         }
 
         // free all resources
-        while (proc->res_list) {
-                res_header_t *resource = proc->res_list;
-                proc->res_list = resource->next;
+        for (int i = 0; i < RES_HASH_SIZE; i++) {
+                while (proc->res_hash[i]) {
+                        res_header_t *resource = proc->res_hash[i];
+                        proc->res_hash[i] = resource->next;
 
-                int err = resource_destroy(resource);
-                if (err != ESUCC) {
-                        printk("PROCESS: PID %d: unknown object %p\n", proc->pid, resource);
+                        int err = resource_destroy(resource);
+                        if (err != ESUCC) {
+                                printk("PROCESS: PID %d: unknown object %p\n", proc->pid, resource);
+                        }
                 }
         }
 
+        memset(&proc->res_count, 0, sizeof(res_count_t));
+
         if (proc->cwd) {
                 _kfree(_MM_KRN, cast(void*, &proc->cwd));
         }
@@ -1338,13 +1498,43 @@ static void process_destroy_all_resources(_process_t *proc)
         _shm_detach_anywhere(proc->pid);
 #endif
 
-        proc->res_list = NULL;
         proc->f_stdin  = NULL;
         proc->f_stdout = NULL;
         proc->f_stderr = NULL;
         proc->globals  = NULL;
 }
 
+//==============================================================================
+/**
+ * @brief  Function gets thread statistics.
+ *
+ * @param  proc         process
+ * @param  tid          thread ID
+ * @param  stat         statistics container
+ */
+//==============================================================================
+static void thread_get_stat(_process_t *proc, tid_t tid, thread_stat_t *stat)
+{
+        memset(stat, 0, sizeof(thread_stat_t));
+
+        stat->tid        = tid;
+        stat->priority   = _task_get_priority(proc->task[tid]);
+        stat->stack_free = _task_get_free_stack(proc->task[tid]);
+
+#if __OS_MONITOR_CPU_LOAD__ > 0
+        thread_cpu_t *cpu = &proc->thread_cpu[tid];
+
+        _critical_section_begin();
+        u64_t runtime  = cpu->runtime;
+        stat->switches = cpu->switches;
+        stat->CPU_load = cpu->CPU_load;
+        _critical_section_end();
+
+        u32_t kHz     = max(1, _cpuctl_get_CPU_load_counter_freq() / 1000);
+        stat->runtime = (runtime * 1000) / kHz;
+#endif
+}
+
 //==============================================================================
 /**
  * @brief  Function gets process statistics.
@@ -1357,16 +1547,26 @@ static void process_get_stat(_process_t *proc, process_stat_t *stat)
 {
         memset(stat, 0, sizeof(process_stat_t));
 
-        stat->name            = proc->pdata->name;
-        stat->pid             = proc->pid;
-        stat->stack_size      = proc->task[0] ? *proc->pdata->stack_depth : 0;
-        stat->stack_max_usage = proc->task[0] ? (stat->stack_size - _task_get_free_stack(proc->task[0])) : 0;
-        stat->priority        = proc->task[0] ? _task_get_priority(proc->task[0]) : 0;
-        stat->CPU_load        = proc->CPU_load;
-        stat->memory_usage    = 0;
-        stat->threads_count   = 0;
-        stat->socket_count    = 0;
-        stat->threads_count   = 0;
+        stat->name               = proc->pdata->name;
+        stat->pid                = proc->pid;
+        stat->stack_size         = proc->task[0] ? *proc->pdata->stack_depth : 0;
+        stat->stack_max_usage    = proc->task[0] ? (stat->stack_size - _task_get_free_stack(proc->task[0])) : 0;
+        stat->priority           = proc->task[0] ? _task_get_priority(proc->task[0]) : 0;
+        stat->CPU_load           = proc->CPU_load;
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+        stat->syscalls           = proc->syscalls;
+        stat->syscall_errors     = proc->syscall_errors;
+        stat->syscall_time       = proc->syscall_time;
+#endif
+        stat->memory_usage       = _mm_align(proc->res_count.memory_usage);
+        stat->memory_block_count = proc->res_count.memory_blocks;
+        stat->files_count        = proc->res_count.files;
+        stat->dir_count          = proc->res_count.dirs;
+        stat->mutexes_count      = proc->res_count.mutexes;
+        stat->semaphores_count   = proc->res_count.semaphores;
+        stat->queue_count        = proc->res_count.queues;
+        stat->socket_count       = proc->res_count.sockets;
+        stat->threads_count      = 0;
 
         u8_t threads = PROC_MAX_THREADS(proc);
         for (tid_t tid = 0; tid < threads; tid++) {
@@ -1375,40 +1575,7 @@ static void process_get_stat(_process_t *proc, process_stat_t *stat)
                 }
         }
 
-        foreach_resource(res, proc->res_list) {
-                switch (res->type) {
-                case RES_TYPE_FILE:
-                        stat->files_count++;
-                        break;
-
-                case RES_TYPE_DIR:
-                        stat->dir_count++;
-                        break;
-
-                case RES_TYPE_MUTEX:
-                        stat->mutexes_count++;
-                        break;
-
-                case RES_TYPE_QUEUE:
-                        stat->queue_count++;
-                        break;
-
-                case RES_TYPE_FLAG:
-                case RES_TYPE_SEMAPHORE:
-                        stat->semaphores_count++;
-                        break;
-
-                case RES_TYPE_MEMORY:
-                        stat->memory_block_count++;
-                        stat->memory_usage += _mm_get_block_size(res);
-                        break;
-
-                default:
-                        break;
-                }
-        }
-
-        stat->memory_usage = _mm_align(stat->memory_usage);
+        stat->zombie = (stat->threads_count == 0);
 }
 
 //==============================================================================
@@ -1538,9 +1705,12 @@ static int process_apply_attributes(_process_t *proc, const process_attr_t *attr
 
 //==============================================================================
 /**
- * @brief Function create PID number.
+ * @brief Function create PID number. Free PID is searched in bitmap starting
+ *        from the last created PID, so PID numbers are not reused immediately.
+ *
+ * @param pid           created PID
  *
- * @return On success PID number is returned, otherwise 0.
+ * @return One of errno value.
  */
 //==============================================================================
 static int get_pid(pid_t *pid)
@@ -1548,44 +1718,99 @@ static int get_pid(pid_t *pid)
         int err = ESRCH;
 
         ATOMIC(process_mtx) {
-                int n = 1000;
-                while (pid && (n-- > 0)) {
-                        if (++PID_cnt >= 1000) {
-                                PID_cnt = 1;
+                u32_t next = PID_cnt + 1;
+
+                // first word is checked twice because of cursor position
+                for (size_t n = 0; pid && (n <= ARRAY_SIZE(PID_bitmap)); n++) {
+                        if (next >= PID_MAX) {
+                                next = 1;
                         }
 
-                        bool found = false;
+                        size_t w    = next / 32;
+                        u32_t  free = ~PID_bitmap[w] & (UINT32_MAX << (next % 32));
+
+                        if (free) {
+                                u32_t id = (w * 32) + __builtin_ctz(free);
 
-                        foreach_process(proc, active_process_list) {
-                                found = proc->pid == PID_cnt;
-                                if (found) break;
+                                if (id < PID_MAX) {
+                                        PID_bitmap[w] |= (1UL << (id % 32));
+                                        PID_cnt = id;
+                                        *pid    = id;
+                                        err     = ESUCC;
+                                        break;
+                                }
                         }
 
-                        if (found) continue;
+                        next = (w + 1) * 32;
+                }
+        }
 
-                        foreach_process(proc, active_process_list) {
-                                found = proc->pid == PID_cnt;
-                                if (found) break;
-                        }
+        return err;
+}
 
-                        if (found) continue;
+//==============================================================================
+/**
+ * @brief Function add process to PID table. Function must be called with
+ *        locked process mutex.
+ *
+ * @param proc          process
+ */
+//==============================================================================
+static void pid_register(_process_t *proc)
+{
+        _process_t **bucket = &PID_hash[PID_HASH(proc->pid)];
 
-                        foreach_process(proc, active_process_list) {
-                                found = proc->pid == PID_cnt;
-                                if (found) break;
-                        }
+        proc->pid_next = *bucket;
+        *bucket        = proc;
+}
 
-                        if (found) {
-                                continue;
-                        } else {
-                                *pid = PID_cnt;
-                                err  = ESUCC;
+//==============================================================================
+/**
+ * @brief Function remove process from PID table and release its PID. Function
+ *        must be called with locked process mutex.
+ *
+ * @param proc          process
+ */
+//==============================================================================
+static void pid_release(_process_t *proc)
+{
+        if ((proc->pid > 0) && (proc->pid < PID_MAX)) {
+                _process_t **p = &PID_hash[PID_HASH(proc->pid)];
+
+                while (*p) {
+                        if (*p == proc) {
+                                *p = proc->pid_next;
                                 break;
                         }
+
+                        p = &(*p)->pid_next;
                 }
+
+                PID_bitmap[proc->pid / 32] &= ~(1UL << (proc->pid % 32));
+
+                proc->pid_next = NULL;
         }
+}
 
-        return err;
+//==============================================================================
+/**
+ * @brief Function find process by PID (in all process lists). Function must
+ *        be called with locked process mutex.
+ *
+ * @param pid           PID
+ *
+ * @return Process container or NULL if not found.
+ */
+//==============================================================================
+static _process_t *find_process(pid_t pid)
+{
+        for (_process_t *proc = PID_hash[PID_HASH(pid)]; proc; proc = proc->pid_next) {
+                if (proc->pid == pid) {
+                        return proc;
+                }
+        }
+
+        return NULL;
 }
 
 //==============================================================================
@@ -1645,6 +1870,56 @@ static int resource_destroy(res_header_t *resource)
         return ESUCC;
 }
 
+//==============================================================================
+/**
+ * @brief  Function update counter of resource type. Function must be called in
+ *         critical section of process resources.
+ *
+ * @param  proc         process
+ * @param  resource     resource
+ * @param  n            counter change (1 when registered, -1 when released)
+ */
+//==============================================================================
+static void resource_count(_process_t *proc, res_header_t *resource, int n)
+{
+        res_count_t *cnt = &proc->res_count;
+
+        switch (resource->type) {
+        case RES_TYPE_FILE:
+                cnt->files += n;
+                break;
+
+        case RES_TYPE_DIR:
+                cnt->dirs += n;
+                break;
+
+        case RES_TYPE_MEMORY:
+                cnt->memory_blocks += n;
+                cnt->memory_usage  += n * cast(int, _mm_get_block_size(resource));
+                break;
+
+        case RES_TYPE_MUTEX:
+                cnt->mutexes += n;
+                break;
+
+        case RES_TYPE_QUEUE:
+                cnt->queues += n;
+                break;
+
+        case RES_TYPE_FLAG:
+        case RES_TYPE_SEMAPHORE:
+                cnt->semaphores += n;
+                break;
+
+        case RES_TYPE_SOCKET:
+                cnt->sockets += n;
+                break;
+
+        default:
+                break;
+        }
+}
+
 //==============================================================================
 /**
  * @brief  Function check if first command argument is a path.
@@ -1771,7 +2046,8 @@ static int analyze_shebang(_process_t *proc, const char *cmd, char **cmdarg)
 
 //==============================================================================
 /**
- * @brief Function create new table with argument pointers.
+ * @brief Function create new table with argument pointers. Table and argument
+ *        strings are allocated in single memory block.
  *
  * @param[in]  str              argument string
  * @param[out] argc             number of argument
@@ -1786,31 +2062,37 @@ static int argtab_create(const char *str, u8_t *argc, char **argv[])
 
         if (!isstrempty(str) && argc && argv) {
 
-                llist_t *largs;
-                err = _llist_create_krn(_MM_KRN, NULL, NULL, &largs);
+                int    no_of_args = 0;
+                size_t strs_size  = 0;
+                char **arg        = NULL;
+                char  *buf        = NULL;
+
+                // 1st pass calculates size of block, 2nd pass fills block
+                for (int pass = 0; pass < 2; pass++) {
+                        const char *s = str;
+                        int         n = 0;
 
-                if (!err) {
                         // parse arguments
-                        while (*str != '\0') {
+                        while (*s != '\0') {
                                 // skip spaces
-                                str += strspn(str, " ");
+                                s += strspn(s, " ");
 
                                 // select character to find as end of argument
                                 bool quo = false;
                                 char find = ' ';
-                                if (*str == '\'' || *str == '"') {
+                                if (*s == '\'' || *s == '"') {
                                         quo = true;
-                                        find = *str;
-                                        str++;
+                                        find = *s;
+                                        s++;
                                 }
 
                                 // find selected character
-                                const char *start = str;
-                                const char *end   = strchr(str, find);
+                                const char *start = s;
+                                const char *end   = strchr(s, find);
 
                                 // check if string end is reached
                                 if (!end) {
-                                        end = strchr(str, '\0');
+                                        end = strchr(s, '\0');
                                 } else {
                                         end++;
                                 }
@@ -1824,41 +2106,42 @@ static int argtab_create(const char *str, u8_t *argc, char **argv[])
                                         str_len--;
                                 }
 
-                                // add argument to list
-                                char *arg;
-                                err = _kmalloc(_MM_KRN, str_len + 1, cast(void**, &arg));
-                                if (!err) {
-                                        _strlcpy(arg, start, str_len + 1);
-
-                                        if (_llist_push_back(largs, arg) == NULL) {
-                                                _kfree(_MM_KRN, cast(void*, &arg));
-                                                goto finish;
-                                        }
+                                if (pass == 0) {
+                                        no_of_args++;
+                                        strs_size += str_len + 1;
                                 } else {
-                                        goto finish;
+                                        _strlcpy(buf, start, str_len + 1);
+                                        arg[n++] = buf;
+                                        buf     += str_len + 1;
                                 }
 
                                 // next token
-                                str = end;
+                                s = end;
                         }
 
-                        // create table with arguments
-                        int no_of_args = _llist_size(largs);
-                        *argc = no_of_args;
+                        if (pass == 0) {
+                                if (no_of_args == 0) {
+                                        err = EINVAL;
+                                        break;
+                                }
 
-                        char **arg = NULL;
-                        err = _kmalloc(_MM_KRN, (no_of_args + 1) * sizeof(char*), cast(void*, &arg));
-                        if (!err) {
-                                for (int i = 0; i < no_of_args; i++) {
-                                        arg[i] = _llist_take_front(largs);
+                                size_t tab_size = (no_of_args + 1) * sizeof(char*);
+
+                                err = _kmalloc(_MM_KRN, tab_size + strs_size, cast(void*, &arg));
+                                if (err) {
+                                        break;
                                 }
 
-                                arg[no_of_args] = NULL;
-                                *argv = arg;
+                                buf = cast(char*, arg) + tab_size;
+
+                        } else {
+                                arg[n] = NULL;
                         }
+                }
 
-                        finish:
-                        _llist_destroy(largs);
+                if (!err) {
+                        *argc = no_of_args;
+                        *argv = arg;
                 }
         }
 
@@ -1867,20 +2150,14 @@ static int argtab_create(const char *str, u8_t *argc, char **argv[])
 
 //==============================================================================
 /**
- * @brief  Function remove argument table.
+ * @brief Function remove argument table.
  *
- * @param  argv          pointer to argument table (must be ended with NULL)
+ * @param argv          pointer to argument table (must be ended with NULL)
  */
 //==============================================================================
 static void argtab_destroy(char **argv)
 {
         if (argv) {
-                int n = 0;
-                while (argv[n]) {
-                        _kfree(_MM_KRN, cast(void*, &argv[n]));
-                        n++;
-                }
-
                 _kfree(_MM_KRN, cast(void*, &argv));
         }
 }
@@ -1911,10 +2188,21 @@ static int find_program(const char *name, const struct _prog_data **prog)
                 err   = ESUCC;
 
         } else {
-                for (int i = 0; i < _prog_table_size; i++) {
-                        if (strncmp(_prog_table[i].name, name, 128) == 0) {
-                                *prog  = &_prog_table[i];
-                                err = ESUCC;
+                // 32-bit FNV-1a, the same hash is used by addapps.sh script
+                u32_t hash = 2166136261;
+                for (const char *c = name; *c; c++) {
+                        hash = (hash ^ cast(u8_t, *c)) * 16777619;
+                }
+
+                // hash table size is power of 2 and contains empty slots
+                int mask = _prog_hash_table_size - 1;
+
+                for (int i = hash & mask; _prog_hash_table[i]; i = (i + 1) & mask) {
+                        const struct _prog_data *p = &_prog_table[_prog_hash_table[i] - 1];
+
+                        if (strncmp(p->name, name, 128) == 0) {
+                                *prog = p;
+                                err   = ESUCC;
                                 break;
                         }
                 }
@@ -1962,8 +2250,9 @@ static int allocate_process_globals(_process_t *proc, const struct _prog_data *u
 KERNELSPACE void _task_switched_in(task_t *task, void *task_tag)
 {
 #if (__OS_MONITOR_CPU_LOAD__ > 0)
-        _CPU_total_time    += _cpuctl_get_CPU_load_counter_delta();
-        CPU_total_time_last = _CPU_total_time;
+        CPU_total_time += _cpuctl_get_CPU_load_counter_delta();
+        CPU_switch_ref  = CPU_total_time;
+        CPU_IRQ_ref     = CPU_IRQ_time;
 #endif
         active_process = task_tag;
         active_thread  = -1;
@@ -1981,6 +2270,12 @@ KERNELSPACE void _task_switched_in(task_t *task, void *task_tag)
                         }
                 }
 
+                #if (__OS_MONITOR_CPU_LOAD__ > 0)
+                if (active_thread < threads) {
+                        active_process->thread_cpu[active_thread].switches++;
+                }
+                #endif
+
                 stdin  = active_process->f_stdin;
                 stdout = active_process->f_stdout;
                 stderr = active_process->f_stderr;
@@ -1993,6 +2288,8 @@ KERNELSPACE void _task_switched_in(task_t *task, void *task_tag)
                 global = NULL;
                 _errno = 0;
         }
+
+        _ktrace(_KTRACE_SWITCH, cast(uintptr_t, task), 0);
 }
 
 //==============================================================================
@@ -2010,6 +2307,10 @@ KERNELSPACE void _task_switched_out(task_t *task, void *task_tag)
 {
         UNUSED_ARG2(task, task_tag);
 
+#if (__OS_MONITOR_CPU_LOAD__ > 0)
+        CPU_total_time += _cpuctl_get_CPU_load_counter_delta();
+#endif
+
         if (active_process) {
                 active_process->f_stdin  = stdin;
                 active_process->f_stdout = stdout;
@@ -2018,16 +2319,47 @@ KERNELSPACE void _task_switched_out(task_t *task, void *task_tag)
                 active_process->errnov   = _errno;
 
                 #if (__OS_MONITOR_CPU_LOAD__ > 0)
-                _CPU_total_time         += _cpuctl_get_CPU_load_counter_delta();
-                active_process->timecnt += (_CPU_total_time - CPU_total_time_last);
-                #endif
-        } else {
-                #if (__OS_MONITOR_CPU_LOAD__ > 0)
-                _CPU_total_time += _cpuctl_get_CPU_load_counter_delta();
+                // system tick interrupt time is not counted to thread
+                u64_t runtime = (CPU_total_time - CPU_switch_ref)
+                              - (CPU_IRQ_time - CPU_IRQ_ref);
+
+                active_process->runtime += runtime;
+
+                if (active_thread < PROC_MAX_THREADS(active_process)) {
+                        active_process->thread_cpu[active_thread].runtime += runtime;
+                }
                 #endif
         }
 }
 
+//==============================================================================
+/**
+ * @brief  Function is called at begin of system tick interrupt.
+ *         See FreeRTOSConfig.h file.
+ */
+//==============================================================================
+KERNELSPACE void _task_tick_begin(void)
+{
+#if (__OS_MONITOR_CPU_LOAD__ > 0)
+        CPU_total_time += _cpuctl_get_CPU_load_counter_delta();
+        CPU_tick_ref    = CPU_total_time;
+#endif
+}
+
+//==============================================================================
+/**
+ * @brief  Function is called at end of system tick interrupt (tick hook).
+ *         Time of interrupt is counted as IRQ time.
+ */
+//==============================================================================
+KERNELSPACE void _task_tick_end(void)
+{
+#if (__OS_MONITOR_CPU_LOAD__ > 0)
+        CPU_total_time += _cpuctl_get_CPU_load_counter_delta();
+        CPU_IRQ_time   += CPU_total_time - CPU_tick_ref;
+#endif
+}
+
 /*==============================================================================
   End of file
 ==============================================================================*/
@@ -41,6 +41,8 @@
 #include "kernel/errno.h"
 #include "kernel/time.h"
 #include "kernel/khooks.h"
+#include "kernel/ktrace.h"
+#include "kernel/kpoll.h"
 #include "lib/cast.h"
 #include "lib/unarg.h"
 #include "lib/strlcat.h"
@@ -54,6 +56,7 @@
   Local macros
 ==============================================================================*/
 #define SYSCALL_QUEUE_LENGTH            4
+#define BLOCKING_RQ_MAX_WAIT_MS         100
 
 #if __OS_SYSTEM_FS_CACHE_ENABLE__ > 0
 #define SYNC_PERIOD_MS                  (1000 * __OS_SYSTEM_CACHE_SYNC_PERIOD__)
@@ -61,6 +64,12 @@
 #define SYNC_PERIOD_MS                  MAX_DELAY_MS
 #endif
 
+#if __OS_MONITOR_CPU_LOAD__ > 0
+#define KWORKER_PERIOD_MS               min(SYNC_PERIOD_MS, _PROCESS_CPU_LOAD_PERIOD_MS)
+#else
+#define KWORKER_PERIOD_MS               SYNC_PERIOD_MS
+#endif
+
 #define GETARG(type, var)               type var = va_arg(rq->args, type)
 #define LOADARG(type)                   va_arg(rq->args, type)
 #define GETRETURN(type, var)            type var = rq->retptr
@@ -78,23 +87,75 @@
 /*==============================================================================
   Local object types
 ==============================================================================*/
-typedef struct {
+typedef struct syscallrq {
+        struct syscallrq *next;
         void       *retptr;
         _process_t *client_proc;
         tid_t       client_thread;
+        task_t     *client_task;
+        int         priority;
+        u32_t       tqueue;
+        volatile bool done;
         syscall_t   syscall_no;
         va_list     args;
         int         err;
+        struct aiocb *aiocb;
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+        u32_t       tref;
+#endif
 } syscallrq_t;
 
 typedef void (*syscallfunc_t)(syscallrq_t*);
 
+/* state of asynchronous request */
+enum aio_state {
+        AIO_WAITING,                    //!< waits for other request of the same file
+        AIO_QUEUED,                     //!< sent to I/O thread
+        AIO_RUNNING,                    //!< realized by I/O thread
+        AIO_CANCELED                    //!< canceled, released by I/O thread
+};
+
+typedef struct aiorq {
+        syscallrq_t     rq;             //!< syscall request (must be first)
+        struct aiorq   *next;           //!< next request in submission order
+        FILE           *file;           //!< file of request
+        pid_t           pid;            //!< client PID
+        u8_t            state;          //!< request state (enum aio_state)
+} aiorq_t;
+
+typedef struct aio_waiter {
+        struct aio_waiter *next;        //!< next waiting thread
+        _process_t        *proc;        //!< process of waiting thread
+        task_t            *task;        //!< task notified when request is finished
+        tid_t              tid;         //!< thread ID of waiting thread
+} aio_waiter_t;
+
+typedef struct {
+        const struct aiocb *const *list;//!< control blocks
+        int                        nent;//!< number of control blocks
+} aio_list_t;
+
 /*==============================================================================
   Local function prototypes
 ==============================================================================*/
 static void syscall_do(void *rq);
+static void syscall_aio_do(syscallrq_t *rq);
+static aiorq_t *aio_finish(aiorq_t *aiorq, int err, size_t cnt, u8_t next_state);
+static int  aio_send(aiorq_t *aiorq);
+static int  aio_cancel(_process_t *proc, FILE *file, aiorq_t **freelist);
+static void aio_release(aiorq_t *freelist);
+static void aio_notify(void);
+static int  aio_wait(bool (*cond)(void*), void *arg, u32_t timeout);
+static bool aio_is_file_idle(void *file);
+static bool aio_is_any_done(void *arg);
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+static void syscall_stat_update(syscallrq_t *rq, u32_t tstart);
+#endif
+static int  syscall_send_request(syscallrq_t *rq, const u32_t timeout);
 #if __OS_TASK_KWORKER_MODE__ == 1
-static void syscall_RTR(void *rq_queue);
+static void syscall_RTR(void *arg);
+static int  blocking_rq_send(syscallrq_t *rq, const u32_t timeout);
+static syscallrq_t *blocking_rq_receive(void);
 #endif
 
 
@@ -115,6 +176,7 @@ static void syscall_mkfifo(syscallrq_t *rq);
 static void syscall_opendir(syscallrq_t *rq);
 static void syscall_closedir(syscallrq_t *rq);
 static void syscall_readdir(syscallrq_t *rq);
+static void syscall_readdirbulk(syscallrq_t *rq);
 #if __OS_ENABLE_REMOVE__ == _YES_
 static void syscall_remove(syscallrq_t *rq);
 #endif
@@ -138,9 +200,13 @@ static void syscall_fopen(syscallrq_t *rq);
 static void syscall_fclose(syscallrq_t *rq);
 static void syscall_fwrite(syscallrq_t *rq);
 static void syscall_fread(syscallrq_t *rq);
+static void syscall_writev(syscallrq_t *rq);
+static void syscall_readv(syscallrq_t *rq);
+static void syscall_fcopy(syscallrq_t *rq);
 static void syscall_fseek(syscallrq_t *rq);
 static void syscall_ioctl(syscallrq_t *rq);
 static void syscall_fflush(syscallrq_t *rq);
+static void syscall_poll(syscallrq_t *rq);
 static void syscall_sync(syscallrq_t *rq);
 #if __OS_ENABLE_TIMEMAN__ == _YES_
 static void syscall_gettime(syscallrq_t *rq);
@@ -161,6 +227,7 @@ static void syscall_processcleanzombie(syscallrq_t *rq);
 static void syscall_processgetsyncflag(syscallrq_t *rq);
 static void syscall_processstatseek(syscallrq_t *rq);
 static void syscall_processstatpid(syscallrq_t *rq);
+static void syscall_threadstatseek(syscallrq_t *rq);
 static void syscall_processgetpid(syscallrq_t *rq);
 static void syscall_processgetprio(syscallrq_t *rq);
 #if __OS_ENABLE_GETCWD__ == _YES_
@@ -175,6 +242,7 @@ static void syscall_mutexcreate(syscallrq_t *rq);
 static void syscall_mutexdestroy(syscallrq_t *rq);
 static void syscall_queuecreate(syscallrq_t *rq);
 static void syscall_queuedestroy(syscallrq_t *rq);
+static void syscall_aiosubmit(syscallrq_t *rq);
 #if __ENABLE_NETWORK__ == _YES_
 static void syscall_netifup(syscallrq_t *rq);
 static void syscall_netifdown(syscallrq_t *rq);
@@ -186,6 +254,7 @@ static void syscall_netlisten(syscallrq_t *rq);
 static void syscall_netaccept(syscallrq_t *rq);
 static void syscall_netrecv(syscallrq_t *rq);
 static void syscall_netsend(syscallrq_t *rq);
+static void syscall_netsendfile(syscallrq_t *rq);
 static void syscall_netgethostbyname(syscallrq_t *rq);
 static void syscall_netsetrecvtimeout(syscallrq_t *rq);
 static void syscall_netsetsendtimeout(syscallrq_t *rq);
@@ -211,11 +280,29 @@ static void syscall_shmdestroy(syscallrq_t *rq);
 static queue_t *call_request;
 #elif __OS_TASK_KWORKER_MODE__ == 1
 static queue_t *call_nonblocking;
-static queue_t *call_blocking;
+
+/* blocking requests ordered by client priority (with aging) */
+static struct {
+        syscallrq_t *head;
+        sem_t       *free;
+        sem_t       *used;
+} call_blocking;
 #else
 #error __OS_TASK_KWORKER_MODE__: unknown mode
 #endif
 
+/* pending asynchronous requests and threads that wait for them */
+static struct {
+        aiorq_t      *head;
+        aio_waiter_t *waiters;
+} aio;
+
+static const thread_attr_t blocking_thread_attr = {
+        .stack_depth = STACK_DEPTH_CUSTOM(__OS_IO_STACK_DEPTH__),
+        .priority    = PRIORITY_NORMAL,
+        .detached    = true
+};
+
 /* syscall table */
 static const syscallfunc_t syscalltab[] = {
         [SYSCALL_MOUNT ] = syscall_mount,
@@ -241,6 +328,7 @@ static const syscallfunc_t syscalltab[] = {
         [SYSCALL_OPENDIR ] = syscall_opendir,
         [SYSCALL_CLOSEDIR] = syscall_closedir,
         [SYSCALL_READDIR ] = syscall_readdir,
+        [SYSCALL_READDIRBULK] = syscall_readdirbulk,
         #if __OS_ENABLE_REMOVE__ == _YES_
         [SYSCALL_REMOVE] = syscall_remove,
         #endif
@@ -266,9 +354,13 @@ static const syscallfunc_t syscalltab[] = {
         [SYSCALL_FCLOSE] = syscall_fclose,
         [SYSCALL_FWRITE] = syscall_fwrite,
         [SYSCALL_FREAD ] = syscall_fread,
+        [SYSCALL_WRITEV] = syscall_writev,
+        [SYSCALL_READV ] = syscall_readv,
+        [SYSCALL_FCOPY ] = syscall_fcopy,
         [SYSCALL_FSEEK ] = syscall_fseek,
         [SYSCALL_IOCTL ] = syscall_ioctl,
         [SYSCALL_FFLUSH] = syscall_fflush,
+        [SYSCALL_POLL  ] = syscall_poll,
         [SYSCALL_SYNC  ] = syscall_sync,
         #if __OS_ENABLE_TIMEMAN__ == _YES_
         [SYSCALL_GETTIME] = syscall_gettime,
@@ -292,6 +384,7 @@ static const syscallfunc_t syscalltab[] = {
         [SYSCALL_PROCESSGETSYNCFLAG] = syscall_processgetsyncflag,
         [SYSCALL_PROCESSSTATSEEK   ] = syscall_processstatseek,
         [SYSCALL_PROCESSSTATPID    ] = syscall_processstatpid,
+        [SYSCALL_THREADSTATSEEK    ] = syscall_threadstatseek,
         [SYSCALL_PROCESSGETPID     ] = syscall_processgetpid,
         [SYSCALL_PROCESSGETPRIO    ] = syscall_processgetprio,
         #if __OS_ENABLE_GETCWD__ == _YES_
@@ -306,6 +399,7 @@ static const syscallfunc_t syscalltab[] = {
         [SYSCALL_MUTEXDESTROY    ] = syscall_mutexdestroy,
         [SYSCALL_QUEUECREATE     ] = syscall_queuecreate,
         [SYSCALL_QUEUEDESTROY    ] = syscall_queuedestroy,
+        [SYSCALL_AIOSUBMIT       ] = syscall_aiosubmit,
         #if __ENABLE_NETWORK__ == _YES_
         [SYSCALL_NETIFUP          ] = syscall_netifup,
         [SYSCALL_NETIFDOWN        ] = syscall_netifdown,
@@ -317,6 +411,7 @@ static const syscallfunc_t syscalltab[] = {
         [SYSCALL_NETACCEPT        ] = syscall_netaccept,
         [SYSCALL_NETRECV          ] = syscall_netrecv,
         [SYSCALL_NETSEND          ] = syscall_netsend,
+        [SYSCALL_NETSENDFILE      ] = syscall_netsendfile,
         [SYSCALL_NETGETHOSTBYNAME ] = syscall_netgethostbyname,
         [SYSCALL_NETSETRECVTIMEOUT] = syscall_netsetrecvtimeout,
         [SYSCALL_NETSETSENDTIMEOUT] = syscall_netsetsendtimeout,
@@ -329,6 +424,130 @@ static const syscallfunc_t syscalltab[] = {
         #endif
 };
 
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+static const char *const syscall_name[] = {
+        [SYSCALL_MOUNT ] = "mount",
+        [SYSCALL_UMOUNT] = "umount",
+        #if __OS_ENABLE_SHARED_MEMORY__ == _YES_
+        [SYSCALL_SHMCREATE ] = "shmcreate",
+        [SYSCALL_SHMATTACH ] = "shmattach",
+        [SYSCALL_SHMDETACH ] = "shmdetach",
+        [SYSCALL_SHMDESTROY] = "shmdestroy",
+        #endif
+        #if __OS_ENABLE_STATFS__ == _YES_
+        [SYSCALL_GETMNTENTRY] = "getmntentry",
+        #endif
+        #if __OS_ENABLE_MKNOD__ == _YES_
+        [SYSCALL_MKNOD] = "mknod",
+        #endif
+        #if __OS_ENABLE_MKDIR__ == _YES_
+        [SYSCALL_MKDIR] = "mkdir",
+        #endif
+        #if __OS_ENABLE_MKFIFO__ == _YES_
+        [SYSCALL_MKFIFO] = "mkfifo",
+        #endif
+        [SYSCALL_OPENDIR ] = "opendir",
+        [SYSCALL_CLOSEDIR] = "closedir",
+        [SYSCALL_READDIR ] = "readdir",
+        [SYSCALL_READDIRBULK] = "readdirbulk",
+        #if __OS_ENABLE_REMOVE__ == _YES_
+        [SYSCALL_REMOVE] = "remove",
+        #endif
+        #if __OS_ENABLE_RENAME__ == _YES_
+        [SYSCALL_RENAME] = "rename",
+        #endif
+        #if __OS_ENABLE_CHMOD__ == _YES_
+        [SYSCALL_CHMOD] = "chmod",
+        #endif
+        #if __OS_ENABLE_CHOWN__ == _YES_
+        [SYSCALL_CHOWN] = "chown",
+        #endif
+        #if __OS_ENABLE_STATFS__ == _YES_
+        [SYSCALL_STATFS] = "statfs",
+        #endif
+        #if __OS_ENABLE_FSTAT__ == _YES_
+        [SYSCALL_STAT] = "stat",
+        #endif
+        #if __OS_ENABLE_FSTAT__ == _YES_
+        [SYSCALL_FSTAT] = "fstat",
+        #endif
+        [SYSCALL_FOPEN ] = "fopen",
+        [SYSCALL_FCLOSE] = "fclose",
+        [SYSCALL_FWRITE] = "fwrite",
+        [SYSCALL_FREAD ] = "fread",
+        [SYSCALL_WRITEV] = "writev",
+        [SYSCALL_READV ] = "readv",
+        [SYSCALL_FCOPY ] = "fcopy",
+        [SYSCALL_FSEEK ] = "fseek",
+        [SYSCALL_IOCTL ] = "ioctl",
+        [SYSCALL_FFLUSH] = "fflush",
+        [SYSCALL_POLL  ] = "poll",
+        [SYSCALL_SYNC  ] = "sync",
+        #if __OS_ENABLE_TIMEMAN__ == _YES_
+        [SYSCALL_GETTIME] = "gettime",
+        [SYSCALL_SETTIME] = "settime",
+        #endif
+        [SYSCALL_DRIVERINIT       ] = "driverinit",
+        [SYSCALL_DRIVERRELEASE    ] = "driverrelease",
+        [SYSCALL_MALLOC           ] = "malloc",
+        [SYSCALL_ZALLOC           ] = "zalloc",
+        [SYSCALL_FREE             ] = "free",
+        #if ((__OS_SYSTEM_MSG_ENABLE__ > 0) && (__OS_PRINTF_ENABLE__ > 0))
+        [SYSCALL_SYSLOGREAD       ] = "syslogread",
+        #endif
+        [SYSCALL_KERNELPANICDETECT] = "kernelpanicdetect",
+        #if __OS_ENABLE_SYSTEMFUNC__ == _YES_
+        [SYSCALL_SYSTEM           ] = "system",
+        #endif
+        [SYSCALL_PROCESSCREATE     ] = "processcreate",
+        [SYSCALL_PROCESSKILL       ] = "processkill",
+        [SYSCALL_PROCESSCLEANZOMBIE] = "processcleanzombie",
+        [SYSCALL_PROCESSGETSYNCFLAG] = "processgetsyncflag",
+        [SYSCALL_PROCESSSTATSEEK   ] = "processstatseek",
+        [SYSCALL_PROCESSSTATPID    ] = "processstatpid",
+        [SYSCALL_THREADSTATSEEK    ] = "threadstatseek",
+        [SYSCALL_PROCESSGETPID     ] = "processgetpid",
+        [SYSCALL_PROCESSGETPRIO    ] = "processgetprio",
+        #if __OS_ENABLE_GETCWD__ == _YES_
+        [SYSCALL_GETCWD] = "getcwd",
+        [SYSCALL_SETCWD] = "setcwd",
+        #endif
+        [SYSCALL_THREADCREATE    ] = "threadcreate",
+        [SYSCALL_THREADKILL      ] = "threadkill",
+        [SYSCALL_SEMAPHORECREATE ] = "semaphorecreate",
+        [SYSCALL_SEMAPHOREDESTROY] = "semaphoredestroy",
+        [SYSCALL_MUTEXCREATE     ] = "mutexcreate",
+        [SYSCALL_MUTEXDESTROY    ] = "mutexdestroy",
+        [SYSCALL_QUEUECREATE     ] = "queuecreate",
+        [SYSCALL_QUEUEDESTROY    ] = "queuedestroy",
+        [SYSCALL_AIOSUBMIT       ] = "aiosubmit",
+        #if __ENABLE_NETWORK__ == _YES_
+        [SYSCALL_NETIFUP          ] = "netifup",
+        [SYSCALL_NETIFDOWN        ] = "netifdown",
+        [SYSCALL_NETIFSTATUS      ] = "netifstatus",
+        [SYSCALL_NETSOCKETCREATE  ] = "netsocketcreate",
+        [SYSCALL_NETSOCKETDESTROY ] = "netsocketdestroy",
+        [SYSCALL_NETBIND          ] = "netbind",
+        [SYSCALL_NETLISTEN        ] = "netlisten",
+        [SYSCALL_NETACCEPT        ] = "netaccept",
+        [SYSCALL_NETRECV          ] = "netrecv",
+        [SYSCALL_NETSEND          ] = "netsend",
+        [SYSCALL_NETSENDFILE      ] = "netsendfile",
+        [SYSCALL_NETGETHOSTBYNAME ] = "netgethostbyname",
+        [SYSCALL_NETSETRECVTIMEOUT] = "netsetrecvtimeout",
+        [SYSCALL_NETSETSENDTIMEOUT] = "netsetsendtimeout",
+        [SYSCALL_NETCONNECT       ] = "netconnect",
+        [SYSCALL_NETDISCONNECT    ] = "netdisconnect",
+        [SYSCALL_NETSHUTDOWN      ] = "netshutdown",
+        [SYSCALL_NETSENDTO        ] = "netsendto",
+        [SYSCALL_NETRECVFROM      ] = "netrecvfrom",
+        [SYSCALL_NETGETADDRESS    ] = "netgetaddress",
+        #endif
+};
+
+static _syscall_stat_t syscall_stat_tab[_SYSCALL_COUNT];
+#endif
+
 /*==============================================================================
   Exported objects
 ==============================================================================*/
@@ -372,8 +591,11 @@ int _syscall_init()
         catcherr(err = _queue_create(SYSCALL_QUEUE_LENGTH, sizeof(syscallrq_t*),
                                      &call_nonblocking), exit);
 
-        catcherr(err = _queue_create(SYSCALL_QUEUE_LENGTH, sizeof(syscallrq_t*),
-                                     &call_blocking), exit);
+        catcherr(err = _semaphore_create(SYSCALL_QUEUE_LENGTH, SYSCALL_QUEUE_LENGTH,
+                                         &call_blocking.free), exit);
+
+        catcherr(err = _semaphore_create(SYSCALL_QUEUE_LENGTH, 0,
+                                         &call_blocking.used), exit);
 #endif
 
         catcherr(err = _process_create("kworker", &attr, NULL), exit);
@@ -402,53 +624,45 @@ void syscall(syscall_t syscall, void *retptr, ...)
                 _assert(proc);
                 _assert(is_tid_in_range(proc, tid));
 
-                flag_t *event_flags = NULL;
-                _errno = _process_get_event_flags(proc, &event_flags);
-                _assert(event_flags);
-
-                if (!_errno && event_flags) {
+                if (proc) {
 
                         syscallrq_t syscallrq = {
                                 .syscall_no     = syscall,
                                 .client_proc    = proc,
                                 .client_thread  = tid,
+                                .client_task    = _task_get_handle(),
+                                .priority       = _task_get_priority(_THIS_TASK),
                                 .retptr         = retptr,
                                 .err            = ESUCC
                         };
 
                         va_start(syscallrq.args, retptr);
                         {
-                                syscallrq_t *syscallrq_ptr = &syscallrq;
-                                queue_t     *call_rq       = NULL;
-
-#if __OS_TASK_KWORKER_MODE__ == 0
-                                call_rq = call_request;
-#elif __OS_TASK_KWORKER_MODE__ == 1
-                                if (syscall <= _SYSCALL_GROUP_0_OS_NON_BLOCKING) {
-                                        call_rq = call_nonblocking;
-
-                                } else if (syscall <= _SYSCALL_GROUP_1_BLOCKING) {
-                                        call_rq = call_blocking;
-
-                                } else {
+#if __OS_TASK_KWORKER_MODE__ == 1
+                                if (syscall > _SYSCALL_GROUP_1_BLOCKING) {
                                         _errno = ENOSYS;
                                         va_end(syscallrq.args);
                                         return;
                                 }
 #endif
 
+                                _ktrace(_KTRACE_SYSCALL_ENTER, syscall, 0);
+
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+                                syscallrq.tref = _kernel_get_time_us();
+#endif
+
                                 while (true) {
-                                        if (_queue_send(call_rq,
-                                                        &syscallrq_ptr,
-                                                        2000) == ESUCC) {
+                                        if (syscall_send_request(&syscallrq, 2000) == ESUCC) {
 
-                                                if (_flag_wait(event_flags,
-                                                               _PROCESS_SYSCALL_FLAG(tid),
-                                                               MAX_DELAY_MS) == ESUCC) {
+                                                // wait for completion notification
+                                                // sent directly to this task
+                                                while (!syscallrq.done) {
+                                                        _task_notify_wait(MAX_DELAY_MS);
+                                                }
 
-                                                        if (syscallrq.err) {
-                                                                _errno = syscallrq.err;
-                                                        }
+                                                if (syscallrq.err) {
+                                                        _errno = syscallrq.err;
                                                 }
 
                                                 break;
@@ -457,6 +671,8 @@ void syscall(syscall_t syscall, void *retptr, ...)
                                                 _assert_msg(false, "Probably started to less I/O threads");
                                         }
                                 }
+
+                                _ktrace(_KTRACE_SYSCALL_EXIT, syscall, syscallrq.err);
                         }
                         va_end(syscallrq.args);
                 }
@@ -479,12 +695,6 @@ int _syscall_kworker_process(int argc, char *argv[])
 {
         UNUSED_ARG2(argc, argv);
 
-        static const thread_attr_t blocking_thread_attr = {
-                .stack_depth = STACK_DEPTH_CUSTOM(__OS_IO_STACK_DEPTH__),
-                .priority    = PRIORITY_NORMAL,
-                .detached    = true
-        };
-
         _task_get_process_container(_THIS_TASK, &_kworker_proc, NULL);
         _assert(_kworker_proc);
 
@@ -498,7 +708,7 @@ int _syscall_kworker_process(int argc, char *argv[])
                 int err = _process_thread_create(_kworker_proc,
                                                  syscall_RTR,
                                                  &blocking_thread_attr,
-                                                 call_blocking,
+                                                 NULL,
                                                  NULL);
 
                 if (err) {
@@ -517,11 +727,15 @@ int _syscall_kworker_process(int argc, char *argv[])
         u32_t sync_period_ref = _kernel_get_time_ms();
 #endif
 
+#if __OS_MONITOR_CPU_LOAD__ > 0
+        u32_t load_period_ref = _kernel_get_time_ms();
+#endif
+
         syscallrq_t *sysrq = NULL;
 
         for (;;) {
 #if __OS_TASK_KWORKER_MODE__ == 0
-                if (_queue_receive(call_request, &sysrq, SYNC_PERIOD_MS) == ESUCC) {
+                if (_queue_receive(call_request, &sysrq, KWORKER_PERIOD_MS) == ESUCC) {
 
                         _process_clean_up_killed_processes();
 
@@ -556,7 +770,7 @@ int _syscall_kworker_process(int argc, char *argv[])
                         }
                 }
 #elif __OS_TASK_KWORKER_MODE__ == 1
-                if (_queue_receive(call_nonblocking, &sysrq, SYNC_PERIOD_MS) == ESUCC) {
+                if (_queue_receive(call_nonblocking, &sysrq, KWORKER_PERIOD_MS) == ESUCC) {
                         _process_clean_up_killed_processes();
                         _kernel_release_resources();
                         syscall_do(sysrq);
@@ -569,11 +783,41 @@ int _syscall_kworker_process(int argc, char *argv[])
                         sync_period_ref = _kernel_get_time_ms();
                 }
 #endif
+
+#if __OS_MONITOR_CPU_LOAD__ > 0
+                if ( (_kernel_get_time_ms() - load_period_ref) >= _PROCESS_CPU_LOAD_PERIOD_MS) {
+                        load_period_ref = _kernel_get_time_ms();
+                        _calculate_CPU_load();
+                }
+#endif
         }
 
         return -1;
 }
 
+//==============================================================================
+/**
+ * @brief  Function send request to the kworker.
+ *
+ * @param  rq           request information
+ * @param  timeout      timeout of waiting for free slot
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int syscall_send_request(syscallrq_t *rq, const u32_t timeout)
+{
+#if __OS_TASK_KWORKER_MODE__ == 0
+        return _queue_send(call_request, &rq, timeout);
+#elif __OS_TASK_KWORKER_MODE__ == 1
+        if (rq->syscall_no <= _SYSCALL_GROUP_0_OS_NON_BLOCKING) {
+                return _queue_send(call_nonblocking, &rq, timeout);
+        } else {
+                return blocking_rq_send(rq, timeout);
+        }
+#endif
+}
+
 //==============================================================================
 /**
  * @brief  Function is called in thread and realize requested syscall.
@@ -583,36 +827,590 @@ int _syscall_kworker_process(int argc, char *argv[])
 //==============================================================================
 static void syscall_do(void *rq)
 {
-        syscallrq_t *sysrq = rq;
+        syscallrq_t *sysrq      = rq;
+        syscall_t    syscall_no = sysrq->syscall_no;
 
-        tid_t tid = _process_get_active_thread();
-        _assert(is_tid_in_range(_process_get_active(), tid));
+        if (sysrq->aiocb) {
+                // asynchronous request: client is not waiting for this request,
+                // request object is released when operation is finished
+                syscall_aio_do(sysrq);
 
-        flag_t *flags = NULL;
-        if (_process_get_event_flags(sysrq->client_proc, &flags) != ESUCC) {
-                _kernel_panic_report(_KERNEL_PANIC_DESC_CAUSE_INTERNAL);
-        }
-        _assert(flags);
+        } else {
+                tid_t tid = _process_get_active_thread();
+                _assert(is_tid_in_range(_process_get_active(), tid));
 
-        _process_get_pid(sysrq->client_proc, &_syscall_client_PID[tid]);
-        _assert(_syscall_client_PID[tid] > 0);
-        syscalltab[sysrq->syscall_no](sysrq);
-        _syscall_client_PID[tid] = 0;
+                _process_get_pid(sysrq->client_proc, &_syscall_client_PID[tid]);
+                _assert(_syscall_client_PID[tid] > 0);
+
+                _ktrace(_KTRACE_SYSCALL_BEGIN, syscall_no, _syscall_client_PID[tid]);
+
+                // request is realized with client priority; the main kworker thread
+                // serves also other clients, so its priority is only increased
+                int priority = _task_get_priority(_THIS_TASK);
+                int inherit  = (tid == 0) ? max(sysrq->priority, priority) : sysrq->priority;
+
+                if (inherit != priority) {
+                        _task_set_priority(_THIS_TASK, inherit);
+                }
 
-        if (_flag_set(flags, _PROCESS_SYSCALL_FLAG(sysrq->client_thread)) != ESUCC) {
-                _assert(false);
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+                u32_t tstart = _kernel_get_time_us();
+#endif
+
+                syscalltab[sysrq->syscall_no](sysrq);
+                _syscall_client_PID[tid] = 0;
+                _ktrace(_KTRACE_SYSCALL_END, syscall_no, sysrq->err);
+
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+                syscall_stat_update(sysrq, tstart);
+#endif
+
+                // request object is on client stack and can be released just
+                // after done flag is set, so notified client is copied before
+                _process_t *client_proc   = sysrq->client_proc;
+                tid_t       client_thread = sysrq->client_thread;
+                task_t     *client_task   = sysrq->client_task;
+
+                sysrq->done = true;
+                _process_thread_notify(client_proc, client_thread, client_task);
+
+                if (inherit != priority) {
+                        _task_set_priority(_THIS_TASK, priority);
+                }
         }
 
         // If there is lack of memory and FS sync is required then thread
         // synchronize all file systems to reduce cache size.
         if (  _cache_is_sync_needed()
-           && sysrq->syscall_no <= _SYSCALL_GROUP_1_BLOCKING) {
+           && syscall_no <= _SYSCALL_GROUP_1_BLOCKING) {
 
                 _vfs_sync();
                 _cache_sync();
         }
 }
 
+//==============================================================================
+/**
+ * @brief  Function realize asynchronous I/O request in I/O thread. Result is
+ *         stored in the control block, semaphore is signaled (if set) and
+ *         request object is released. Requests of the same file that were
+ *         queued in the meantime are realized by this thread one by one.
+ *
+ * @param  rq           request information
+ */
+//==============================================================================
+static void syscall_aio_do(syscallrq_t *rq)
+{
+        aiorq_t *aiorq = cast(aiorq_t*, rq);
+
+        // request canceled by fclose() or process exit is only released
+        _kernel_scheduler_lock();
+        {
+                if (aiorq->state == AIO_CANCELED) {
+                        aiorq = NULL;
+                } else {
+                        aiorq->state = AIO_RUNNING;
+                }
+        }
+        _kernel_scheduler_unlock();
+
+        if (!aiorq) {
+                _kfree(_MM_KRN, cast(void**, &rq));
+                return;
+        }
+
+        tid_t tid      = _process_get_active_thread();
+        int   priority = _task_get_priority(_THIS_TASK);
+
+        while (aiorq) {
+                struct aiocb *aiocb = aiorq->rq.aiocb;
+
+                _syscall_client_PID[tid] = aiorq->pid;
+                _ktrace(_KTRACE_SYSCALL_BEGIN, aiorq->rq.syscall_no, aiorq->pid);
+                _task_set_priority(_THIS_TASK, aiorq->rq.priority);
+
+                size_t cnt = 0;
+                int    err;
+
+                if (aiocb->aio_lio_opcode == LIO_WRITE) {
+                        err = _vfs_fpwrite(aiocb->aio_buf, aiocb->aio_nbytes,
+                                           aiocb->aio_offset, &cnt, aiorq->file);
+                } else {
+                        err = _vfs_fpread(aiocb->aio_buf, aiocb->aio_nbytes,
+                                          aiocb->aio_offset, &cnt, aiorq->file);
+                }
+
+                _syscall_client_PID[tid] = 0;
+                _ktrace(_KTRACE_SYSCALL_END, aiorq->rq.syscall_no, err);
+
+                aiorq = aio_finish(aiorq, err, cnt, AIO_RUNNING);
+        }
+
+        _task_set_priority(_THIS_TASK, priority);
+
+        // killed process is destroyed when its requests are finished
+        _process_clean_up_killed_processes();
+}
+
+//==============================================================================
+/**
+ * @brief  Function store result of asynchronous request in the control block,
+ *         signal the request semaphore and release the request. The next
+ *         request of the same file (if any) is switched to the selected state
+ *         and returned.
+ *
+ *         Control block is updated while request is on the list, so file and
+ *         process of request cannot be released in the meantime.
+ *
+ * @param  aiorq        finished request
+ * @param  err          request status
+ * @param  cnt          number of transferred bytes
+ * @param  next_state   state of the next request
+ *
+ * @return Next request of the same file or NULL.
+ */
+//==============================================================================
+static aiorq_t *aio_finish(aiorq_t *aiorq, int err, size_t cnt, u8_t next_state)
+{
+        struct aiocb *aiocb = aiorq->rq.aiocb;
+        aiorq_t      *next  = NULL;
+
+        aiocb->_aio_ret = err ? -1 : cast(ssize_t, cnt);
+        aiocb->_aio_err = err;
+
+        if (aiocb->aio_sem) {
+                _semaphore_signal(aiocb->aio_sem);
+        }
+
+        _kernel_scheduler_lock();
+        {
+                aiorq_t **rq = &aio.head;
+
+                while (*rq) {
+                        if (*rq == aiorq) {
+                                *rq = aiorq->next;
+
+                        } else {
+                                if (!next && ((*rq)->file == aiorq->file)) {
+                                        next = *rq;
+                                        next->state = next_state;
+                                }
+
+                                rq = &(*rq)->next;
+                        }
+                }
+
+                aio_notify();
+        }
+        _kernel_scheduler_unlock();
+
+        _kfree(_MM_KRN, cast(void**, &aiorq));
+
+        return next;
+}
+
+//==============================================================================
+/**
+ * @brief  Function send asynchronous request to the I/O thread. If request
+ *         cannot be queued then it is finished with EAGAIN error, and next
+ *         request of the same file is sent instead.
+ *
+ * @param  aiorq        request to send
+ *
+ * @return One of errno value (error of the first request).
+ */
+//==============================================================================
+static int aio_send(aiorq_t *aiorq)
+{
+        int result = ESUCC;
+
+        while (aiorq) {
+#if __OS_TASK_KWORKER_MODE__ == 0
+                int err = _process_thread_create(_kworker_proc, syscall_do,
+                                                 &blocking_thread_attr,
+                                                 aiorq, NULL);
+#elif __OS_TASK_KWORKER_MODE__ == 1
+                int err = blocking_rq_send(&aiorq->rq, 0);
+#endif
+                if (!err) {
+                        break;
+                }
+
+                result = result ? result : EAGAIN;
+                aiorq  = aio_finish(aiorq, EAGAIN, 0, AIO_QUEUED);
+        }
+
+        return result;
+}
+
+//==============================================================================
+/**
+ * @brief  Function cancel pending asynchronous requests of selected process
+ *         or file. Canceled requests are finished with ECANCELED error.
+ *         Running requests cannot be canceled. Function must be called with
+ *         locked scheduler.
+ *
+ * @param  proc         process (NULL: any)
+ * @param  file         file (NULL: any)
+ * @param  freelist     list of removed requests that shall be released
+ *
+ * @return ESUCC if there is no running request, otherwise EBUSY.
+ */
+//==============================================================================
+static int aio_cancel(_process_t *proc, FILE *file, aiorq_t **freelist)
+{
+        int      err = ESUCC;
+        aiorq_t **rq = &aio.head;
+
+        while (*rq) {
+                aiorq_t *aiorq = *rq;
+
+                if (  (proc && (aiorq->rq.client_proc != proc))
+                   || (file && (aiorq->file != file)) ) {
+
+                        rq = &aiorq->next;
+
+                } else if (aiorq->state == AIO_RUNNING) {
+                        err = EBUSY;
+                        rq  = &aiorq->next;
+
+                } else {
+                        *rq = aiorq->next;
+
+                        aiorq->rq.aiocb->_aio_ret = -1;
+                        aiorq->rq.aiocb->_aio_err = ECANCELED;
+
+                        if (aiorq->rq.aiocb->aio_sem) {
+                                _semaphore_signal(aiorq->rq.aiocb->aio_sem);
+                        }
+
+                        if (aiorq->state == AIO_QUEUED) {
+                                // released by I/O thread
+                                aiorq->state = AIO_CANCELED;
+                        } else {
+                                aiorq->next = *freelist;
+                                *freelist   = aiorq;
+                        }
+                }
+        }
+
+        aio_notify();
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function release list of requests.
+ *
+ * @param  freelist     list of requests
+ */
+//==============================================================================
+static void aio_release(aiorq_t *freelist)
+{
+        while (freelist) {
+                aiorq_t *aiorq = freelist;
+                freelist = aiorq->next;
+                _kfree(_MM_KRN, cast(void**, &aiorq));
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Function wake up all threads that wait for asynchronous requests.
+ *         Thread is notified only if it still exists. Function must be
+ *         called with locked scheduler.
+ */
+//==============================================================================
+static void aio_notify(void)
+{
+        for (aio_waiter_t *w = aio.waiters; w; w = w->next) {
+                _process_thread_notify(w->proc, w->tid, w->task);
+        }
+}
+
+//==============================================================================
+/**
+ * @brief  Function wait until condition is true. Condition is checked again
+ *         each time when asynchronous request is finished or canceled.
+ *         Function is called in client thread, that is woken up by task
+ *         notification. Waiter object is allocated in kernel memory, so
+ *         killed thread leaves no dangling object; waiters of process are
+ *         released by _syscall_aio_cancel().
+ *
+ * @param  cond         condition
+ * @param  arg          condition argument
+ * @param  timeout      timeout [ms]
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int aio_wait(bool (*cond)(void*), void *arg, u32_t timeout)
+{
+        aio_waiter_t *waiter = NULL;
+        u32_t         tref   = _kernel_get_time_ms();
+        int           err    = ESUCC;
+
+        while (!cond(arg)) {
+
+                // waiter is registered before second check, so notification
+                // that comes between check and wait is not lost
+                if (waiter == NULL) {
+                        err = _kzalloc(_MM_KRN, sizeof(aio_waiter_t), cast(void**, &waiter));
+                        if (err) {
+                                break;
+                        }
+
+                        waiter->task = _task_get_handle();
+                        _task_get_process_container(waiter->task, &waiter->proc, &waiter->tid);
+
+                        _kernel_scheduler_lock();
+                        {
+                                waiter->next = aio.waiters;
+                                aio.waiters  = waiter;
+                        }
+                        _kernel_scheduler_unlock();
+
+                        continue;
+                }
+
+                // notification left by other event only repeats the check
+                u32_t elapsed = _kernel_get_time_ms() - tref;
+
+                if (timeout == MAX_DELAY_MS) {
+                        _task_notify_wait(MAX_DELAY_MS);
+
+                } else if (elapsed < timeout) {
+                        _task_notify_wait(timeout - elapsed);
+
+                } else {
+                        err = ETIME;
+                        break;
+                }
+        }
+
+        if (waiter) {
+                _kernel_scheduler_lock();
+                {
+                        aio_waiter_t **w = &aio.waiters;
+                        while (*w && (*w != waiter)) {
+                                w = &(*w)->next;
+                        }
+
+                        if (*w) {
+                                *w = waiter->next;
+                        } else {
+                                waiter = NULL;
+                        }
+                }
+                _kernel_scheduler_unlock();
+
+                if (waiter) {
+                        _kfree(_MM_KRN, cast(void**, &waiter));
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Condition of aio_wait(): no request of file is pending. Waiting
+ *         requests are canceled.
+ *
+ * @param  file         file
+ *
+ * @return True if file can be closed.
+ */
+//==============================================================================
+static bool aio_is_file_idle(void *file)
+{
+        aiorq_t *freelist = NULL;
+
+        _kernel_scheduler_lock();
+        int err = aio_cancel(NULL, file, &freelist);
+        _kernel_scheduler_unlock();
+
+        aio_release(freelist);
+
+        return (err == ESUCC);
+}
+
+//==============================================================================
+/**
+ * @brief  Condition of aio_wait(): at least one request of list is finished.
+ *
+ * @param  arg          suspend list (aio_list_t)
+ *
+ * @return True if request is finished.
+ */
+//==============================================================================
+static bool aio_is_any_done(void *arg)
+{
+        aio_list_t *list = arg;
+
+        for (int i = 0; list->list && (i < list->nent); i++) {
+                if (list->list[i] && (list->list[i]->_aio_err != EINPROGRESS)) {
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+//==============================================================================
+/**
+ * @brief  Function cancel pending asynchronous requests of process. Function
+ *         is called before process resources are released.
+ *
+ * @param  proc         process
+ *
+ * @return ESUCC if process can be released, EBUSY if some request is running.
+ */
+//==============================================================================
+int _syscall_aio_cancel(_process_t *proc)
+{
+        aiorq_t      *freelist = NULL;
+        aio_waiter_t *waiters  = NULL;
+
+        _kernel_scheduler_lock();
+        int err = aio_cancel(proc, NULL, &freelist);
+
+        // waiters of killed threads
+        aio_waiter_t **w = &aio.waiters;
+        while (*w) {
+                if ((*w)->proc == proc) {
+                        aio_waiter_t *waiter = *w;
+                        *w = waiter->next;
+                        waiter->next = waiters;
+                        waiters = waiter;
+                } else {
+                        w = &(*w)->next;
+                }
+        }
+        _kernel_scheduler_unlock();
+
+        aio_release(freelist);
+
+        while (waiters) {
+                aio_waiter_t *waiter = waiters;
+                waiters = waiter->next;
+                _kfree(_MM_KRN, cast(void**, &waiter));
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function wait for completion of asynchronous requests. Function
+ *         is called in client thread by aio_suspend(), so I/O threads are
+ *         not occupied by waiting [USERSPACE].
+ *
+ * @param  list         list of control blocks
+ * @param  nent         number of list entries
+ * @param  timeout      timeout [ms]
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int _syscall_aio_suspend(const struct aiocb *const list[], int nent, u32_t timeout)
+{
+        aio_list_t suspend = {.list = list, .nent = nent};
+
+        return aio_wait(aio_is_any_done, &suspend, timeout);
+}
+
+//==============================================================================
+/**
+ * @brief  Function cancel pending asynchronous requests of file and wait for
+ *         running request. Function is called in client thread by fclose()
+ *         before file is closed [USERSPACE].
+ *
+ * @param  file         file
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int _syscall_aio_fclose(FILE *file)
+{
+        // fast path: most of files are never used by asynchronous requests
+        if (aio.head == NULL) {
+                return ESUCC;
+        }
+
+        return aio_wait(aio_is_file_idle, file, MAX_DELAY_MS);
+}
+
+#if __OS_SYSCALL_STAT_ENABLE__ > 0
+//==============================================================================
+/**
+ * @brief  Function update statistics of finished system call. Call time is
+ *         counted from sending request to the queue. Function must be called
+ *         before client is signaled (request object is placed on client stack).
+ *
+ * @param  rq           request information
+ * @param  tstart       time of request handling start [us]
+ */
+//==============================================================================
+static void syscall_stat_update(syscallrq_t *rq, u32_t tstart)
+{
+        u32_t wait    = tstart - rq->tref;
+        u32_t service = _kernel_get_time_us() - tstart;
+        u32_t total   = wait + service;
+
+        // bin 0: < 16us, bin n: < 2^(n+4)us, last bin: longer calls
+        int bin = 0;
+        for (u32_t t = total >> 4; t && (bin < _SYSCALL_STAT_HIST_BINS - 1); t >>= 1) {
+                bin++;
+        }
+
+        _kernel_scheduler_lock();
+        {
+                _syscall_stat_t *stat = &syscall_stat_tab[rq->syscall_no];
+
+                stat->calls++;
+                stat->errors       += rq->err ? 1 : 0;
+                stat->wait_time    += wait;
+                stat->service_time += service;
+                stat->max_time      = max(stat->max_time, total);
+                stat->hist[bin]++;
+
+                _process_syscall_stat_update(rq->client_proc, total, rq->err);
+        }
+        _kernel_scheduler_unlock();
+}
+
+//==============================================================================
+/**
+ * @brief  Function return statistics of selected system call.
+ *
+ * @param  no           system call number
+ * @param  name         system call name (can be NULL)
+ * @param  stat         statistics
+ *
+ * @return One of errno value. ENOENT if system call does not exist.
+ */
+//==============================================================================
+int _syscall_get_stat(size_t no, const char **name, _syscall_stat_t *stat)
+{
+        if (no >= _SYSCALL_COUNT) {
+                return ENOENT;
+        }
+
+        if (name) {
+                *name = (no < ARRAY_SIZE(syscall_name)) && syscall_name[no]
+                      ? syscall_name[no] : "";
+        }
+
+        _kernel_scheduler_lock();
+        *stat = syscall_stat_tab[no];
+        _kernel_scheduler_unlock();
+
+        return ESUCC;
+}
+#endif
+
 #if __OS_TASK_KWORKER_MODE__ == 1
 //==============================================================================
 /**
@@ -621,17 +1419,100 @@ static void syscall_do(void *rq)
  * @param  rq           request information
  */
 //==============================================================================
-static void syscall_RTR(void *rq_queue)
+static void syscall_RTR(void *arg)
 {
-        for (;;) {
-                syscallrq_t *sysrq;
+        UNUSED_ARG1(arg);
 
-                if (_queue_receive(rq_queue, &sysrq, MAX_DELAY_MS) == ESUCC) {
+        for (;;) {
+                syscallrq_t *sysrq = blocking_rq_receive();
+                if (sysrq) {
                         _process_clean_up_killed_processes();
                         syscall_do(sysrq);
                 }
         }
 }
+
+//==============================================================================
+/**
+ * @brief  Function insert request to the blocking requests list. Requests are
+ *         ordered by client priority (FIFO for the same priority). Time of
+ *         insertion is recorded for aging.
+ *
+ * @param  rq           request information
+ * @param  timeout      timeout of waiting for free slot
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int blocking_rq_send(syscallrq_t *rq, const u32_t timeout)
+{
+        int err = _semaphore_wait(call_blocking.free, timeout);
+        if (!err) {
+                _kernel_scheduler_lock();
+                {
+                        syscallrq_t **pos = &call_blocking.head;
+
+                        while (*pos && ((*pos)->priority >= rq->priority)) {
+                                pos = &(*pos)->next;
+                        }
+
+                        rq->next   = *pos;
+                        rq->tqueue = _kernel_get_time_ms();
+                        *pos       = rq;
+                }
+                _kernel_scheduler_unlock();
+
+                _semaphore_signal(call_blocking.used);
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function take request of the highest priority client from the
+ *         blocking requests list. Request that waits longer than
+ *         BLOCKING_RQ_MAX_WAIT_MS is taken first (the longest waiting one),
+ *         so constant load of high priority clients cannot starve low
+ *         priority ones.
+ *
+ * @return Request or NULL if there is no request.
+ */
+//==============================================================================
+static syscallrq_t *blocking_rq_receive(void)
+{
+        syscallrq_t *rq = NULL;
+
+        if (_semaphore_wait(call_blocking.used, MAX_DELAY_MS) == ESUCC) {
+                _kernel_scheduler_lock();
+                {
+                        syscallrq_t **pos     = &call_blocking.head;
+                        u32_t         maxwait = BLOCKING_RQ_MAX_WAIT_MS;
+                        u32_t         now     = _kernel_get_time_ms();
+
+                        for (syscallrq_t **p = pos; *p; p = &(*p)->next) {
+                                u32_t wait = now - (*p)->tqueue;
+
+                                if (wait > maxwait) {
+                                        maxwait = wait;
+                                        pos     = p;
+                                }
+                        }
+
+                        rq = *pos;
+
+                        if (rq) {
+                                *pos     = rq->next;
+                                rq->next = NULL;
+                        }
+                }
+                _kernel_scheduler_unlock();
+
+                _semaphore_signal(call_blocking.free);
+        }
+
+        return rq;
+}
 #endif
 
 //==============================================================================
@@ -832,6 +1713,25 @@ static void syscall_readdir(syscallrq_t *rq)
         SETRETURN(dirent_t*, dirent);
 }
 
+//==============================================================================
+/**
+ * @brief  This syscall read many entries of selected directory.
+ *
+ * @param  rq                   syscall request
+ */
+//==============================================================================
+static void syscall_readdirbulk(syscallrq_t *rq)
+{
+        GETARG(DIR *, dir);
+        GETARG(void *, buf);
+        GETARG(size_t *, size);
+        GETARG(int *, flags);
+
+        size_t len = 0;
+        SETERRNO(_vfs_readdir_bulk(dir, buf, *size, *flags, &len));
+        SETRETURN(ssize_t, GETERRNO() == ESUCC ? cast(ssize_t, len) : -1);
+}
+
 #if __OS_ENABLE_REMOVE__ == _YES_
 //==============================================================================
 /**
@@ -1009,7 +1909,15 @@ static void syscall_fclose(syscallrq_t *rq)
 {
         GETARG(FILE *, file);
 
-        int err = _process_release_resource(GETPROCESS(), cast(res_header_t*, file), RES_TYPE_FILE);
+        // pending asynchronous requests are canceled; client waits for running
+        // request before syscall (_syscall_aio_fclose()), so I/O thread is not
+        // blocked. Request that is running in the meantime was submitted
+        // concurrently by other thread and the file is not closed.
+        int err = aio_is_file_idle(file) ? ESUCC : EBUSY;
+
+        if (err == ESUCC) {
+                err = _process_release_resource(GETPROCESS(), cast(res_header_t*, file), RES_TYPE_FILE);
+        }
         if (err == EFAULT) {
                 const char *msg = "*** Error: object is not a file! ***\n";
                 size_t wrcnt;
@@ -1063,6 +1971,62 @@ static void syscall_fread(syscallrq_t *rq)
         SETRETURN(size_t, rdcnt / (*size));
 }
 
+//==============================================================================
+/**
+ * @brief  This syscall write data from buffer vector to selected file.
+ *
+ * @param  rq                   syscall request
+ */
+//==============================================================================
+static void syscall_writev(syscallrq_t *rq)
+{
+        GETARG(FILE *, file);
+        GETARG(const struct iovec *, iov);
+        GETARG(int *, iovcnt);
+
+        size_t wrcnt = 0;
+        SETERRNO(_vfs_fwritev(iov, *iovcnt, &wrcnt, file));
+        SETRETURN(ssize_t, GETERRNO() == ESUCC ? cast(ssize_t, wrcnt) : -1);
+}
+
+//==============================================================================
+/**
+ * @brief  This syscall read data from selected file to buffer vector.
+ *
+ * @param  rq                   syscall request
+ */
+//==============================================================================
+static void syscall_readv(syscallrq_t *rq)
+{
+        GETARG(FILE *, file);
+        GETARG(const struct iovec *, iov);
+        GETARG(int *, iovcnt);
+
+        size_t rdcnt = 0;
+        SETERRNO(_vfs_freadv(iov, *iovcnt, &rdcnt, file));
+        SETRETURN(ssize_t, GETERRNO() == ESUCC ? cast(ssize_t, rdcnt) : -1);
+}
+
+//==============================================================================
+/**
+ * @brief  This syscall copy data between files in kernel space.
+ *
+ * @param  rq                   syscall request
+ */
+//==============================================================================
+static void syscall_fcopy(syscallrq_t *rq)
+{
+        GETARG(FILE *, src);
+        GETARG(FILE *, dst);
+        GETARG(size_t *, len);
+
+        size_t cpcnt = 0;
+        SETERRNO(_vfs_fcopy(src, dst, *len, &cpcnt));
+
+        // copied data are reported also when rest of data is lost
+        SETRETURN(ssize_t, (GETERRNO() == ESUCC || cpcnt) ? cast(ssize_t, cpcnt) : -1);
+}
+
 //==============================================================================
 /**
  * @brief  This syscall move file pointer.
@@ -1109,6 +2073,24 @@ static void syscall_fflush(syscallrq_t *rq)
         SETRETURN(int, GETERRNO() == ESUCC ? 0 : -1);
 }
 
+//==============================================================================
+/**
+ * @brief  This syscall wait for readiness of selected files and sockets.
+ *
+ * @param  rq                   syscall request
+ */
+//==============================================================================
+static void syscall_poll(syscallrq_t *rq)
+{
+        GETARG(struct pollfd *, fds);
+        GETARG(size_t *, nfds);
+        GETARG(u32_t *, timeout);
+
+        size_t nready = 0;
+        SETERRNO(_kpoll(fds, *nfds, *timeout, &nready));
+        SETRETURN(int, GETERRNO() == ESUCC ? cast(int, nready) : -1);
+}
+
 //==============================================================================
 /**
  * @brief  This syscall synchronize all buffers of filesystems.
@@ -1395,6 +2377,22 @@ static void syscall_processstatpid(syscallrq_t *rq)
         SETRETURN(int, GETERRNO() == ESUCC ? 0 : -1);
 }
 
+//==============================================================================
+/**
+ * @brief  This syscall read thread statistics of selected process by seek.
+ *
+ * @param  rq                   syscall request
+ */
+//==============================================================================
+static void syscall_threadstatseek(syscallrq_t *rq)
+{
+        GETARG(pid_t *, pid);
+        GETARG(size_t *, seek);
+        GETARG(thread_stat_t*, stat);
+        SETERRNO(_process_thread_get_stat_seek(*pid, *seek, stat));
+        SETRETURN(int, GETERRNO() == ESUCC ? 0 : -1);
+}
+
 //==============================================================================
 /**
  * @brief  This syscall return PID of caller process.
@@ -1645,6 +2643,74 @@ static void syscall_queuedestroy(syscallrq_t *rq)
         SETERRNO(err);
 }
 
+//==============================================================================
+/**
+ * @brief  This syscall queue asynchronous I/O request. Request is realized by
+ *         I/O thread, client is not blocked.
+ *
+ * @param  rq                   syscall request
+ */
+//==============================================================================
+static void syscall_aiosubmit(syscallrq_t *rq)
+{
+        GETARG(struct aiocb *, aiocb);
+
+        int err = EINVAL;
+
+        if (  aiocb && aiocb->aio_buf && aiocb->aio_nbytes
+           && (  aiocb->aio_lio_opcode == LIO_READ
+              || aiocb->aio_lio_opcode == LIO_WRITE) ) {
+
+                // invalid file is reported at submit, not by I/O thread
+                int ferr;
+                err = _vfs_ferror(cast(FILE*, aiocb->aio_fildes), &ferr);
+                if (err) {
+                        err = EBADF;
+                }
+        }
+
+        if (!err) {
+                aiorq_t *aiorq = NULL;
+                err = _kzalloc(_MM_KRN, sizeof(aiorq_t), cast(void**, &aiorq));
+                if (!err) {
+                        aiorq->rq.client_proc   = rq->client_proc;
+                        aiorq->rq.client_thread = rq->client_thread;
+                        aiorq->rq.priority      = rq->priority;
+                        aiorq->rq.syscall_no    = rq->syscall_no;
+                        aiorq->rq.aiocb         = aiocb;
+                        aiorq->file             = cast(FILE*, aiocb->aio_fildes);
+                        _process_get_pid(rq->client_proc, &aiorq->pid);
+
+                        aiocb->_aio_ret = -1;
+                        aiocb->_aio_err = EINPROGRESS;
+
+                        // requests of the same file are realized one by one
+                        bool busy = false;
+
+                        _kernel_scheduler_lock();
+                        {
+                                aiorq_t **last = &aio.head;
+
+                                while (*last) {
+                                        busy |= ((*last)->file == aiorq->file);
+                                        last  = &(*last)->next;
+                                }
+
+                                aiorq->state = busy ? AIO_WAITING : AIO_QUEUED;
+                                *last = aiorq;
+                        }
+                        _kernel_scheduler_unlock();
+
+                        if (!busy) {
+                                err = aio_send(aiorq);
+                        }
+                }
+        }
+
+        SETERRNO(err);
+        SETRETURN(int, err ? -1 : 0);
+}
+
 #if __ENABLE_NETWORK__ == _YES_
 //==============================================================================
 /**
@@ -1861,6 +2927,26 @@ static void syscall_netsend(syscallrq_t *rq)
         SETRETURN(int, GETERRNO() == ESUCC ? cast(int, sent) : -1);
 }
 
+//==============================================================================
+/**
+ * @brief  This syscall send file content to socket.
+ *
+ * @param  rq                   syscall request
+ */
+//==============================================================================
+static void syscall_netsendfile(syscallrq_t *rq)
+{
+        GETARG(SOCKET *, socket);
+        GETARG(FILE *, file);
+        GETARG(size_t *, len);
+
+        size_t sent = 0;
+        SETERRNO(_net_socket_sendfile(socket, file, *len, &sent));
+
+        // sent data are reported also when rest of data is lost
+        SETRETURN(int, (GETERRNO() == ESUCC || sent) ? cast(int, sent) : -1);
+}
+
 //==============================================================================
 /**
  * @brief  This syscall send buffer to socket.
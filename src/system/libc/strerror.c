@@ -122,6 +122,8 @@ const char *strerror(int errnum)
                 [ECONNRESET  ] = NUMBER_TO_STR(ECONNRESET),
                 [EISCONN     ] = NUMBER_TO_STR(EISCONN),
                 [EALREADY    ] = NUMBER_TO_STR(EALREADY),
+                [EINPROGRESS ] = NUMBER_TO_STR(EINPROGRESS),
+                [EBADF       ] = NUMBER_TO_STR(EBADF),
 #elif (__OS_ERRNO_STRING_LEN__ == 2)
                 [ESUCC       ] = TO_STR(ESUCC),
                 [EPERM       ] = TO_STR(EPERM),
@@ -166,6 +168,8 @@ const char *strerror(int errnum)
                 [ECONNRESET  ] = TO_STR(ECONNRESET),
                 [EISCONN     ] = TO_STR(EISCONN),
                 [EALREADY    ] = TO_STR(EALREADY),
+                [EINPROGRESS ] = TO_STR(EINPROGRESS),
+                [EBADF       ] = TO_STR(EBADF),
 #elif (__OS_ERRNO_STRING_LEN__ == 3)
                 [ESUCC       ] = "Success",
                 [EPERM       ] = "Operation not permitted",
@@ -210,6 +214,8 @@ const char *strerror(int errnum)
                 [ECONNRESET  ] = "Connection reset",
                 [EISCONN     ] = "Socket is connected",
                 [EALREADY    ] = "Connection already in progress",
+                [EINPROGRESS ] = "Operation now in progress",
+                [EBADF       ] = "Bad file number",
 #else
 #error "__OS_ERRNO_STRING_LEN__ should be in range 0 - 3!"
 #endif
@@ -32,6 +32,7 @@ Brief    Cache management.
 #include <string.h>
 #include "mm/cache.h"
 #include "mm/mm.h"
+#include "drivers/class/storage/blkq.h"
 #include "kernel/errno.h"
 #include "kernel/kwrapper.h"
 #include "kernel/kpanic.h"
@@ -63,6 +64,8 @@ typedef struct {
         cache_t            *list_head;          //!< the smallest cache
         mutex_t            *list_mtx;           //!< protection mutex
         bool                sync_needed;        //!< FS synchronization needed to free dirty caches
+        u32_t               hits;               //!< number of blocks read from cache
+        u32_t               misses;             //!< number of blocks read from device
 } cache_man_t;
 
 /*==============================================================================
@@ -264,16 +267,7 @@ static int _cache_write(dev_t dev, u32_t blkpos, size_t blksz, size_t blkcnt, co
         int err = ESUCC;
 
         if (mode == CACHE_WRITE_THROUGH) {
-                fpos_t fpos  = cast(fpos_t, blkpos) * blksz;
-                size_t wrcnt = 0;
-                size_t wrsz  = blksz * blkcnt;
-                struct vfs_fattr fattr = {false, false};
-
-                err = _driver_write(dev, buf, wrsz, &fpos, &wrcnt, fattr);
-
-                if (!err && (wrcnt != wrsz) ) {
-                        err = EIO;
-                }
+                err = _blkq_write(dev, blkpos, blksz, blkcnt, buf);
         }
 
         while (!err && blkcnt--) {
@@ -299,15 +293,7 @@ static int _cache_write(dev_t dev, u32_t blkpos, size_t blksz, size_t blkcnt, co
                 }
 
                 if (!err && !cache && mode != CACHE_WRITE_THROUGH) {
-                        fpos_t fpos  = cast(fpos_t, blkpos) * blksz;
-                        size_t wrcnt = 0;
-                        struct vfs_fattr fattr = {false, false};
-
-                        err = _driver_write(dev, buf, blksz, &fpos, &wrcnt, fattr);
-
-                        if (!err && wrcnt != blksz) {
-                                err = EIO;
-                        }
+                        err = _blkq_write(dev, blkpos, blksz, 1, buf);
                 }
 
                 blkpos++;
@@ -345,17 +331,12 @@ static int _cache_read(dev_t dev, u32_t blkpos, size_t blksz, size_t blkcnt, u8_
                         if (cache_find(dev, blkpos, &cache) == ESUCC) {
                                 memcpy(buf, &cache_buf(cache), blksz);
                                 cache->temp++;
+                                cman.hits++;
 
                         } else {
-                                fpos_t fpos  = cast(fpos_t, blkpos) * blksz;
-                                size_t rdcnt = 0;
-                                struct vfs_fattr fattr = {false, false};
-
-                                err = _driver_read(dev, buf, blksz, &fpos, &rdcnt, fattr);
+                                cman.misses++;
 
-                                if (!err && rdcnt != blksz) {
-                                        err = EIO;
-                                }
+                                err = _blkq_read(dev, blkpos, blksz, 1, buf);
 
                                 if (!err) {
                                         if (cache_alloc(dev, blkpos, blksz, &cache) == ESUCC) {
@@ -373,6 +354,91 @@ static int _cache_read(dev_t dev, u32_t blkpos, size_t blksz, size_t blkcnt, u8_
 
         return err;
 }
+
+//==============================================================================
+/**
+ * @brief Function write blocks directly to selected device in single request.
+ *        Cached blocks of written range are dropped because contain older
+ *        data. Written blocks are not cached.
+ *
+ * @param  dev          block device
+ * @param  blkpos       block position
+ * @param  blksz        block size
+ * @param  blkcnt       block count
+ * @param  buf          buffer to write from (blocks)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int _cache_direct_write(dev_t dev, u32_t blkpos, size_t blksz, size_t blkcnt, const u8_t *buf)
+{
+        int err = _mutex_lock(cman.list_mtx, MTX_TIMEOUT);
+        if (!err) {
+                cache_t *cache = cman.list_head;
+                while (cache) {
+                        cache_t *next = cache->next;
+
+                        if (  (cache->dev == dev) && (cache->size == blksz)
+                           && (cache->pos - blkpos < blkcnt) ) {
+
+                                cache_free(cache);
+                        }
+
+                        cache = next;
+                }
+
+                _mutex_unlock(cman.list_mtx);
+
+                err = _blkq_write(dev, blkpos, blksz, blkcnt, buf);
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function read blocks directly from selected device in single request.
+ *        Cached blocks of read range are copied to the buffer because dirty
+ *        ones contain newer data than device. Clean blocks are copied too:
+ *        block can be synchronized (and marked clean) between device read
+ *        and this step, and clean block always matches device. Read blocks
+ *        are not cached.
+ *
+ * @param  dev          block device
+ * @param  blkpos       block position
+ * @param  blksz        block size
+ * @param  blkcnt       block count
+ * @param  buf          buffer to read (blocks)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+static int _cache_direct_read(dev_t dev, u32_t blkpos, size_t blksz, size_t blkcnt, u8_t *buf)
+{
+        int err = _blkq_read(dev, blkpos, blksz, blkcnt, buf);
+
+        if (!err) {
+                err = _mutex_lock(cman.list_mtx, MTX_TIMEOUT);
+                if (!err) {
+                        cache_t *cache = cman.list_head;
+                        while (cache) {
+                                if (  (cache->dev == dev)
+                                   && (cache->size == blksz)
+                                   && (cache->pos - blkpos < blkcnt) ) {
+
+                                        memcpy(&buf[(cache->pos - blkpos) * blksz],
+                                               &cache_buf(cache), blksz);
+                                }
+
+                                cache = cache->next;
+                        }
+
+                        _mutex_unlock(cman.list_mtx);
+                }
+        }
+
+        return err;
+}
 #endif
 
 //==============================================================================
@@ -404,6 +470,33 @@ void _cache_sync(void)
         if (!err) {
                 u16_t sync_cnt = 0;
 
+                // dirty blocks are submitted in single batch, so request queue
+                // sorts and merges them to multi-block transfers
+                size_t dirty = 0;
+                for (cache_t *cache = cman.list_head; cache; cache = cache->next) {
+                        if (cache->dirty) {
+                                dirty++;
+                        }
+                }
+
+                blkq_req_t *req = NULL;
+                if (dirty && _kmalloc(_MM_KRN, dirty * sizeof(blkq_req_t), cast(void*, &req)) == ESUCC) {
+                        size_t n = 0;
+                        for (cache_t *cache = cman.list_head; cache; cache = cache->next) {
+                                if (cache->dirty) {
+                                        req[n].dev    = cache->dev;
+                                        req[n].buf    = cast(u8_t*, &cache_buf(cache));
+                                        req[n].blkpos = cache->pos;
+                                        req[n].blksz  = cache->size;
+                                        req[n].blkcnt = 1;
+                                        req[n].write  = true;
+                                        n++;
+                                }
+                        }
+
+                        _blkq_submit(req, n);
+                }
+
                 cache_t *cache = cman.list_head;
 
                 while (cache) {
@@ -411,13 +504,9 @@ void _cache_sync(void)
 
                         if (cache->dirty) {
 
-                                fpos_t fpos  = cast(fpos_t, cache->pos) * cache->size;
-                                size_t wrcnt = 0;
-                                struct vfs_fattr fattr = {false, false};
-
-                                int e = _driver_write(cache->dev,
-                                                      cast(const u8_t*, &cache_buf(cache)),
-                                                      cache->size, &fpos, &wrcnt, fattr);
+                                int e = req ? req[sync_cnt].err
+                                            : _blkq_write(cache->dev, cache->pos, cache->size,
+                                                          1, cast(const u8_t*, &cache_buf(cache)));
                                 if (e) {
                                         printk("CACHE: sync error %d [%d:%d:%d]", e,
                                                _dev_t__extract_modno(cache->dev),
@@ -439,6 +528,10 @@ void _cache_sync(void)
 
                 _mutex_unlock(cman.list_mtx);
 
+                if (req) {
+                        _kfree(_MM_KRN, cast(void*, &req));
+                }
+
                 if (sync_cnt) {
                         printk("CACHE: synchronized %d blocks", sync_cnt);
                 }
@@ -557,6 +650,47 @@ bool _cache_is_sync_needed(void)
 #endif
 }
 
+//==============================================================================
+/**
+ * @brief  Function return statistics of cache subsystem.
+ *
+ * @param  stat         statistics container
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int sys_cache_get_stat(struct cache_stat *stat)
+{
+        if (!stat) {
+                return EINVAL;
+        }
+
+        memset(stat, 0, sizeof(*stat));
+
+#if __OS_SYSTEM_FS_CACHE_ENABLE__ > 0
+        int err = _mutex_lock(cman.list_mtx, MTX_TIMEOUT);
+        if (!err) {
+                for (cache_t *cache = cman.list_head; cache; cache = cache->next) {
+                        stat->blocks++;
+                        stat->bytes += cache->size;
+
+                        if (cache->dirty) {
+                                stat->dirty++;
+                        }
+                }
+
+                stat->hits   = cman.hits;
+                stat->misses = cman.misses;
+
+                _mutex_unlock(cman.list_mtx);
+        }
+
+        return err;
+#else
+        return ESUCC;
+#endif
+}
+
 //==============================================================================
 /**
  * @brief  Function drop cache of selected device (sync on dirty pages).
@@ -596,13 +730,8 @@ int sys_cache_drop(FILE *file)
 
                                 if (cache->dirty) {
 
-                                        fpos_t fpos  = cast(fpos_t, cache->pos) * cache->size;
-                                        size_t wrcnt = 0;
-                                        struct vfs_fattr fattr = {false, false};
-
-                                        err = _driver_write(cache->dev,
-                                                            cast(const u8_t*, &cache_buf(cache)),
-                                                            cache->size, &fpos, &wrcnt, fattr);
+                                        err = _blkq_write(cache->dev, cache->pos, cache->size,
+                                                          1, cast(const u8_t*, &cache_buf(cache)));
                                         if (err) {
                                                 printk("CACHE: sync error %d [%d:%d:%d]", err,
                                                        _dev_t__extract_modno(cache->dev),
@@ -661,16 +790,7 @@ int sys_cache_write(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt, const
 #else
                         UNUSED_ARG1(mode);
 
-                        fpos_t fpos  = cast(fpos_t, blkpos) * blksz;
-                        size_t wrcnt = 0;
-                        size_t wrsz  = blksz * blkcnt;
-                        struct vfs_fattr fattr = {false, false};
-
-                        err = _driver_write(stat.st_dev, buf, wrsz, &fpos, &wrcnt, fattr);
-
-                        if (!err && (wrcnt != wrsz) ) {
-                                err = EIO;
-                        }
+                        err = _blkq_write(stat.st_dev, blkpos, blksz, blkcnt, buf);
 #endif
                 } else {
                         err = _vfs_fseek(file, cast(i64_t, blkpos) * blksz, VFS_SEEK_SET);
@@ -718,16 +838,7 @@ int sys_cache_read(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt, u8_t *
 #if __OS_SYSTEM_FS_CACHE_ENABLE__ > 0
                         err = _cache_read(stat.st_dev, blkpos, blksz, blkcnt, buf);
 #else
-                        fpos_t fpos  = cast(fpos_t, blkpos) * blksz;
-                        size_t rdcnt = 0;
-                        size_t rdsz  = blksz * blkcnt;
-                        struct vfs_fattr fattr = {false, false};
-
-                        err = _driver_read(stat.st_dev, buf, rdsz, &fpos, &rdcnt, fattr);
-
-                        if (!err && (rdcnt != rdsz)) {
-                                err = EIO;
-                        }
+                        err = _blkq_read(stat.st_dev, blkpos, blksz, blkcnt, buf);
 #endif
                 } else {
                         err = _vfs_fseek(file, cast(i64_t, blkpos) * blksz, VFS_SEEK_SET);
@@ -746,6 +857,85 @@ int sys_cache_read(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt, u8_t *
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief Function write blocks to selected file omitting cache (direct I/O).
+ *        Blocks are written to the driver in single request and overlapped
+ *        cached blocks are dropped. Function is used for bulk data transfers
+ *        that should not evict metadata from cache.
+ *
+ * @param  file         file to write
+ * @param  blkpos       block position
+ * @param  blksz        block size
+ * @param  blkcnt       block count
+ * @param  buf          buffer to write from (blocks)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int sys_cache_direct_write(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt, const u8_t *buf)
+{
+        if (!file || !blksz || !blkcnt || !buf) {
+                return EINVAL;
+        }
+
+        struct stat stat;
+        int err = _vfs_fstat(file, &stat);
+        if (!err) {
+                if (stat.st_type == FILE_TYPE_DRV) {
+#if __OS_SYSTEM_FS_CACHE_ENABLE__ > 0
+                        err = _cache_direct_write(stat.st_dev, blkpos, blksz, blkcnt, buf);
+#else
+                        err = sys_cache_write(file, blkpos, blksz, blkcnt, buf, CACHE_WRITE_THROUGH);
+#endif
+                } else {
+                        err = sys_cache_write(file, blkpos, blksz, blkcnt, buf, CACHE_WRITE_THROUGH);
+                }
+        }
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief Function read blocks from selected file omitting cache (direct I/O).
+ *        Blocks are read from the driver in single request. Dirty cached blocks
+ *        are used instead of read data. Read blocks are not cached. Function
+ *        is used for bulk data transfers that should not evict metadata from
+ *        cache.
+ *
+ * @param  file         file to read
+ * @param  blkpos       block position
+ * @param  blksz        block size
+ * @param  blkcnt       block count
+ * @param  buf          buffer to read (blocks)
+ *
+ * @return One of errno value.
+ */
+//==============================================================================
+int sys_cache_direct_read(FILE *file, u32_t blkpos, size_t blksz, size_t blkcnt, u8_t *buf)
+{
+        if (!file || !blksz || !blkcnt || !buf) {
+                return EINVAL;
+        }
+
+        struct stat stat;
+        int err = _vfs_fstat(file, &stat);
+        if (!err) {
+                if (stat.st_type == FILE_TYPE_DRV) {
+#if __OS_SYSTEM_FS_CACHE_ENABLE__ > 0
+                        err = _cache_direct_read(stat.st_dev, blkpos, blksz, blkcnt, buf);
+#else
+                        err = sys_cache_read(file, blkpos, blksz, blkcnt, buf);
+#endif
+                } else {
+                        err = sys_cache_read(file, blkpos, blksz, blkcnt, buf);
+                }
+        }
+
+        return err;
+}
+
 /*==============================================================================
   End of file
 ==============================================================================*/
@@ -43,6 +43,7 @@
 #include "kernel/kwrapper.h"
 #include "kernel/sysfunc.h"
 #include "kernel/kpanic.h"
+#include "kernel/ktrace.h"
 
 /*==============================================================================
   Local macros
@@ -296,6 +297,8 @@ int _kfree(enum _mm_mem mpur, void **mem, ...)
                         *usage -= blksize;
                         _kernel_scheduler_unlock();
 
+                        _ktrace(_KTRACE_FREE, cast(uintptr_t, *mem), blksize);
+
                         *mem = NULL;
                 }
         }
@@ -523,6 +526,8 @@ static int kalloc(enum _mm_mem mpur, size_t size, bool clear, void **mem, void *
 
                                                 *mem = blk;
 
+                                                _ktrace(_KTRACE_ALLOC, cast(uintptr_t, blk), allocated);
+
                                                 err = ESUCC;
                                                 goto finish;
                                         }
@@ -36,6 +36,7 @@ Brief    Network management.
 #include "lwip/netif.h"
 #include "lwip/ip_addr.h"
 #include "lwip/tcpip.h"
+#include "lwip/tcp.h"
 #include "netif/etharp.h"
 
 /*==============================================================================
@@ -46,6 +47,12 @@ Brief    Network management.
 /*==============================================================================
   Local object types
 ==============================================================================*/
+/* connection state reported by netconn_event() (read without tcpip core lock) */
+typedef struct {
+        struct netconn *conn;
+        u16_t           sendevent;      //!< send buffer available
+        u16_t           errevent;       //!< connection error
+} conn_event_t;
 
 /*==============================================================================
   Local function prototypes
@@ -58,6 +65,10 @@ static void  restore_configuration();
 static int   DHCP_start_client();
 static err_t netif_configure(struct netif *netif);
 static int   IF_up(const ip_addr_t *ip_address, const ip_addr_t *net_mask, const ip_addr_t *gateway);
+static void  netconn_event(struct netconn *conn, enum netconn_evt evt, u16_t len);
+static int   conn_event_register(struct netconn *conn, u16_t sendevent, u16_t errevent);
+static void  conn_event_unregister(struct netconn *conn);
+static void  conn_event_sync_error(void *ctx);
 
 /*==============================================================================
   External function prototypes
@@ -77,6 +88,7 @@ static const u32_t DHCP_TIMEOUT   = 5000;
 static const u32_t INIT_TIMEOUT   = 5000;
 static const u32_t INPUT_TIMEOUT  = 5000;
 static const u32_t LINK_POLL_TIME = 250;
+static conn_event_t conn_event[MEMP_NUM_NETCONN];
 
 /*==============================================================================
   Exported objects
@@ -674,12 +686,19 @@ int INET_socket_create(NET_protocol_t prot, INET_socket_t *inet_sock)
 
                 _errno = 0;
 
-                inet_sock->netconn = netconn_new(prot == NET_PROTOCOL__TCP
-                                                       ? NETCONN_TCP
-                                                       : NETCONN_UDP);
+                inet_sock->netconn = netconn_new_with_callback(prot == NET_PROTOCOL__TCP
+                                                               ? NETCONN_TCP
+                                                               : NETCONN_UDP,
+                                                               netconn_event);
 
                 if (inet_sock->netconn) {
-                        err = ESUCC;
+                        // UDP connection is always writable
+                        err = conn_event_register(inet_sock->netconn,
+                                                  prot == NET_PROTOCOL__UDP, 0);
+                        if (err) {
+                                netconn_delete(inet_sock->netconn);
+                                inet_sock->netconn = NULL;
+                        }
                 } else {
                         if (_errno == ENOMEM) {
                                 err = _errno;
@@ -706,6 +725,7 @@ int INET_socket_destroy(INET_socket_t *inet_sock)
         }
 
         if (inet_sock->netconn) {
+                conn_event_unregister(inet_sock->netconn);
                 netconn_close(inet_sock->netconn);
                 netconn_delete(inet_sock->netconn);
         }
@@ -797,8 +817,33 @@ int INET_socket_listen(INET_socket_t *inet_sock)
 //==============================================================================
 int INET_socket_accept(INET_socket_t *inet_sock, INET_socket_t *new_inet_sock)
 {
-        return lwIP_status_to_errno(netconn_accept(inet_sock->netconn,
-                                                   &new_inet_sock->netconn));
+        int err = lwIP_status_to_errno(netconn_accept(inet_sock->netconn,
+                                                      &new_inet_sock->netconn));
+        if (!err) {
+                // accepted connection is writable; events before accept are
+                // not tracked, so error state is taken from connection by
+                // tcpip thread after registration (connection is owned by
+                // tcpip thread, no event is lost between read and register)
+                struct netconn *conn = new_inet_sock->netconn;
+
+                err = conn_event_register(conn, 1, 0);
+                if (!err) {
+                        if (tcpip_callback(conn_event_sync_error, conn) == ERR_OK) {
+                                sys_arch_sem_wait(&conn->op_completed, 0);
+                        } else {
+                                conn_event_unregister(conn);
+                                err = ENOMEM;
+                        }
+                }
+
+                if (err) {
+                        netconn_close(conn);
+                        netconn_delete(conn);
+                        new_inet_sock->netconn = NULL;
+                }
+        }
+
+        return err;
 }
 
 //==============================================================================
@@ -1123,6 +1168,176 @@ int INET_socket_getaddress(INET_socket_t *inet_sock, NET_INET_sockaddr_t *sockad
         return err;
 }
 
+//==============================================================================
+/**
+ * @brief  Function is called by lwIP when state of connection is changed
+ *         (received data, freed send buffer, error). Accepted connections
+ *         inherit callback of listening connection.
+ * @param  conn         connection
+ * @param  evt          event
+ * @param  len          data length
+ */
+//==============================================================================
+static void netconn_event(struct netconn *conn, enum netconn_evt evt, u16_t len)
+{
+        UNUSED_ARG1(len);
+
+        sys_critical_section_begin();
+        {
+                for (size_t i = 0; i < ARRAY_SIZE(conn_event); i++) {
+                        conn_event_t *cevt = &conn_event[i];
+
+                        if (cevt->conn == conn) {
+                                switch (evt) {
+                                case NETCONN_EVT_SENDPLUS : cevt->sendevent = 1; break;
+                                case NETCONN_EVT_SENDMINUS: cevt->sendevent = 0; break;
+                                case NETCONN_EVT_ERROR    : cevt->errevent  = 1; break;
+                                default: break;
+                                }
+
+                                break;
+                        }
+                }
+        }
+        sys_critical_section_end();
+
+        sys_poll_notify(conn);
+}
+
+//==============================================================================
+/**
+ * @brief  Function start tracking of connection events.
+ * @param  conn         connection
+ * @param  sendevent    initial send event state
+ * @param  errevent     initial error event state
+ * @return One of @ref errno value.
+ */
+//==============================================================================
+static int conn_event_register(struct netconn *conn, u16_t sendevent, u16_t errevent)
+{
+        int err = ENOMEM;
+
+        sys_critical_section_begin();
+        {
+                for (size_t i = 0; i < ARRAY_SIZE(conn_event); i++) {
+                        conn_event_t *cevt = &conn_event[i];
+
+                        if (cevt->conn == NULL) {
+                                cevt->conn      = conn;
+                                cevt->sendevent = sendevent;
+                                cevt->errevent  = errevent;
+                                err = ESUCC;
+                                break;
+                        }
+                }
+        }
+        sys_critical_section_end();
+
+        return err;
+}
+
+//==============================================================================
+/**
+ * @brief  Function is called in tcpip thread and records error that occurred
+ *         before connection was registered. Completion is signaled by
+ *         connection operation semaphore (connection is not used yet).
+ * @param  ctx          connection
+ */
+//==============================================================================
+static void conn_event_sync_error(void *ctx)
+{
+        struct netconn *conn = ctx;
+
+        if (ERR_IS_FATAL(conn->last_err)) {
+                netconn_event(conn, NETCONN_EVT_ERROR, 0);
+        }
+
+        sys_sem_signal(&conn->op_completed);
+}
+
+//==============================================================================
+/**
+ * @brief  Function stop tracking of connection events. Function is called
+ *         before connection is deleted, so slot is not assigned to new
+ *         connection allocated at the same address.
+ * @param  conn         connection
+ */
+//==============================================================================
+static void conn_event_unregister(struct netconn *conn)
+{
+        sys_critical_section_begin();
+        {
+                for (size_t i = 0; i < ARRAY_SIZE(conn_event); i++) {
+                        if (conn_event[i].conn == conn) {
+                                conn_event[i].conn = NULL;
+                                break;
+                        }
+                }
+        }
+        sys_critical_section_end();
+}
+
+//==============================================================================
+/**
+ * @brief  Function returns readiness of socket. Socket is readable if has
+ *         buffered data, received packets or incoming connections (mailboxes
+ *         are thread safe queues). Writable and error states are tracked by
+ *         netconn_event(), so TCP control block is not accessed without
+ *         tcpip core lock.
+ * @param  inet_sock    socket
+ * @param  revents      ready events
+ * @return One of @ref errno value.
+ */
+//==============================================================================
+int INET_socket_poll(INET_socket_t *inet_sock, int *revents)
+{
+        struct netconn *conn  = inet_sock->netconn;
+        size_t          items = 0;
+
+        sys_poll_watch(conn);
+
+        *revents = 0;
+
+        if (inet_sock->netbuf) {
+                *revents |= POLLIN;
+        }
+
+        if (sys_mbox_valid(&conn->recvmbox)) {
+                sys_queue_get_number_of_items(conn->recvmbox, &items);
+                if (items > 0) {
+                        *revents |= POLLIN;
+                }
+        }
+
+        if (sys_mbox_valid(&conn->acceptmbox)) {
+                sys_queue_get_number_of_items(conn->acceptmbox, &items);
+                if (items > 0) {
+                        *revents |= POLLIN;
+                }
+        }
+
+        sys_critical_section_begin();
+        {
+                for (size_t i = 0; i < ARRAY_SIZE(conn_event); i++) {
+                        conn_event_t *cevt = &conn_event[i];
+
+                        if (cevt->conn == conn) {
+                                if (cevt->errevent) {
+                                        *revents |= POLLERR | POLLHUP;
+
+                                } else if (cevt->sendevent) {
+                                        *revents |= POLLOUT;
+                                }
+
+                                break;
+                        }
+                }
+        }
+        sys_critical_section_end();
+
+        return ESUCC;
+}
+
 //==============================================================================
 /**
  * @brief  Function convert value for host/network purpose.
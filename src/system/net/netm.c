@@ -406,6 +406,93 @@ int _net_socket_send(SOCKET *socket, const void *buf, size_t len, NET_flags_t fl
         }
 }
 
+//==============================================================================
+/**
+ * @brief Function send file content to selected socket.
+ *
+ * Data is sent directly from file system memory if file can be mapped
+ * (e.g. romfs), otherwise file is read to kernel buffer and sent in chunks.
+ * Transfer starts at current file position and file position is moved by
+ * number of sent bytes. If socket accepts less data than was read from
+ * stream file (pipe, TTY) then the rest of data is lost and EIO is returned.
+ *
+ * @param socket        socket that send bytes
+ * @param file          source file
+ * @param len           number of bytes to send
+ * @param sent          number of sent bytes
+ * @return One of @ref errno value.
+ */
+//==============================================================================
+int _net_socket_sendfile(SOCKET *socket, FILE *file, size_t len, size_t *sent)
+{
+        if (!is_socket_valid(socket) || !file || !len || !sent) {
+                return EINVAL;
+        }
+
+        *sent = 0;
+
+        i64_t pos = 0;
+        int err = _vfs_ftell(file, &pos);
+        if (err) {
+                return err;
+        }
+
+        struct vfs_map map;
+        if (_vfs_fmap(file, &map) == ESUCC) {
+                if (cast(u64_t, pos) < map.size) {
+                        len = min(len, cast(size_t, map.size - pos));
+                        err = _net_socket_send(socket,
+                                               cast(const u8_t*, map.addr) + pos,
+                                               len, NET_FLAGS__NOCOPY, sent);
+                        if (!err) {
+                                err = _vfs_fseek(file, *sent, VFS_SEEK_CUR);
+                        }
+                }
+
+                return err;
+        }
+
+        size_t bufsz = min(len, VFS_COPY_BUFFER_SIZE);
+        u8_t  *buf   = NULL;
+
+        while ((err = _kmalloc(_MM_NET, bufsz, cast(void**, &buf))) == ENOMEM) {
+                bufsz /= 2;
+                if (bufsz < 128) {
+                        return ENOMEM;
+                }
+        }
+
+        while (!err && len) {
+                size_t rdcnt = 0;
+                err = _vfs_fread(buf, min(len, bufsz), &rdcnt, file);
+                if (err || rdcnt == 0) {
+                        break;
+                }
+
+                NET_flags_t flags = (rdcnt < len) ? NET_FLAGS__MORE : NET_FLAGS__NONE;
+
+                size_t n = 0;
+                err = _net_socket_send(socket, buf, rdcnt, flags, &n);
+                if (!err) {
+                        *sent += n;
+                        len   -= n;
+
+                        if (n < rdcnt) {
+                                if (_vfs_fseekable(file)) {
+                                        _vfs_fseek(file, -cast(i64_t, rdcnt - n), VFS_SEEK_CUR);
+                                } else {
+                                        err = EIO;
+                                }
+                                break;
+                        }
+                }
+        }
+
+        _kfree(_MM_NET, cast(void**, &buf));
+
+        return err;
+}
+
 //==============================================================================
 /**
  * @brief Function send bytes by socket to selected address.
@@ -604,6 +691,27 @@ int _net_socket_getaddress(SOCKET *socket, NET_generic_sockaddr_t *sockaddr)
         }
 }
 
+//==============================================================================
+/**
+ * @brief Function return readiness of selected socket.
+ * @param socket        socket
+ * @param revents       ready events (POLLIN, POLLOUT, POLLERR, POLLHUP)
+ * @return One of @ref errno value.
+ */
+//==============================================================================
+int _net_socket_poll(SOCKET *socket, int *revents)
+{
+        PROXY_TABLE = {
+                PROXY_ADD_FAMILY(INET, INET_socket_poll),
+        };
+
+        if (is_socket_valid(socket) && revents) {
+                return call_proxy_function(socket->family, socket->ctx, revents);
+        } else {
+                return EINVAL;
+        }
+}
+
 //==============================================================================
 /**
  * @brief Function return address of host by name.
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+#
+# Converts kernel event trace saved by 'trace save <file>' (records of
+# /proc/stat/trace, see dnx/procstat.h) to Chrome/Perfetto JSON trace format.
+# Open result in chrome://tracing or https://ui.perfetto.dev.
+#
+# Usage: ktrace2json.py <trace-file> [<output.json>]
+#
+import sys
+import json
+import struct
+
+PROCSTAT_VERSION = 1
+
+# procstat_trace_t layout (little endian)
+RECORD = struct.Struct('<HHIIHBBII')
+
+SWITCH, SC_ENTER, SC_EXIT, SC_BEGIN, SC_END, BLOCK_RECEIVE, BLOCK_SEND, \
+DRV_READ, DRV_WRITE, DRV_DONE, ALLOC, FREE = range(1, 13)
+
+
+def read_records(path):
+    data = open(path, 'rb').read()
+    recs = []
+    pos  = 0
+
+    while pos + 4 <= len(data):
+        version, size = struct.unpack_from('<HH', data, pos)
+        if size < RECORD.size or pos + size > len(data):
+            break
+
+        if version == PROCSTAT_VERSION:
+            _, _, seq, ts, pid, thread, event, arg0, arg1 = RECORD.unpack_from(data, pos)
+            recs.append((seq, ts, pid, thread, event, arg0, arg1))
+
+        pos += size
+
+    # sort by sequence number and drop duplicates (buffer moved during reading)
+    recs.sort(key=lambda r: r[0])
+    uniq = []
+    for r in recs:
+        if not uniq or uniq[-1][0] != r[0]:
+            uniq.append(r)
+
+    return uniq
+
+
+def convert(recs):
+    events  = []
+    running = None
+    heap    = 0
+    last_ts = None
+    offset  = 0
+
+    for seq, ts, pid, thread, event, arg0, arg1 in recs:
+        # unwrap 32-bit microsecond timestamp
+        if last_ts is not None and ts < last_ts and last_ts - ts > 0x80000000:
+            offset += 1 << 32
+        last_ts = ts
+        ts += offset
+
+        tid  = pid * 256 + thread
+        base = {'ts': ts, 'pid': pid, 'tid': tid}
+
+        if event == SWITCH:
+            # running tasks are shown on separate CPU track
+            if running is not None:
+                events.append(dict(running, ph='E', ts=ts))
+            name = 'PID %d thread %d' % (pid, thread) if pid else 'task 0x%X' % arg0
+            running = {'ts': ts, 'pid': 0, 'tid': 0, 'name': name, 'cat': 'sched'}
+            events.append(dict(running, ph='B'))
+
+        elif event in (SC_ENTER, SC_BEGIN):
+            cat = 'syscall' if event == SC_ENTER else 'kworker'
+            args = {'client_pid': arg1} if event == SC_BEGIN else {}
+            events.append(dict(base, ph='B', name='syscall %d' % arg0, cat=cat, args=args))
+
+        elif event in (SC_EXIT, SC_END):
+            cat = 'syscall' if event == SC_EXIT else 'kworker'
+            events.append(dict(base, ph='E', name='syscall %d' % arg0, cat=cat, args={'errno': arg1}))
+
+        elif event in (DRV_READ, DRV_WRITE):
+            name = 'read' if event == DRV_READ else 'write'
+            events.append(dict(base, ph='B', name='drv %s 0x%X' % (name, arg0), cat='driver',
+                               args={'bytes': arg1}))
+
+        elif event == DRV_DONE:
+            events.append(dict(base, ph='E', cat='driver', args={'errno': arg1}))
+
+        elif event in (BLOCK_RECEIVE, BLOCK_SEND):
+            name = 'block receive' if event == BLOCK_RECEIVE else 'block send'
+            events.append(dict(base, ph='i', s='t', name=name, cat='block',
+                               args={'object': hex(arg0)}))
+
+        elif event in (ALLOC, FREE):
+            heap += arg1 if event == ALLOC else -arg1
+            events.append({'ts': ts, 'pid': 0, 'tid': 0, 'ph': 'C', 'name': 'heap',
+                           'cat': 'mm', 'args': {'bytes': heap}})
+
+    if running is not None and recs:
+        events.append(dict(running, ph='E', ts=last_ts + offset))
+
+    # thread names
+    for tid in sorted({(e['pid'], e['tid']) for e in events}):
+        events.append({'ph': 'M', 'name': 'thread_name', 'pid': tid[0], 'tid': tid[1],
+                       'args': {'name': 'PID %d thread %d' % (tid[0], tid[1] % 256)
+                                if tid[0] else 'CPU'}})
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+
+def main():
+    if len(sys.argv) < 2:
+        print('Usage: ktrace2json.py <trace-file> [<output.json>]')
+        return 1
+
+    recs   = read_records(sys.argv[1])
+    result = json.dumps(convert(recs))
+
+    if len(sys.argv) > 2:
+        open(sys.argv[2], 'w').write(result)
+    else:
+        print(result)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())